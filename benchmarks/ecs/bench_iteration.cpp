@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+#include "ecs/registry.h"
+#include "ecs/zipper.h"
+
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+namespace {
+
+// One distinct component type per index, stored with the default (sparse) layout like most game components
+template <std::size_t TIndex> struct BenchComponent {
+    float value;
+};
+
+template <std::size_t... TIs> void populate(ecs::Registry& registry, std::int64_t count, std::index_sequence<TIs...> /*seq*/) {
+    for (std::int64_t i = 0; i < count; i++) {
+        auto e = registry.spawn_entity();
+        (registry.add_component(e, BenchComponent<TIs>{static_cast<float>(i)}), ...);
+    }
+}
+
+// Every entity owns the N components: args are (entities)
+template <std::size_t... TIs> void zipper_iteration(benchmark::State& state, std::index_sequence<TIs...> seq) {
+    ecs::Registry registry;
+    populate(registry, state.range(0), seq);
+    auto arrays = std::tie(registry.get_components<BenchComponent<TIs>>()...);
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (auto&& slots : ecs::zipper(std::get<TIs>(arrays)...)) {
+            std::apply(
+                [&sum](auto&... opts) {
+                    if ((opts.has_value() && ...))
+                        sum += (opts->value + ...);
+                },
+                slots);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <std::size_t... TIs> void view_iteration(benchmark::State& state, std::index_sequence<TIs...> seq) {
+    ecs::Registry registry;
+    populate(registry, state.range(0), seq);
+    auto view = registry.view<BenchComponent<TIs>...>();
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (auto&& row : view) {
+            std::apply([&sum](ecs::Entity, auto&... comps) { sum += (comps.value + ...); }, row);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <std::size_t TCount> void bm_zipper_iteration(benchmark::State& state) {
+    zipper_iteration(state, std::make_index_sequence<TCount>{});
+}
+
+template <std::size_t TCount> void bm_view_iteration(benchmark::State& state) {
+    view_iteration(state, std::make_index_sequence<TCount>{});
+}
+
+void entity_counts(benchmark::internal::Benchmark* bench) {
+    bench->ArgName("entities")->Arg(1'000)->Arg(10'000)->Arg(100'000);
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(bm_zipper_iteration, 1)->Apply(entity_counts);
+BENCHMARK_TEMPLATE(bm_zipper_iteration, 2)->Apply(entity_counts);
+BENCHMARK_TEMPLATE(bm_zipper_iteration, 3)->Apply(entity_counts);
+BENCHMARK_TEMPLATE(bm_zipper_iteration, 4)->Apply(entity_counts);
+BENCHMARK_TEMPLATE(bm_zipper_iteration, 5)->Apply(entity_counts);
+BENCHMARK_TEMPLATE(bm_zipper_iteration, 6)->Apply(entity_counts);
+
+BENCHMARK_TEMPLATE(bm_view_iteration, 1)->Apply(entity_counts);
+BENCHMARK_TEMPLATE(bm_view_iteration, 2)->Apply(entity_counts);
+BENCHMARK_TEMPLATE(bm_view_iteration, 3)->Apply(entity_counts);
+BENCHMARK_TEMPLATE(bm_view_iteration, 4)->Apply(entity_counts);
+BENCHMARK_TEMPLATE(bm_view_iteration, 5)->Apply(entity_counts);
+BENCHMARK_TEMPLATE(bm_view_iteration, 6)->Apply(entity_counts);
@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+#include "ecs/registry.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+
+namespace {
+
+struct BenchTransform {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+    float x, y, rotation;
+};
+
+struct BenchPattern {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+    float timer, frequency, amplitude;
+};
+
+void populate(ecs::Registry& registry, std::int64_t count) {
+    for (std::int64_t i = 0; i < count; i++) {
+        auto e = registry.spawn_entity();
+        registry.add_component(e, BenchTransform{static_cast<float>(i), 0.0f, 0.0f});
+        registry.add_component(e, BenchPattern{0.0f, 0.5f + static_cast<float>(i % 7), 10.0f});
+    }
+}
+
+// Sine movement of enemy_movement_system over a view: args are (entities, threads)
+void bm_view_par_each(benchmark::State& state) {
+    ecs::Registry registry;
+    ecs::ThreadPool pool(static_cast<std::size_t>(state.range(1)) - 1);
+    populate(registry, state.range(0));
+    auto view = registry.view<BenchTransform, BenchPattern>();
+
+    for (auto _ : state) {
+        view.par_each(
+            pool,
+            [](ecs::Entity, BenchTransform& pos, BenchPattern& pat) {
+                pat.timer += 0.016f;
+                pos.y = std::sin(pat.timer * pat.frequency * 6.2831f) * pat.amplitude;
+                pos.x -= 1.0f;
+            },
+            0);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bm_group_par_each(benchmark::State& state) {
+    ecs::Registry registry;
+    ecs::ThreadPool pool(static_cast<std::size_t>(state.range(1)) - 1);
+    auto group = registry.group<BenchTransform, BenchPattern>();
+    populate(registry, state.range(0));
+
+    for (auto _ : state) {
+        group.par_each(
+            pool,
+            [](ecs::Entity, BenchTransform& pos, BenchPattern& pat) {
+                pat.timer += 0.016f;
+                pos.y = std::sin(pat.timer * pat.frequency * 6.2831f) * pat.amplitude;
+                pos.x -= 1.0f;
+            },
+            0);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void scaling_args(benchmark::internal::Benchmark* bench) {
+    const auto k_cores = static_cast<std::int64_t>(std::max(1U, std::thread::hardware_concurrency()));
+
+    for (std::int64_t entities : {10'000, 100'000}) {
+        for (std::int64_t threads = 1; threads < k_cores; threads *= 2)
+            bench->Args({entities, threads});
+        bench->Args({entities, k_cores});
+    }
+    bench->ArgNames({"entities", "threads"})->UseRealTime();
+}
+
+} // namespace
+
+BENCHMARK(bm_view_par_each)->Apply(scaling_args);
+BENCHMARK(bm_group_par_each)->Apply(scaling_args);
@@ -0,0 +1,200 @@
+#include <benchmark/benchmark.h>
+#include "ecs/registry.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct BenchPosition {
+    float x, y;
+};
+
+struct BenchVelocity {
+    float vx, vy;
+};
+
+struct BenchHealth {
+    int hp;
+};
+
+// Spawn a wave of entities with three components, then kill it: args are (entities)
+void bm_spawn_kill_churn(benchmark::State& state) {
+    ecs::Registry registry;
+    std::vector<ecs::Entity> wave;
+    wave.reserve(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        for (std::int64_t i = 0; i < state.range(0); i++) {
+            auto e = registry.spawn_entity();
+            registry.add_component(e, BenchPosition{0.0f, 0.0f});
+            registry.add_component(e, BenchVelocity{1.0f, 0.0f});
+            registry.add_component(e, BenchHealth{1});
+            wave.push_back(e);
+        }
+        for (auto e : wave)
+            registry.kill_entity(e);
+        wave.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bm_spawn_kill_churn_batch(benchmark::State& state) {
+    ecs::Registry registry;
+    const auto k_count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        auto wave = registry.spawn_entities(k_count);
+        registry.emplace_components<BenchPosition>(wave, 0.0f, 0.0f);
+        registry.emplace_components<BenchVelocity>(wave, 1.0f, 0.0f);
+        registry.emplace_components<BenchHealth>(wave, 1);
+        registry.kill_entities(wave);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Add then remove one component on live entities
+void bm_add_remove_component(benchmark::State& state) {
+    ecs::Registry registry;
+    std::vector<ecs::Entity> entities;
+    for (std::int64_t i = 0; i < state.range(0); i++) {
+        entities.push_back(registry.spawn_entity());
+        registry.add_component(entities.back(), BenchPosition{0.0f, 0.0f});
+    }
+    registry.register_component<BenchHealth>();
+
+    for (auto _ : state) {
+        for (auto e : entities)
+            registry.add_component(e, BenchHealth{1});
+        for (auto e : entities)
+            registry.remove_component<BenchHealth>(e);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+
+// Snapshot path of the server: every listed component of one entity
+void bm_visit_components(benchmark::State& state) {
+    ecs::Registry registry;
+    std::vector<ecs::Entity> entities;
+    for (std::int64_t i = 0; i < state.range(0); i++) {
+        auto e = registry.spawn_entity();
+        registry.add_component(e, BenchPosition{0.0f, 0.0f});
+        registry.add_component(e, BenchVelocity{1.0f, 0.0f});
+        registry.add_component(e, BenchHealth{1});
+        entities.push_back(e);
+    }
+
+    for (auto _ : state) {
+        for (auto e : entities) {
+            std::size_t visited = 0;
+            registry.visit_components<BenchPosition, BenchVelocity, BenchHealth>(e, [&visited](auto const& comp) {
+                benchmark::DoNotOptimize(&comp);
+                visited++;
+            });
+            benchmark::DoNotOptimize(visited);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bm_tag_lookup_by_name(benchmark::State& state) {
+    ecs::Registry registry;
+    auto& tags = registry.get_tag_registry();
+    std::vector<std::string> names;
+    for (std::int64_t i = 0; i < state.range(0); i++) {
+        names.push_back("entity_" + std::to_string(i));
+        tags.create_and_bind_tag(names.back(), registry.spawn_entity());
+    }
+
+    for (auto _ : state) {
+        for (auto const& name : names)
+            benchmark::DoNotOptimize(tags.get_entity(name));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Names interned once, as systems keeping atoms around do
+void bm_tag_lookup_by_atom(benchmark::State& state) {
+    ecs::Registry registry;
+    auto& tags = registry.get_tag_registry();
+    std::vector<ecs::Atom> names;
+    for (std::int64_t i = 0; i < state.range(0); i++) {
+        names.emplace_back("entity_" + std::to_string(i));
+        tags.create_and_bind_tag(names.back(), registry.spawn_entity());
+    }
+
+    for (auto _ : state) {
+        for (auto name : names)
+            benchmark::DoNotOptimize(tags.get_entity(name));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void bm_tag_lookup_by_entity(benchmark::State& state) {
+    ecs::Registry registry;
+    auto& tags = registry.get_tag_registry();
+    std::vector<ecs::Entity> entities;
+    for (std::int64_t i = 0; i < state.range(0); i++) {
+        entities.push_back(registry.spawn_entity());
+        tags.create_and_bind_tag("entity_" + std::to_string(i), entities.back());
+    }
+
+    for (auto _ : state) {
+        for (auto e : entities)
+            benchmark::DoNotOptimize(tags.get_tag_name(e));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Fill a registry with `count` entities holding three components
+std::vector<ecs::Entity> populate(ecs::Registry& registry, std::size_t count) {
+    auto entities = registry.spawn_entities(count);
+    registry.emplace_components<BenchPosition>(entities, 0.0f, 0.0f);
+    registry.emplace_components<BenchVelocity>(entities, 1.0f, 0.0f);
+    registry.emplace_components<BenchHealth>(entities, 1);
+    return entities;
+}
+
+// Take and drop a checkpoint without writing in between: args are (entities)
+void bm_checkpoint(benchmark::State& state) {
+    ecs::Registry registry;
+    populate(registry, static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto checkpoint = registry.checkpoint();
+        benchmark::DoNotOptimize(checkpoint);
+    }
+}
+
+// Rollback frame: checkpoint, move 1 entity in 10 and kill 1 in 100, then restore
+void bm_checkpoint_restore(benchmark::State& state) {
+    ecs::Registry registry;
+    auto entities = populate(registry, static_cast<std::size_t>(state.range(0)));
+    auto checkpoint = registry.checkpoint();
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < entities.size(); i += 10)
+            registry.get_component<BenchPosition>(entities[i]).x += 1.0f;
+        for (std::size_t i = 0; i < entities.size(); i += 100)
+            registry.kill_entity(entities[i]);
+        registry.restore(checkpoint);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void entity_counts(benchmark::internal::Benchmark* bench) {
+    bench->ArgName("entities")->Arg(1'000)->Arg(10'000)->Arg(100'000);
+}
+
+} // namespace
+
+BENCHMARK(bm_spawn_kill_churn)->Apply(entity_counts);
+BENCHMARK(bm_spawn_kill_churn_batch)->Apply(entity_counts);
+BENCHMARK(bm_add_remove_component)->Apply(entity_counts);
+BENCHMARK(bm_visit_components)->Apply(entity_counts);
+BENCHMARK(bm_tag_lookup_by_name)->Arg(1'000)->Arg(10'000);
+BENCHMARK(bm_tag_lookup_by_atom)->Arg(1'000)->Arg(10'000);
+BENCHMARK(bm_tag_lookup_by_entity)->Arg(1'000)->Arg(10'000);
+BENCHMARK(bm_checkpoint)->ArgName("entities")->Arg(1'000)->Arg(10'000);
+BENCHMARK(bm_checkpoint_restore)->ArgName("entities")->Arg(1'000)->Arg(10'000);
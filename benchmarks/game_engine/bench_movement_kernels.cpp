@@ -0,0 +1,158 @@
+#include <benchmark/benchmark.h>
+#include "components/transform.h"
+#include "kernels/movement_kernels.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace engn;
+
+namespace {
+
+using PatternType = cpnt::MovementPattern::PatternType;
+
+// A wave of enemies cycling through the four patterns, with spread timers
+std::vector<cpnt::MovementPattern> make_patterns(std::int64_t count) {
+    std::vector<cpnt::MovementPattern> patterns;
+    for (std::int64_t i = 0; i < count; i++) {
+        const auto k_type = static_cast<PatternType>(i % 4);
+        patterns.emplace_back(k_type, 120.0f, 40.0f, 0.5f + static_cast<float>(i % 7) * 0.1f, static_cast<float>(i % 100));
+    }
+    return patterns;
+}
+
+bool skip_unsupported(benchmark::State& state, simd::Isa isa) {
+    if (simd::movement_kernels(isa).isa == isa)
+        return false;
+    state.SkipWithError("instruction set not supported by this CPU");
+    return true;
+}
+
+// Per-entity switch with std::sin, as enemy_movement_system did before the kernels: args are (enemies)
+void bm_pattern_switch(benchmark::State& state) {
+    constexpr float k_two_pi = 2.0f * 3.14159f;
+    auto patterns = make_patterns(state.range(0));
+    std::vector<cpnt::Velocity> velocities(patterns.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < patterns.size(); i++) {
+            auto& pat = patterns[i];
+            auto& vel = velocities[i];
+            pat.timer += 0.016f;
+            vel.vx = -(pat.speed * 0.016f);
+
+            switch (pat.type) {
+                case PatternType::Sine: vel.vy = std::sin(pat.timer * pat.frequency * k_two_pi) * pat.amplitude; break;
+                case PatternType::ZigZag:
+                    vel.vy = (std::fmod(pat.timer * pat.frequency, 2.0f) < 1.0f) ? pat.amplitude : -pat.amplitude;
+                    break;
+                case PatternType::Straight: break;
+                case PatternType::Dive:
+                    vel.vy = std::sin(pat.timer * pat.frequency * k_two_pi) * (pat.amplitude * 2.0f);
+                    break;
+            }
+        }
+        benchmark::DoNotOptimize(velocities.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Same update, binned by pattern type and evaluated by the kernels of an instruction set
+void bm_pattern_batch(benchmark::State& state, simd::Isa isa) {
+    if (skip_unsupported(state, isa))
+        return;
+    auto const& kernels = simd::movement_kernels(isa);
+    auto patterns = make_patterns(state.range(0));
+    std::vector<cpnt::Velocity> velocities(patterns.size());
+
+    for (auto _ : state) {
+        simd::PatternBatch batch;
+        for (std::size_t i = 0; i < patterns.size(); i++) {
+            auto& pat = patterns[i];
+            pat.timer += 0.016f;
+            velocities[i].vx = -(pat.speed * 0.016f);
+
+            batch.add(pat, velocities[i]);
+            if (batch.full())
+                batch.flush(kernels);
+        }
+        batch.flush(kernels);
+        benchmark::DoNotOptimize(velocities.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Sine kernel alone over SoA buffers
+void bm_sine_wave(benchmark::State& state, simd::Isa isa) {
+    if (skip_unsupported(state, isa))
+        return;
+    auto const& kernels = simd::movement_kernels(isa);
+    const auto k_count = static_cast<std::size_t>(state.range(0));
+    std::vector<float> turns(k_count);
+    std::vector<float> amplitude(k_count, 40.0f);
+    std::vector<float> out(k_count);
+    for (std::size_t i = 0; i < k_count; i++)
+        turns[i] = static_cast<float>(i) * 0.013f;
+
+    for (auto _ : state) {
+        kernels.sine_wave(out.data(), turns.data(), amplitude.data(), k_count);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Position integration as bullet_system does it, in place over the AoS transforms
+void bm_integrate_transforms(benchmark::State& state) {
+    std::vector<cpnt::Transform> transforms(static_cast<std::size_t>(state.range(0)));
+    std::vector<cpnt::Velocity> velocities(transforms.size(), cpnt::Velocity{-120.0f, 15.0f});
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < transforms.size(); i++) {
+            transforms[i].x += velocities[i].vx * 0.016f;
+            transforms[i].y += velocities[i].vy * 0.016f;
+        }
+        benchmark::DoNotOptimize(transforms.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Same integration over SoA positions and velocities
+void bm_integrate(benchmark::State& state, simd::Isa isa) {
+    if (skip_unsupported(state, isa))
+        return;
+    auto const& kernels = simd::movement_kernels(isa);
+    const auto k_count = static_cast<std::size_t>(state.range(0));
+    std::vector<float> x(k_count);
+    std::vector<float> y(k_count);
+    std::vector<float> vx(k_count, -120.0f);
+    std::vector<float> vy(k_count, 15.0f);
+
+    for (auto _ : state) {
+        kernels.integrate(x.data(), vx.data(), 0.016f, k_count);
+        kernels.integrate(y.data(), vy.data(), 0.016f, k_count);
+        benchmark::DoNotOptimize(x.data());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void enemy_counts(benchmark::internal::Benchmark* bench) {
+    bench->ArgName("enemies")->Arg(1'000)->Arg(10'000);
+}
+
+} // namespace
+
+BENCHMARK(bm_pattern_switch)->Apply(enemy_counts);
+BENCHMARK_CAPTURE(bm_pattern_batch, scalar, simd::Isa::scalar)->Apply(enemy_counts);
+BENCHMARK_CAPTURE(bm_pattern_batch, sse2, simd::Isa::sse2)->Apply(enemy_counts);
+BENCHMARK_CAPTURE(bm_pattern_batch, avx2, simd::Isa::avx2)->Apply(enemy_counts);
+
+BENCHMARK_CAPTURE(bm_sine_wave, scalar, simd::Isa::scalar)->Apply(enemy_counts);
+BENCHMARK_CAPTURE(bm_sine_wave, sse2, simd::Isa::sse2)->Apply(enemy_counts);
+BENCHMARK_CAPTURE(bm_sine_wave, avx2, simd::Isa::avx2)->Apply(enemy_counts);
+
+BENCHMARK(bm_integrate_transforms)->Apply(enemy_counts);
+BENCHMARK_CAPTURE(bm_integrate, scalar, simd::Isa::scalar)->Apply(enemy_counts);
+BENCHMARK_CAPTURE(bm_integrate, sse2, simd::Isa::sse2)->Apply(enemy_counts);
+BENCHMARK_CAPTURE(bm_integrate, avx2, simd::Isa::avx2)->Apply(enemy_counts);
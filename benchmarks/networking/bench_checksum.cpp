@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+#include "rtp/checksum.h"
+#include "rtp/networking.h"
+
+#include <cstdint>
+#include <vector>
+
+using namespace net;
+
+namespace {
+
+std::vector<std::uint8_t> make_bytes(std::int64_t size) {
+    std::vector<std::uint8_t> bytes(static_cast<std::size_t>(size));
+    for (std::size_t i = 0; i < bytes.size(); i++) {
+        bytes[i] = static_cast<std::uint8_t>(i * 31 + 7);
+    }
+    return bytes;
+}
+
+template <typename Fn>
+void run(benchmark::State& state, Fn&& checksum_fn) {
+    const auto k_bytes = make_bytes(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(checksum_fn(std::span<const std::uint8_t>(k_bytes)));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+// The bit-at-a-time loop packet.cpp used before the checksum module: args are (bytes)
+void bm_crc16_bitwise(benchmark::State& state) {
+    run(state, [](auto bytes) { return checksum::crc16_bitwise(bytes); });
+}
+
+void bm_crc16_table(benchmark::State& state) {
+    run(state, [](auto bytes) { return checksum::crc16_table(bytes); });
+}
+
+void bm_crc16_slice8(benchmark::State& state) {
+    run(state, [](auto bytes) { return checksum::crc16_slice8(bytes); });
+}
+
+void bm_crc32c_software(benchmark::State& state) {
+    run(state, [](auto bytes) { return checksum::crc32c_update_software(bytes, checksum::k_crc32c_init); });
+}
+
+void bm_crc32c_hardware(benchmark::State& state) {
+    if (!checksum::has_hardware_crc32c()) {
+        state.SkipWithError("crc32 instruction not supported by this CPU");
+        return;
+    }
+    run(state, [](auto bytes) { return checksum::crc32c_update_hardware(bytes, checksum::k_crc32c_init); });
+}
+
+// Full packet decode, checksum included, with each algorithm flag: args are (bytes)
+void bm_packet_decode(benchmark::State& state, PacketFlag flags) {
+    Packet packet{};
+    packet.header.m_flags = static_cast<std::uint8_t>(flags);
+    packet.payload.resize(static_cast<std::size_t>(state.range(0)) - k_header_size);
+    const auto k_buffer = packet.to_buffer();
+    Packet decoded{};
+    decoded.payload.reserve(k_max_payload_size);
+
+    for (auto _ : state) {
+        Packet::decode(k_buffer, decoded);
+        benchmark::DoNotOptimize(decoded.header.m_checksum);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void packet_sizes(benchmark::internal::Benchmark* bench) {
+    bench->ArgName("bytes")->Arg(64)->Arg(512)->Arg(1024);
+}
+
+} // namespace
+
+BENCHMARK(bm_crc16_bitwise)->Apply(packet_sizes);
+BENCHMARK(bm_crc16_table)->Apply(packet_sizes);
+BENCHMARK(bm_crc16_slice8)->Apply(packet_sizes);
+BENCHMARK(bm_crc32c_software)->Apply(packet_sizes);
+BENCHMARK(bm_crc32c_hardware)->Apply(packet_sizes);
+
+BENCHMARK_CAPTURE(bm_packet_decode, crc16, PacketFlag::KReliable)->Apply(packet_sizes);
+BENCHMARK_CAPTURE(bm_packet_decode, crc32c, PacketFlag::KCrc32c)->Apply(packet_sizes);
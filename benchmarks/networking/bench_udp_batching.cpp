@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include "rtp/networking.h"
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+using namespace net;
+
+namespace {
+
+// One server tick over loopback: a delta per client is sent, then received, on a single thread.
+// args are (packets per tick); counters report syscalls on both ends and packets, per second.
+void bm_loopback_tick(benchmark::State& state, bool batched) {
+    if (batched && !k_batched_io_supported) {
+        state.SkipWithError("recvmmsg/sendmmsg not supported on this platform");
+        return;
+    }
+    const auto k_packets_per_tick = static_cast<std::size_t>(state.range(0));
+    asio::io_context context;
+    const DatagramBatchConfig k_batching{.enabled = batched};
+    auto sender = std::make_shared<UdpTransport>(context, 0, k_batching);
+    auto receiver = std::make_shared<UdpTransport>(context, 0, k_batching);
+    const asio::ip::udp::endpoint k_receiver_endpoint(asio::ip::address_v4::loopback(),
+                                                      receiver->local_endpoint().port());
+
+    std::size_t received = 0;
+    receiver->start([&received](const asio::error_code& ec, const Packet&, const asio::ip::udp::endpoint&) {
+        if (!ec) {
+            ++received;
+        }
+    });
+
+    Packet delta{};
+    delta.header.m_command = static_cast<std::uint8_t>(CommandId::KServerEntityState);
+    delta.payload.resize(256);
+
+    for (auto _ : state) {
+        received = 0;
+        sender->cork();
+        for (std::size_t i = 0; i < k_packets_per_tick; ++i) {
+            sender->async_send(delta, k_receiver_endpoint);
+        }
+        sender->flush();
+        while (received < k_packets_per_tick) {
+            if (context.run_one_for(std::chrono::seconds(1)) == 0) {
+                state.SkipWithError("datagrams lost on loopback");
+                return;
+            }
+        }
+    }
+
+    const TransportStats k_sent = sender->stats();
+    const TransportStats k_received = receiver->stats();
+    const auto k_syscalls = static_cast<double>(k_sent.send_syscalls + k_received.receive_syscalls);
+    state.counters["packets"] = benchmark::Counter(static_cast<double>(k_received.packets_received),
+                                                   benchmark::Counter::kIsRate);
+    state.counters["syscalls"] = benchmark::Counter(k_syscalls, benchmark::Counter::kIsRate);
+    state.counters["syscalls_per_packet"] = k_syscalls / static_cast<double>(k_received.packets_received);
+    sender->close();
+    receiver->close();
+}
+
+void packets_per_tick(benchmark::internal::Benchmark* bench) {
+    bench->ArgName("packets")->Arg(4)->Arg(16)->Arg(64);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(bm_loopback_tick, single, false)->Apply(packets_per_tick);
+BENCHMARK_CAPTURE(bm_loopback_tick, batched, true)->Apply(packets_per_tick);
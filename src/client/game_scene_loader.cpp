@@ -64,34 +64,46 @@ void load_game_scene(engn::EngineContext& engine_ctx) {
     registry.register_component<cpnt::UIStyle>();
     registry.register_component<cpnt::UIText>();
     registry.register_component<cpnt::UITransform>();
+    // Groups are created here: systems only look them up, which is safe from parallel systems
+    registry.group<cpnt::Transform, cpnt::Velocity, cpnt::Bullet>();
+    registry.group<cpnt::MovementPattern>(ecs::Get<cpnt::Transform, cpnt::Velocity>{});
 
     engine_ctx.add_system<>(sys::fetch_inputs);
     // engine_ctx.add_system<>(sys::log_inputs);
     engine_ctx.add_system<cpnt::UITransform>(sys::ui_hover);
     engine_ctx.add_system<cpnt::UIInteractable, cpnt::UIFocusable, cpnt::UINavigation>(sys::ui_navigation);
     engine_ctx.add_system<>(sys::ui_press);
-    engine_ctx.add_system<cpnt::Transform, cpnt::Velocity, cpnt::Bullet>(sys::bullet_system);
-    engine_ctx.add_system<cpnt::Transform, cpnt::Velocity, cpnt::BulletShooter>(sys::BulletShooter_system);
-
-    engine_ctx.add_system<cpnt::Transform, cpnt::Bullet, cpnt::Enemy, cpnt::Health, cpnt::Player, cpnt::Hitbox,
-        cpnt::BulletShooter, cpnt::Shooter, cpnt::Stats, cpnt::BossHitbox>(
-        sys::collision_system);
-    engine_ctx.add_system<cpnt::Transform, cpnt::MovementPattern, cpnt::Velocity>(sys::enemy_movement_system);
-    engine_ctx.add_system<cpnt::Transform, cpnt::Velocity, cpnt::Enemy, cpnt::Health, cpnt::Sprite>(sys::enemy_system);
-    engine_ctx.add_system<cpnt::Transform, cpnt::Explosion, cpnt::Sprite>(sys::explosion_system);
+    engine_ctx.add_system<engn::Write<cpnt::Transform>, cpnt::Velocity, cpnt::Bullet>(sys::bullet_system,
+                                                                              ecs::SystemPolicy::Parallel);
+    engine_ctx.add_system<engn::Write<cpnt::Transform>, cpnt::Velocity, cpnt::BulletShooter>(
+        sys::BulletShooter_system, ecs::SystemPolicy::Parallel);
+
+    engine_ctx.add_system<cpnt::Transform, cpnt::Bullet, cpnt::Enemy, engn::Write<cpnt::Health>, cpnt::Player,
+        cpnt::Hitbox, cpnt::BulletShooter, cpnt::Shooter, engn::Write<cpnt::Stats>, cpnt::BossHitbox>(
+        sys::collision_system, ecs::SystemPolicy::Parallel);
+    engine_ctx.add_system<cpnt::Transform, engn::Write<cpnt::MovementPattern>, engn::Write<cpnt::Velocity>>(
+        sys::enemy_movement_system, ecs::SystemPolicy::Parallel);
+    engine_ctx.add_system<engn::Write<cpnt::Transform>, cpnt::Velocity, cpnt::Enemy, engn::Write<cpnt::Health>,
+                          engn::Write<cpnt::Sprite>>(sys::enemy_system);
+    engine_ctx.add_system<cpnt::Transform, engn::Write<cpnt::Explosion>, engn::Write<cpnt::Sprite>>(
+        sys::explosion_system, ecs::SystemPolicy::MainThread);
     engine_ctx.add_system<cpnt::Transform, cpnt::Velocity, cpnt::Particle, cpnt::Bullet, cpnt::BulletShooter>(sys::particle_emission_system);
     engine_ctx.add_system<>(sys::resolve_player_input);
-    engine_ctx.add_system<cpnt::Transform, cpnt::Player, cpnt::Sprite, cpnt::Velocity, cpnt::Health>(
-        sys::player_control_system);
-    engine_ctx.add_system<cpnt::Transform, cpnt::Star>(sys::star_scroll_system);
-    engine_ctx.add_system<cpnt::Transform, cpnt::Sprite, cpnt::Star, cpnt::Velocity, cpnt::Particle, cpnt::Stats, cpnt::Boss>(
-        sys::render_system);
-    engine_ctx.add_system<cpnt::UITransform, cpnt::UIStyle, cpnt::UIInteractable>(sys::ui_background_renderer);
-    engine_ctx.add_system<cpnt::UITransform, cpnt::UIText, cpnt::UIStyle, cpnt::UIInteractable>(sys::ui_text_renderer);
+    engine_ctx.add_system<engn::Write<cpnt::Transform>, cpnt::Player, engn::Write<cpnt::Sprite>,
+                          engn::Write<cpnt::Velocity>, cpnt::Health>(sys::player_control_system,
+                                                                     ecs::SystemPolicy::MainThread);
+    engine_ctx.add_system<engn::Write<cpnt::Transform>, cpnt::Star>(sys::star_scroll_system, ecs::SystemPolicy::MainThread);
+    engine_ctx.add_system<cpnt::Transform, cpnt::Sprite, cpnt::Star, cpnt::Velocity, engn::Write<cpnt::Particle>,
+                          cpnt::Stats, cpnt::Boss>(sys::render_system, ecs::SystemPolicy::MainThread);
+    engine_ctx.add_system<cpnt::UITransform, cpnt::UIStyle, cpnt::UIInteractable>(sys::ui_background_renderer,
+                                                                                  ecs::SystemPolicy::MainThread);
+    engine_ctx.add_system<cpnt::UITransform, cpnt::UIText, cpnt::UIStyle, cpnt::UIInteractable, cpnt::UIInputField>(
+        sys::ui_text_renderer, ecs::SystemPolicy::MainThread);
     engine_ctx.add_system<>(handle_game_pause_inputs);
     engine_ctx.add_system<cpnt::Boss, cpnt::Transform, cpnt::Stats, cpnt::BossHitbox,
                           cpnt::Enemy, cpnt::Shooter, cpnt::BulletShooter, cpnt::Bullet, cpnt::Health>(sys::boss_system);
-    engine_ctx.add_system<cpnt::Transform, cpnt::MovementPattern, cpnt::Velocity, cpnt::Shooter, cpnt::Player>(sys::shooter_movement_system);
+    engine_ctx.add_system<cpnt::Transform, engn::Write<cpnt::MovementPattern>, engn::Write<cpnt::Velocity>, cpnt::Shooter,
+                          cpnt::Player>(sys::shooter_movement_system, ecs::SystemPolicy::Parallel);
     engine_ctx.add_system<cpnt::Transform, cpnt::Velocity, cpnt::Health, cpnt::Sprite, cpnt::Shooter, cpnt::Player>(sys::shooter_system);
     engine_ctx.add_system<cpnt::Stats>(sys::stat_system);
 
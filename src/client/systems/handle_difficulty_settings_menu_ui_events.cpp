@@ -66,7 +66,7 @@ void handle_difficulty_settings_menu_ui_events(engn::EngineContext& engine_ctx)
 
 static bool handle_ui_button_clicked(EngineContext& ctx, const evts::UIButtonClicked& evt) {
     const auto& tags = ctx.registry.get_tag_registry();
-    std::string tag_name = tags.get_tag_name(evt.tag);
+    std::string_view tag_name = tags.get_tag_name(evt.tag);
 
     if (tag_name == "back_button") {
         ctx.set_scene("main_menu");
@@ -17,7 +17,7 @@ void handle_game_ui_events(engn::EngineContext& engine_ctx) {
 static void handle_ui_button_clicked(EngineContext& ctx, const evts::UIButtonClicked& e,
                                      engn::evts::EventQueue<engn::evts::UIEvent> evts_queue) {
     const auto& tags = ctx.registry.get_tag_registry();
-    std::string tag_name = tags.get_tag_name(e.tag);
+    std::string_view tag_name = tags.get_tag_name(e.tag);
 
     if (tag_name == "back_button") {
         LOG_INFO("Back button clicked in connection menu");
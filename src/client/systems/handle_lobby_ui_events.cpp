@@ -11,6 +11,8 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <vector>
 
 using namespace engn;
@@ -67,14 +69,14 @@ LobbyState& get_lobby_state() {
     return s_g_lobby_state;
 }
 
-ecs::TagRegistry::TagId tag_id_or_invalid(const ecs::TagRegistry& tags, const char* name) {
+ecs::TagRegistry::TagId tag_id_or_invalid(const ecs::TagRegistry& tags, ecs::Atom name) {
     auto ent_opt = tags.get_entity(name);
     if (!ent_opt.has_value())
         return ecs::TagRegistry::k_invalid_tag_id;
     return tags.get_tag_id(name);
 }
 
-void set_navigation_for_tag(EngineContext& ctx, const char* tag, ecs::TagRegistry::TagId up,
+void set_navigation_for_tag(EngineContext& ctx, ecs::Atom tag, ecs::TagRegistry::TagId up,
                             ecs::TagRegistry::TagId down, ecs::TagRegistry::TagId left,
                             ecs::TagRegistry::TagId right) {
     auto ent_opt = ctx.registry.get_tag_registry().get_entity(tag);
@@ -489,7 +491,7 @@ void handle_lobby_ui_events(engn::EngineContext& engine_ctx) {
 static void handle_ui_button_clicked(EngineContext& ctx, const evts::UIButtonClicked& e,
                                      engn::evts::EventQueue<engn::evts::UIEvent> /*evts_queue*/) {
     const auto& tags = ctx.registry.get_tag_registry();
-    std::string tag_name = tags.get_tag_name(e.tag);
+    std::string_view tag_name = tags.get_tag_name(e.tag);
 
     if (tag_name == "connect_to_server_button") {
         handle_connect_button(ctx);
@@ -499,9 +501,9 @@ static void handle_ui_button_clicked(EngineContext& ctx, const evts::UIButtonCli
         handle_create_lobby_button(ctx);
     } else if (tag_name == "back_button") {
         ctx.set_scene("main_menu"); // Main menu scene
-    } else if (tag_name.find("lobby_item_") == 0) {
+    } else if (tag_name.starts_with("lobby_item_")) {
         // Extract lobby index from tag name
-        int lobby_index = std::stoi(tag_name.substr(k_tag_prefix_length));
+        int lobby_index = std::stoi(std::string{tag_name.substr(k_tag_prefix_length)});
         handle_lobby_item_clicked(ctx, lobby_index);
     }
 }
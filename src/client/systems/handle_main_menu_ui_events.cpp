@@ -15,7 +15,7 @@ void handle_main_menu_ui_events(engn::EngineContext& engine_ctx) {
 
 static void handle_ui_button_clicked(EngineContext& ctx, const evts::UIButtonClicked& evt) {
     const auto& tags = ctx.registry.get_tag_registry();
-    std::string tag_name = tags.get_tag_name(evt.tag);
+    std::string_view tag_name = tags.get_tag_name(evt.tag);
 
     if (tag_name == "play_solo_button") {
         ctx.set_scene("singleplayer_game"); // Navigate to singleplayer game scene
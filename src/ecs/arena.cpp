@@ -0,0 +1,89 @@
+#include "arena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+ecs::Arena::Arena(std::size_t capacity, std::pmr::memory_resource* upstream) : m_upstream(upstream) {
+    if (capacity != 0)
+        add_block(capacity);
+}
+
+ecs::Arena::~Arena() {
+    release_blocks();
+}
+
+void ecs::Arena::reset(std::size_t capacity) {
+    std::scoped_lock lock(m_mutex);
+    const std::size_t k_target = capacity != 0 ? capacity : this->capacity_unlocked();
+
+    m_offset = 0;
+    m_used = 0;
+    // A single block large enough is rewound, anything else is merged into one
+    if (m_blocks.size() == 1 && m_blocks.front().size >= k_target)
+        return;
+    release_blocks();
+    if (k_target != 0)
+        add_block(k_target);
+}
+
+std::size_t ecs::Arena::used() const noexcept {
+    std::scoped_lock lock(m_mutex);
+    return m_used;
+}
+
+std::size_t ecs::Arena::capacity() const noexcept {
+    std::scoped_lock lock(m_mutex);
+    return capacity_unlocked();
+}
+
+std::size_t ecs::Arena::upstream_allocations() const noexcept {
+    std::scoped_lock lock(m_mutex);
+    return m_upstream_allocations;
+}
+
+void* ecs::Arena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    std::scoped_lock lock(m_mutex);
+
+    for (;;) {
+        if (!m_blocks.empty()) {
+            Block const& block = m_blocks.back();
+            const auto k_base = reinterpret_cast<std::uintptr_t>(block.data); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            const std::size_t k_start = ((k_base + m_offset + alignment - 1) & ~(alignment - 1)) - k_base;
+            if (k_start <= block.size && bytes <= block.size - k_start) {
+                m_used += k_start + bytes - m_offset;
+                m_offset = k_start + bytes;
+                return block.data + k_start; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            }
+        }
+        const std::size_t k_previous = m_blocks.empty() ? k_default_block_size / 2 : m_blocks.back().size;
+        add_block(std::max(k_previous * 2, bytes + alignment));
+    }
+}
+
+void ecs::Arena::do_deallocate(void* /*p*/, std::size_t /*bytes*/, std::size_t /*alignment*/) {
+    // Memory is given back all at once by reset
+}
+
+bool ecs::Arena::do_is_equal(std::pmr::memory_resource const& other) const noexcept {
+    return this == &other;
+}
+
+std::size_t ecs::Arena::capacity_unlocked() const noexcept {
+    std::size_t total = 0;
+    for (auto const& block : m_blocks)
+        total += block.size;
+    return total;
+}
+
+void ecs::Arena::add_block(std::size_t size) {
+    m_blocks.push_back(Block{static_cast<std::byte*>(m_upstream->allocate(size, alignof(std::max_align_t))), size});
+    m_offset = 0;
+    m_upstream_allocations++;
+}
+
+void ecs::Arena::release_blocks() noexcept {
+    for (auto const& block : m_blocks)
+        m_upstream->deallocate(block.data, block.size, alignof(std::max_align_t));
+    m_blocks.clear();
+    m_offset = 0;
+}
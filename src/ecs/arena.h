@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+namespace ecs {
+
+/// Monotonic memory resource backing the storage of a registry for the lifetime of a scene.
+///
+/// Allocations are bumped out of blocks obtained from an upstream resource; deallocations
+/// are no-ops. `reset` rewinds the arena in one go once everything allocated from it is
+/// gone, keeping a single block large enough for the next scene so that its load does not
+/// go back to the upstream resource. Allocation is thread-safe.
+class Arena final : public std::pmr::memory_resource {
+  public:
+    /// Size of the first block when no capacity is requested.
+    static constexpr std::size_t k_default_block_size = 64 * 1024;
+
+    /// @param capacity Size of the first block, allocated right away when not 0.
+    /// @param upstream Resource blocks are taken from.
+    explicit Arena(std::size_t capacity = 0, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+    ~Arena() override;
+
+    Arena(Arena const&) = delete;
+    Arena& operator=(Arena const&) = delete;
+    Arena(Arena&&) = delete;
+    Arena& operator=(Arena&&) = delete;
+
+    /// Drop every allocation. Nothing allocated from the arena may be used afterwards.
+    /// @param capacity Bytes the next user is expected to need, 0 for the current capacity.
+    /// The arena is left with a single block of at least that size.
+    void reset(std::size_t capacity = 0);
+
+    /// @return Bytes handed out since the last reset, alignment padding included.
+    std::size_t used() const noexcept;
+
+    /// @return Bytes held in blocks.
+    std::size_t capacity() const noexcept;
+
+    /// @return Number of blocks taken from the upstream resource since construction.
+    std::size_t upstream_allocations() const noexcept;
+
+  private:
+    struct Block {
+        std::byte* data;
+        std::size_t size;
+    };
+
+    std::pmr::memory_resource* m_upstream;
+    std::vector<Block> m_blocks;
+    // bump offset in the last block
+    std::size_t m_offset{0};
+    std::size_t m_used{0};
+    std::size_t m_upstream_allocations{0};
+    mutable std::mutex m_mutex;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override;
+
+    std::size_t capacity_unlocked() const noexcept;
+    void add_block(std::size_t size);
+    void release_blocks() noexcept;
+};
+
+} // namespace ecs
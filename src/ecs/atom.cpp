@@ -0,0 +1,71 @@
+#include "atom.h"
+
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+
+namespace {
+constexpr std::size_t k_storage_block_size = 16 * 1024;
+} // namespace
+
+ecs::Atom::Atom(std::string_view str) : Atom(StringInterner::instance().intern(str)) {}
+
+ecs::Atom::Atom(char const* str) : Atom(std::string_view{str}) {}
+
+ecs::Atom::Atom(std::string const& str) : Atom(std::string_view{str}) {}
+
+std::string_view ecs::Atom::str() const noexcept {
+    return StringInterner::instance().str(*this);
+}
+
+ecs::StringInterner& ecs::StringInterner::instance() {
+    // Never destroyed: atoms may be resolved while other statics are torn down
+    static StringInterner* s_instance = new StringInterner(); // NOLINT(cppcoreguidelines-owning-memory)
+    return *s_instance;
+}
+
+ecs::StringInterner::StringInterner() : m_storage(k_storage_block_size) {
+    m_strings.emplace_back("");
+    m_ids.emplace(m_strings.front(), 0);
+}
+
+ecs::Atom ecs::StringInterner::intern(std::string_view str) {
+    {
+        std::shared_lock lock(m_mutex);
+        auto it = m_ids.find(str);
+        if (it != m_ids.end())
+            return Atom{it->second};
+    }
+
+    std::unique_lock lock(m_mutex);
+    // Another thread may have interned it between both locks
+    auto it = m_ids.find(str);
+    if (it != m_ids.end())
+        return Atom{it->second};
+    if (m_strings.size() > std::numeric_limits<Atom::ValueType>::max())
+        throw std::length_error("StringInterner: atom ids exhausted");
+
+    auto* data = static_cast<char*>(m_storage.allocate(str.size() + 1, alignof(char)));
+    std::memcpy(data, str.data(), str.size());
+    data[str.size()] = '\0'; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    const auto k_id = static_cast<Atom::ValueType>(m_strings.size());
+    m_strings.emplace_back(data, str.size());
+    m_ids.emplace(m_strings.back(), k_id);
+    return Atom{k_id};
+}
+
+std::string_view ecs::StringInterner::str(Atom atom) const noexcept {
+    std::shared_lock lock(m_mutex);
+    return atom.m_value < m_strings.size() ? m_strings[atom.m_value] : std::string_view{};
+}
+
+std::size_t ecs::StringInterner::size() const noexcept {
+    std::shared_lock lock(m_mutex);
+    return m_strings.size();
+}
+
+std::size_t ecs::StringInterner::storage_capacity() const noexcept {
+    return m_storage.capacity();
+}
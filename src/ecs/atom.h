@@ -0,0 +1,109 @@
+#pragma once
+
+#include "arena.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ecs {
+
+/// Handle of an interned string: a 32-bit id compared and hashed as an integer.
+///
+/// Equal strings always yield the same atom. The string behind an atom is stored once for
+/// the lifetime of the process, so the view returned by `str` never dangles. Building an
+/// atom from a string interns it (a hash lookup); hot paths should keep atoms around.
+class Atom {
+  public:
+    /// Integer type atoms are stored as.
+    using ValueType = std::uint32_t;
+
+    /// Default-construct the atom of the empty string.
+    constexpr Atom() noexcept = default;
+
+    /// Intern a string.
+    /// @param str The string to intern.
+    Atom(std::string_view str);
+    Atom(char const* str);
+    Atom(std::string const& str);
+
+    /// Get the interned string.
+    /// @return A view valid for the lifetime of the process, null-terminated.
+    std::string_view str() const noexcept;
+
+    /// Get the id of this atom.
+    /// @return The id, 0 for the empty string.
+    constexpr ValueType value() const noexcept { return m_value; }
+
+    /// @return True for the atom of the empty string.
+    constexpr bool empty() const noexcept { return m_value == 0; }
+
+    /// Equality comparison operator: same string, same atom.
+    constexpr bool operator==(Atom const& other) const noexcept = default;
+
+  private:
+    constexpr explicit Atom(ValueType value) noexcept : m_value(value) {}
+
+    ValueType m_value{0};
+
+    friend class StringInterner;
+};
+
+/// Process-wide table of the interned strings, backed by an arena that is never reset.
+/// Thread-safe: lookups take a shared lock, only new strings take it exclusively.
+class StringInterner {
+  public:
+    /// @return The interner of the process.
+    static StringInterner& instance();
+
+    StringInterner(StringInterner const&) = delete;
+    StringInterner& operator=(StringInterner const&) = delete;
+    StringInterner(StringInterner&&) = delete;
+    StringInterner& operator=(StringInterner&&) = delete;
+
+    /// Get the atom of a string, storing the string if it is new.
+    /// @param str The string to intern.
+    /// @return The atom of `str`.
+    Atom intern(std::string_view str);
+
+    /// Get the string of an atom.
+    /// @param atom An atom produced by this interner.
+    /// @return The interned string.
+    std::string_view str(Atom atom) const noexcept;
+
+    /// @return Number of distinct strings interned, the empty string included.
+    std::size_t size() const noexcept;
+
+    /// @return Bytes of string storage taken from the heap.
+    std::size_t storage_capacity() const noexcept;
+
+  private:
+    StringInterner();
+    ~StringInterner() = default;
+
+    Arena m_storage;
+    std::vector<std::string_view> m_strings;
+    std::unordered_map<std::string_view, Atom::ValueType> m_ids;
+    mutable std::shared_mutex m_mutex;
+};
+
+} // namespace ecs
+
+template <>
+struct std::hash<ecs::Atom> {
+    std::size_t operator()(const ecs::Atom& atom) const noexcept {
+        return std::hash<ecs::Atom::ValueType>{}(atom.value());
+    }
+};
+
+template <> struct std::formatter<ecs::Atom> : std::formatter<std::string_view> {
+    auto format(const ecs::Atom& atom, auto& ctx) const {
+        return std::formatter<std::string_view>::format(atom.str(), ctx);
+    }
+};
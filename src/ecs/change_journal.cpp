@@ -0,0 +1,64 @@
+#include "change_journal.h"
+
+#include <algorithm>
+
+ecs::ChangeJournal::ChangeJournal(std::pmr::memory_resource* resource) : m_entries(resource), m_removed(resource) {}
+
+void ecs::ChangeJournal::record(Version version, Entity e, Op op, ComponentId component) {
+    if (version != m_removed_version) {
+        m_removed.clear();
+        m_removed_version = version;
+    }
+
+    // Removed, added back and removed again within a version: the first removal says it all
+    if (op == Op::component_removed && !m_removed.insert(RemovedKey{e.handle(), component}).second)
+        return;
+    m_entries.push_back(Entry{version, e, component, op});
+}
+
+void ecs::ChangeJournal::reserve(std::size_t count) {
+    // Keeps the geometric growth when batches are reserved one after another
+    if (m_entries.size() + count > m_entries.capacity())
+        m_entries.reserve(std::max(m_entries.size() + count, m_entries.capacity() * 2));
+}
+
+std::span<ecs::ChangeJournal::Entry const> ecs::ChangeJournal::since(Version version) const noexcept {
+    auto first = std::upper_bound(m_entries.begin() + static_cast<std::ptrdiff_t>(m_head), m_entries.end(), version,
+        [](Version v, Entry const& entry) { return v < entry.version; });
+    return {first, m_entries.end()};
+}
+
+void ecs::ChangeJournal::trim(Version version) {
+    auto first = since(version);
+    m_head = m_entries.size() - first.size();
+
+    if (m_head == m_entries.size()) {
+        m_entries.clear();
+        m_head = 0;
+    } else if (m_head >= first.size()) {
+        m_entries.erase(m_entries.begin(), m_entries.begin() + static_cast<std::ptrdiff_t>(m_head));
+        m_head = 0;
+    }
+}
+
+void ecs::ChangeJournal::clear() noexcept {
+    m_entries.clear();
+    m_head = 0;
+    m_removed.clear();
+}
+
+std::size_t ecs::ChangeJournal::size() const noexcept {
+    return m_entries.size() - m_head;
+}
+
+std::size_t ecs::ChangeJournal::capacity() const noexcept {
+    return m_entries.capacity() - m_head;
+}
+
+std::size_t ecs::ChangeJournal::memory_usage() const noexcept {
+    return m_entries.capacity() * sizeof(Entry);
+}
+
+bool ecs::ChangeJournal::empty() const noexcept {
+    return size() == 0;
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "component_pool.h"
+#include "entity.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory_resource>
+#include <span>
+#include <unordered_set>
+#include <vector>
+
+namespace ecs {
+
+/// Append-only, version-ordered log of the structural changes made to a registry.
+///
+/// Each entry records one creation or destruction, tagged with the version it happened at.
+/// Versions only grow, so "everything that happened since version V" is a binary search followed
+/// by a range scan proportional to the number of changes. Component values are not journaled:
+/// pools stamp them with the version they were written at instead.
+/// Repeated `component_removed` records of the same component within one version are coalesced
+/// into the first one.
+/// Acknowledged entries are dropped from the front with `trim`.
+class ChangeJournal {
+  public:
+    using Version = ecs::Version;
+
+    /// Kind of change recorded by an entry.
+    enum class Op : std::uint8_t {
+        entity_created,
+        entity_destroyed,
+        component_removed,
+    };
+
+    /// Component id of the entries that are not about a component.
+    static constexpr ComponentId k_no_component = std::numeric_limits<ComponentId>::max();
+
+    struct Entry {
+        Version version;
+        Entity entity;
+        ComponentId component;
+        Op op;
+    };
+
+    ChangeJournal() = default;
+
+    /// @param resource Memory resource backing the entries.
+    explicit ChangeJournal(std::pmr::memory_resource* resource);
+
+    /// Record a change. `version` must not be lower than the one of the last recorded entry.
+    /// @param version Version the change happened at.
+    /// @param e Entity the change is about.
+    /// @param op Kind of change.
+    /// @param component Changed component, `k_no_component` for entity changes.
+    void record(Version version, Entity e, Op op, ComponentId component = k_no_component);
+
+    /// Reserve room for `count` more entries.
+    /// @param count Number of entries about to be recorded.
+    void reserve(std::size_t count);
+
+    /// Get the entries recorded after a version, oldest first.
+    /// The span is invalidated by the next `record` or `trim`.
+    /// @param version Last version already known by the caller.
+    /// @return Entries whose version is strictly greater than `version`.
+    std::span<Entry const> since(Version version) const noexcept;
+
+    /// Drop the entries that every reader already knows about.
+    /// @param version Entries up to and including this version are discarded.
+    void trim(Version version);
+
+    /// Drop every entry.
+    void clear() noexcept;
+
+    /// @return Number of entries currently held.
+    std::size_t size() const noexcept;
+
+    /// @return Number of entries held before the storage grows.
+    std::size_t capacity() const noexcept;
+
+    /// @return Bytes held by the entries, trimmed ones not yet reclaimed included.
+    std::size_t memory_usage() const noexcept;
+
+    /// @return `true` if no entry is held.
+    bool empty() const noexcept;
+
+  private:
+    // entries live in [m_head, end), the trimmed prefix is reclaimed once it outweighs them
+    std::pmr::vector<Entry> m_entries;
+    std::size_t m_head{0};
+
+    struct RemovedKey {
+        std::uint64_t handle;
+        ComponentId component;
+
+        bool operator==(RemovedKey const& other) const noexcept = default;
+    };
+
+    struct RemovedKeyHash {
+        std::size_t operator()(RemovedKey const& key) const noexcept {
+            return std::hash<std::uint64_t>{}(key.handle) ^ (std::hash<ComponentId>{}(key.component) << 1);
+        }
+    };
+
+    // components already recorded as removed during `m_removed_version`
+    std::pmr::unordered_set<RemovedKey, RemovedKeyHash> m_removed;
+    Version m_removed_version{0};
+};
+
+} // namespace ecs
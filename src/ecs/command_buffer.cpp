@@ -0,0 +1,138 @@
+#include "command_buffer.h"
+
+#include "registry.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <unordered_set>
+#include <utility>
+
+void ecs::CommandBuffer::kill(Entity e) {
+    m_kills.push_back(e);
+}
+
+void ecs::CommandBuffer::on_spawned(Spawned e, SpawnCallback callback) {
+    m_callbacks.emplace_back(e.m_slot, std::move(callback));
+}
+
+bool ecs::CommandBuffer::empty() const noexcept {
+    auto queue_empty = [](auto const& queue) { return !queue || queue->empty(); };
+
+    return m_spawn_count == 0 && m_kills.empty() && m_callbacks.empty() &&
+           std::all_of(m_adds.begin(), m_adds.end(), queue_empty) &&
+           std::all_of(m_removes.begin(), m_removes.end(), queue_empty);
+}
+
+void ecs::CommandBuffer::apply(Registry& registry) {
+    // Taken out first: callbacks may record commands for a later apply
+    auto callbacks = std::exchange(m_callbacks, {});
+    auto kills = std::exchange(m_kills, {});
+    std::vector<Entity> spawned;
+    spawned.reserve(m_spawn_count);
+    for (std::size_t i = 0; i < m_spawn_count; i++)
+        spawned.push_back(registry.spawn_entity());
+    m_spawn_count = 0;
+
+    for (auto& queue : m_adds)
+        if (queue)
+            queue->apply(registry, spawned);
+
+    for (auto& [slot, callback] : callbacks)
+        callback(registry, spawned[slot]);
+
+    for (auto& queue : m_removes)
+        if (queue)
+            queue->apply(registry, spawned);
+
+    std::unordered_set<Entity> seen;
+    std::erase_if(kills, [&seen](Entity e) { return !seen.insert(e).second; });
+    registry.kill_entities(kills);
+}
+
+void ecs::CommandBuffer::clear() noexcept {
+    for (auto& queue : m_adds)
+        if (queue)
+            queue->clear();
+    for (auto& queue : m_removes)
+        if (queue)
+            queue->clear();
+    m_spawn_count = 0;
+    m_callbacks.clear();
+    m_kills.clear();
+}
+
+ecs::Entity ecs::CommandBuffer::resolve(Target const& target, std::vector<Entity> const& spawned) noexcept {
+    return target.spawned ? spawned[target.slot] : target.entity;
+}
+
+namespace {
+std::atomic<std::uint64_t> s_next_epoch{1};
+
+thread_local ecs::CommandOrder t_order;
+
+// Last buffer handed out to this thread; buffers live as long as their owner
+struct LocalBuffer {
+    ecs::ThreadCommandBuffers const* owner{nullptr};
+    std::uint64_t epoch{0};
+    ecs::CommandOrder order;
+    ecs::CommandBuffer* buffer{nullptr};
+};
+thread_local LocalBuffer t_local;
+} // namespace
+
+ecs::CommandOrderScope::CommandOrderScope(CommandOrder order) noexcept : m_previous(std::exchange(t_order, order)) {}
+
+ecs::CommandOrderScope::~CommandOrderScope() {
+    t_order = m_previous;
+}
+
+ecs::CommandOrder ecs::CommandOrderScope::current() noexcept {
+    return t_order;
+}
+
+void ecs::CommandOrderScope::advance(std::size_t steps) noexcept {
+    t_order.step += steps;
+}
+
+ecs::ThreadCommandBuffers::ThreadCommandBuffers() : m_epoch(s_next_epoch.fetch_add(1, std::memory_order_relaxed)) {}
+
+ecs::CommandBuffer& ecs::ThreadCommandBuffers::local() {
+    const CommandOrder k_order = t_order;
+    if (t_local.owner == this && t_local.epoch == m_epoch && t_local.order == k_order)
+        return *t_local.buffer;
+
+    const auto k_id = std::this_thread::get_id();
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = std::find_if(m_buffers.begin(), m_buffers.end(),
+                           [&](Entry const& entry) { return entry.thread == k_id && entry.order == k_order; });
+    if (it == m_buffers.end()) {
+        m_buffers.push_back(Entry{k_order, k_id, std::make_unique<CommandBuffer>()});
+        it = std::prev(m_buffers.end());
+    }
+    t_local = LocalBuffer{this, m_epoch, k_order, it->buffer.get()};
+    return *it->buffer;
+}
+
+void ecs::ThreadCommandBuffers::apply(Registry& registry) {
+    std::vector<std::pair<CommandOrder, CommandBuffer*>> buffers;
+    {
+        // Applied outside the lock: spawn callbacks may record new commands
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& entry : m_buffers)
+            if (!entry.buffer->empty())
+                buffers.emplace_back(entry.order, entry.buffer.get());
+    }
+    std::stable_sort(buffers.begin(), buffers.end(),
+                     [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+    for (auto& [order, buffer] : buffers)
+        buffer->apply(registry);
+}
+
+void ecs::ThreadCommandBuffers::clear() noexcept {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto& entry : m_buffers)
+        entry.buffer->clear();
+}
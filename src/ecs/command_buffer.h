@@ -0,0 +1,209 @@
+#pragma once
+
+#include "component_pool.h"
+#include "entity.h"
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ecs {
+
+class Registry;
+
+/// Records structural changes (spawn, add, remove, kill) to apply them later in one batch.
+///
+/// Recording never touches the registry, so it is safe while pools are being iterated or from
+/// a parallel system. `apply` runs the commands in phases: spawns, then additions grouped by
+/// component type, then spawn callbacks, then removals grouped by component type, then kills
+/// (each entity killed once). Within a component type, commands keep their recording order.
+/// Commands aimed at an entity that died before `apply` are dropped.
+class CommandBuffer {
+  public:
+    /// Entity spawned by the buffer. Its id is only known once the buffer is applied.
+    class Spawned {
+      public:
+        Spawned() = default;
+
+      private:
+        explicit Spawned(std::size_t slot) noexcept : m_slot(slot) {}
+
+        std::size_t m_slot{0};
+
+        friend class CommandBuffer;
+    };
+
+    /// Called once a spawned entity exists, after its components were added.
+    using SpawnCallback = std::function<void(Registry&, Entity)>;
+
+    CommandBuffer() = default;
+    ~CommandBuffer() = default;
+
+    CommandBuffer(CommandBuffer const&) = delete;
+    CommandBuffer& operator=(CommandBuffer const&) = delete;
+    CommandBuffer(CommandBuffer&&) noexcept = default;
+    CommandBuffer& operator=(CommandBuffer&&) noexcept = default;
+
+    /// Record the creation of an entity.
+    /// @param components Components the entity is created with.
+    /// @return Handle to add more components or callbacks to the entity.
+    template <typename... TComponents> Spawned spawn(TComponents&&... components);
+
+    /// Record the addition (or replacement) of a component.
+    /// @param to Target entity.
+    /// @param component Component to add.
+    template <typename TComponent> void add(Entity to, TComponent&& component);
+
+    /// Record the addition of a component to an entity spawned by this buffer.
+    /// @param to Spawned entity.
+    /// @param component Component to add.
+    template <typename TComponent> void add(Spawned to, TComponent&& component);
+
+    /// Record the removal of a component.
+    /// @tparam TComponent Component type to remove.
+    /// @param from Target entity.
+    template <typename TComponent> void remove(Entity from);
+
+    /// Record the destruction of an entity. Killing an entity several times kills it once.
+    /// @param e Entity to destroy.
+    void kill(Entity e);
+
+    /// Run a callback once a spawned entity exists (eg. to store its id in a component).
+    /// @param e Spawned entity.
+    /// @param callback Callable receiving the registry and the new entity.
+    void on_spawned(Spawned e, SpawnCallback callback);
+
+    /// Check whether nothing has been recorded.
+    bool empty() const noexcept;
+
+    /// Apply every recorded command to the registry, then forget them.
+    /// @param registry Registry to modify.
+    void apply(Registry& registry);
+
+    /// Forget every recorded command.
+    void clear() noexcept;
+
+  private:
+    // Entity a command targets: an existing one, or the slot of one spawned by the buffer
+    struct Target {
+        Entity entity;
+        std::size_t slot;
+        bool spawned;
+    };
+
+    class IQueue {
+      public:
+        IQueue() = default;
+        virtual ~IQueue() = default;
+
+        IQueue(IQueue const&) = delete;
+        IQueue& operator=(IQueue const&) = delete;
+        IQueue(IQueue&&) = delete;
+        IQueue& operator=(IQueue&&) = delete;
+
+        virtual void apply(Registry& registry, std::vector<Entity> const& spawned) = 0;
+        virtual bool empty() const noexcept = 0;
+        virtual void clear() noexcept = 0;
+    };
+
+    template <typename TComponent> class AddQueue;
+    template <typename TComponent> class RemoveQueue;
+
+    // Per component id, so that applying them walks one pool at a time
+    std::vector<std::unique_ptr<IQueue>> m_adds;
+    std::vector<std::unique_ptr<IQueue>> m_removes;
+
+    std::size_t m_spawn_count{0};
+    std::vector<std::pair<std::size_t, SpawnCallback>> m_callbacks;
+    std::vector<Entity> m_kills;
+
+    template <typename TComponent> void add_to(Target to, TComponent&& component);
+
+    template <template <typename> class TQueue, typename TComponent>
+    TQueue<TComponent>& queue(std::vector<std::unique_ptr<IQueue>>& queues);
+
+    static Entity resolve(Target const& target, std::vector<Entity> const& spawned) noexcept;
+};
+
+/// Place of the commands recorded by a thread in the apply order of `ThreadCommandBuffers`.
+///
+/// The scheduler tags each system with its registration index (0 stays for commands recorded
+/// outside any system) and `ThreadPool::parallel_for` tags each chunk with a step following the
+/// ones the calling thread used so far, so that applying in order replays a sequential run.
+struct CommandOrder {
+    std::size_t system{0};
+    std::size_t step{0};
+
+    auto operator<=>(CommandOrder const&) const noexcept = default;
+};
+
+/// Tag the commands the calling thread records while the scope lives.
+class CommandOrderScope {
+  public:
+    /// @param order Order of the commands recorded from now on.
+    explicit CommandOrderScope(CommandOrder order) noexcept;
+    /// Restore the order the thread had before the scope.
+    ~CommandOrderScope();
+
+    CommandOrderScope(CommandOrderScope const&) = delete;
+    CommandOrderScope& operator=(CommandOrderScope const&) = delete;
+    CommandOrderScope(CommandOrderScope&&) = delete;
+    CommandOrderScope& operator=(CommandOrderScope&&) = delete;
+
+    /// @return Order of the commands the calling thread records now.
+    static CommandOrder current() noexcept;
+
+    /// Move the calling thread past the steps handed out to the chunks of a parallel loop.
+    /// @param steps Number of steps to skip.
+    static void advance(std::size_t steps) noexcept;
+
+  private:
+    CommandOrder m_previous;
+};
+
+/// CommandBuffers of the recording threads, applied together at a sync point.
+///
+/// Each thread gets one buffer per `CommandOrder` it records under, and `apply` runs them by
+/// order: the outcome does not depend on how the systems and their loops were scheduled.
+/// Buffers sharing an order (loops nested in a parallel chunk) keep the order of their first use.
+class ThreadCommandBuffers {
+  public:
+    ThreadCommandBuffers();
+
+    /// Get the buffer of the calling thread for its current `CommandOrder`, creating it on first use.
+    /// Each thread caches its last lookup, so repeated calls skip the lock.
+    /// @return A buffer only the calling thread records into.
+    CommandBuffer& local();
+
+    /// Apply every buffer, by `CommandOrder`.
+    /// No thread may be recording meanwhile.
+    /// @param registry Registry to modify.
+    void apply(Registry& registry);
+
+    /// Forget the commands of every thread.
+    void clear() noexcept;
+
+  private:
+    struct Entry {
+        CommandOrder order;
+        std::thread::id thread;
+        std::unique_ptr<CommandBuffer> buffer;
+    };
+
+    std::mutex m_mutex;
+    // in order of first use, which breaks the ties between equal orders
+    std::vector<Entry> m_buffers;
+    // Unique per instance: a thread's cached lookup must not match a later instance at the same address
+    std::uint64_t m_epoch;
+};
+
+} // namespace ecs
+
+#include "command_buffer.tcc"
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "command_buffer.h"
+#include "registry.h"
+
+namespace ecs {
+
+template <typename TComponent> class CommandBuffer::AddQueue final : public IQueue {
+  public:
+    void push(Target to, TComponent&& component) { m_items.emplace_back(to, std::move(component)); }
+
+    void apply(Registry& registry, std::vector<Entity> const& spawned) override {
+        for (auto& [target, component] : m_items)
+            if (auto e = resolve(target, spawned); registry.alive(e))
+                registry.add_component(e, std::move(component));
+        m_items.clear();
+    }
+
+    bool empty() const noexcept override { return m_items.empty(); }
+    void clear() noexcept override { m_items.clear(); }
+
+  private:
+    std::vector<std::pair<Target, TComponent>> m_items;
+};
+
+template <typename TComponent> class CommandBuffer::RemoveQueue final : public IQueue {
+  public:
+    void push(Entity from) { m_items.push_back(from); }
+
+    void apply(Registry& registry, std::vector<Entity> const& /*spawned*/) override {
+        for (auto e : m_items)
+            if (registry.has_component<TComponent>(e))
+                registry.remove_component<TComponent>(e);
+        m_items.clear();
+    }
+
+    bool empty() const noexcept override { return m_items.empty(); }
+    void clear() noexcept override { m_items.clear(); }
+
+  private:
+    std::vector<Entity> m_items;
+};
+
+template <typename... TComponents> CommandBuffer::Spawned CommandBuffer::spawn(TComponents&&... components) {
+    Spawned e(m_spawn_count++);
+    (add(e, std::forward<TComponents>(components)), ...);
+    return e;
+}
+
+template <typename TComponent> void CommandBuffer::add(Entity to, TComponent&& component) {
+    add_to(Target{to, 0, false}, std::forward<TComponent>(component));
+}
+
+template <typename TComponent> void CommandBuffer::add(Spawned to, TComponent&& component) {
+    add_to(Target{Entity{}, to.m_slot, true}, std::forward<TComponent>(component));
+}
+
+template <typename TComponent> void CommandBuffer::remove(Entity from) {
+    queue<RemoveQueue, TComponent>(m_removes).push(from);
+}
+
+template <typename TComponent> void CommandBuffer::add_to(Target to, TComponent&& component) {
+    using ComponentType = std::remove_cvref_t<TComponent>;
+
+    queue<AddQueue, ComponentType>(m_adds).push(to, ComponentType(std::forward<TComponent>(component)));
+}
+
+template <template <typename> class TQueue, typename TComponent>
+TQueue<TComponent>& CommandBuffer::queue(std::vector<std::unique_ptr<IQueue>>& queues) {
+    const auto k_id = component_id<TComponent>();
+
+    if (k_id >= queues.size())
+        queues.resize(k_id + 1);
+    if (!queues[k_id])
+        queues[k_id] = std::make_unique<TQueue<TComponent>>();
+    return static_cast<TQueue<TComponent>&>(*queues[k_id]);
+}
+
+} // namespace ecs
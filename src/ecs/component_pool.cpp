@@ -0,0 +1,14 @@
+#include "component_pool.h"
+
+#include <atomic>
+
+ecs::ComponentId ecs::detail::next_component_id() noexcept {
+    static std::atomic<ComponentId> s_counter{0};
+    return s_counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+ecs::ComponentObservers& ecs::IComponentPool::observe() {
+    if (!m_observers)
+        m_observers = std::make_unique<ComponentObservers>();
+    return *m_observers;
+}
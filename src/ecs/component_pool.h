@@ -0,0 +1,243 @@
+#pragma once
+
+#include "observer.h"
+#include "sparse_array.h"
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <typeindex>
+#include <vector>
+
+namespace ecs {
+
+/// Dense identifier assigned to each component type (its "family").
+using ComponentId = std::size_t;
+
+namespace detail {
+
+/// Hand out the next unused component id.
+/// @return A process-wide unique, monotonically increasing id.
+ComponentId next_component_id() noexcept;
+
+} // namespace detail
+
+/// Get the id of the component family `TComponent` belongs to.
+/// The id is drawn once per type from a static counter, so every registry agrees on it
+/// and it can be used to index flat per-component tables.
+/// @tparam TComponent Component type (cv/ref qualifiers are ignored).
+/// @return The component id of `TComponent`.
+template <typename TComponent> ComponentId component_id() noexcept {
+    if constexpr (!std::is_same_v<TComponent, std::remove_cvref_t<TComponent>>) {
+        return component_id<std::remove_cvref_t<TComponent>>();
+    } else {
+        static const ComponentId s_id = detail::next_component_id();
+        return s_id;
+    }
+}
+
+/// Type-erased undo log of a pool, see `IComponentPool::checkpoint`.
+class PoolUndo {
+  public:
+    PoolUndo() = default;
+    virtual ~PoolUndo() = default;
+
+    PoolUndo(PoolUndo const&) = delete;
+    PoolUndo& operator=(PoolUndo const&) = delete;
+    PoolUndo(PoolUndo&&) = delete;
+    PoolUndo& operator=(PoolUndo&&) = delete;
+};
+
+/// Type-erased owner of a component SparseArray.
+/// Lets the registry run per-entity operations on every pool without knowing their types.
+class IComponentPool {
+  public:
+    IComponentPool() = default;
+    virtual ~IComponentPool() = default;
+
+    IComponentPool(IComponentPool const&) = delete;
+    IComponentPool& operator=(IComponentPool const&) = delete;
+    IComponentPool(IComponentPool&&) = delete;
+    IComponentPool& operator=(IComponentPool&&) = delete;
+
+    /// Check whether a component is stored for `idx`.
+    /// @param idx Entity index.
+    virtual bool contains(std::size_t idx) const noexcept = 0;
+
+    /// Remove the component stored for `idx`, if any.
+    /// @param idx Entity index.
+    virtual void erase(std::size_t idx) = 0;
+
+    /// Remove the components stored for several entities in one call.
+    /// @param indices Entity indices; the ones without a component are skipped.
+    virtual void erase(std::span<std::size_t const> indices) = 0;
+
+    /// Collect the entities whose component was stamped after `since`.
+    /// @param since Last version already known by the caller.
+    /// @param indices Receives the entity indices.
+    virtual void changed_since(Version since, std::vector<std::size_t>& indices) const = 0;
+
+    /// Runtime type of the stored component.
+    /// @return The `std::type_index` of the component type.
+    virtual std::type_index type() const noexcept = 0;
+
+    /// @return Number of components the pool holds before its storage grows.
+    virtual std::size_t capacity() const noexcept = 0;
+
+    /// @return Number of id slots spanned by the pool.
+    virtual std::size_t size() const noexcept = 0;
+
+    /// Pre-allocate the storage, see `SparseArray::reserve`.
+    /// @param count Number of components the pool will hold.
+    /// @param size Number of id slots the pool will span.
+    virtual void reserve(std::size_t count, std::size_t size) = 0;
+
+    /// Start logging the pages written from now on, see `SparseArray::checkpoint`.
+    /// @throws std::logic_error if the component type is not copyable.
+    /// @return The undo log of the new checkpoint, owned by the caller until `release`.
+    virtual std::unique_ptr<PoolUndo> checkpoint() = 0;
+
+    /// Roll the pool back to a checkpoint. Newer undo logs must have been applied first.
+    /// @param undo Undo log returned by `checkpoint`.
+    virtual void restore(PoolUndo const& undo) = 0;
+
+    /// Stop using an undo log before it is destroyed.
+    /// @param undo Undo log returned by `checkpoint`.
+    /// @param previous Undo log of the checkpoint before it, receiving its pages, or `nullptr`.
+    /// If `undo` was the one being written, `previous` takes over.
+    virtual void release(PoolUndo& undo, PoolUndo* previous) = 0;
+
+    /// Remove every component, saving the pages of the current checkpoint first.
+    virtual void clear() = 0;
+
+    /// Renumber the components, see `SparseArray::compact`.
+    /// @param new_ids New id of each id spanned by the pool.
+    /// @param version Version the moved components are stamped with.
+    virtual void compact(std::span<std::size_t const> new_ids, Version version) = 0;
+
+    /// @return Memory held by the pool storage.
+    virtual StorageFootprint footprint() const noexcept = 0;
+
+    /// @return The observers of the component type, `nullptr` while none is connected.
+    ComponentObservers* observers() const noexcept {
+        return m_observers.get();
+    }
+
+    /// @return The observers of the component type, created on first use.
+    ComponentObservers& observe();
+
+  private:
+    // null for unobserved types, so that raising an event costs a single branch
+    std::unique_ptr<ComponentObservers> m_observers;
+};
+
+/// Concrete pool holding the SparseArray of `TComponent`.
+/// @tparam TComponent Component type stored in the pool.
+template <typename TComponent> class ComponentPool final : public IComponentPool {
+  public:
+    ComponentPool() = default;
+    ~ComponentPool() override = default;
+
+    /// @param resource Memory resource backing the component storage.
+    explicit ComponentPool(std::pmr::memory_resource* resource) : m_array(resource) {}
+
+    ComponentPool(ComponentPool const&) = delete;
+    ComponentPool& operator=(ComponentPool const&) = delete;
+    ComponentPool(ComponentPool&&) = delete;
+    ComponentPool& operator=(ComponentPool&&) = delete;
+
+    bool contains(std::size_t idx) const noexcept override {
+        return m_array.contains(idx);
+    }
+
+    void erase(std::size_t idx) override {
+        m_array.erase(idx);
+    }
+
+    void erase(std::span<std::size_t const> indices) override {
+        for (auto idx : indices)
+            m_array.erase(idx);
+    }
+
+    void changed_since(Version since, std::vector<std::size_t>& indices) const override {
+        m_array.changed_since(since, indices);
+    }
+
+    std::type_index type() const noexcept override {
+        return std::type_index(typeid(TComponent));
+    }
+
+    std::size_t capacity() const noexcept override {
+        return m_array.capacity();
+    }
+
+    std::size_t size() const noexcept override {
+        return m_array.size();
+    }
+
+    void reserve(std::size_t count, std::size_t size) override {
+        m_array.reserve(count, size);
+    }
+
+    std::unique_ptr<PoolUndo> checkpoint() override {
+        if constexpr (std::is_copy_constructible_v<TComponent>) {
+            auto undo = std::make_unique<Undo>();
+            undo->array = m_array.checkpoint();
+            m_tracked = undo->array.get();
+            return undo;
+        } else {
+            throw std::logic_error("Components that cannot be copied cannot be checkpointed");
+        }
+    }
+
+    void restore(PoolUndo const& undo) override {
+        if constexpr (std::is_copy_constructible_v<TComponent>)
+            m_array.restore(*static_cast<Undo const&>(undo).array);
+    }
+
+    void release(PoolUndo& undo, PoolUndo* previous) override {
+        auto* array = static_cast<Undo&>(undo).array.get();
+        auto* before = (previous != nullptr) ? static_cast<Undo*>(previous)->array.get() : nullptr;
+
+        if (before != nullptr)
+            array->merge_into(*before);
+        if (m_tracked == array) {
+            m_tracked = before;
+            m_array.track(before);
+        }
+    }
+
+    void clear() override {
+        m_array.clear();
+    }
+
+    void compact(std::span<std::size_t const> new_ids, Version version) override {
+        m_array.compact(new_ids, version);
+    }
+
+    StorageFootprint footprint() const noexcept override {
+        return m_array.footprint();
+    }
+
+    SparseArray<TComponent>& array() noexcept {
+        return m_array;
+    }
+
+    SparseArray<TComponent> const& array() const noexcept {
+        return m_array;
+    }
+
+  private:
+    struct Undo final : PoolUndo {
+        std::unique_ptr<typename SparseArray<TComponent>::Undo> array;
+    };
+
+    SparseArray<TComponent> m_array;
+    // undo log the array is writing to, the one of the newest checkpoint
+    typename SparseArray<TComponent>::Undo* m_tracked{nullptr};
+};
+
+} // namespace ecs
@@ -3,11 +3,30 @@
 using namespace ecs;
 
 Entity::operator Entity::IdType() const noexcept {
-    return m_id;
+    return m_index;
 }
 
 Entity::IdType Entity::value() const noexcept {
-    return m_id;
+    return m_index;
 }
 
-Entity::Entity(IdType v) noexcept : m_id(v) {}
+Entity::IndexType Entity::index() const noexcept {
+    return m_index;
+}
+
+Entity::GenerationType Entity::generation() const noexcept {
+    return m_generation;
+}
+
+std::uint64_t Entity::handle() const noexcept {
+    return (static_cast<std::uint64_t>(m_generation) << 32U) | m_index;
+}
+
+Entity::Entity(IdType index, GenerationType generation) noexcept
+    : m_index(static_cast<IndexType>(index)), m_generation(generation) {}
+
+Entity Entity::at(GenerationTable const* generations, IdType index) noexcept {
+    if (generations == nullptr || index >= generations->size())
+        return Entity{index};
+    return Entity{index, (*generations)[index]};
+}
@@ -1,56 +1,91 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <format>
 #include <functional>
+#include <memory_resource>
+#include <vector>
 
 namespace ecs {
 
 class Registry;
+template <typename... TComponents> class View;
+template <typename TOwned, typename TGet> class Group;
 
-/// Strongly-typed wrapper for entity identifiers used by the ECS.
-/// Provides an explicit IdType alias and safe conversions to the underlying
-/// integral identifier.
+/// Strongly-typed entity handle: a 32-bit index plus a 32-bit generation.
+///
+/// The index addresses the component pools; the generation tells apart the successive
+/// entities reusing the same index, so a handle kept across ticks can be checked with
+/// `Registry::alive`. Conversions to `IdType` yield the index.
 class Entity {
   public:
-    /// Underlying integer type used for entity ids.
+    /// Integer type entity indices are exposed as (pool positions).
     using IdType = std::size_t;
+    /// Stored index type.
+    using IndexType = std::uint32_t;
+    /// Generation counter type, bumped each time an index is freed.
+    using GenerationType = std::uint32_t;
+    /// Current generation of every index, owned by the registry.
+    using GenerationTable = std::pmr::vector<GenerationType>;
 
     /// Default-construct an invalid / null entity.
     Entity() noexcept = default;
 
-    /// Convert the Entity to its underlying `IdType` value.
-    /// @return The raw entity id as `IdType`.
+    /// Convert the Entity to its index.
+    /// @return The entity index as `IdType`.
     operator IdType() const noexcept;
 
-    /// Get the underlying id value for this entity.
-    /// @return The raw entity id as `IdType`.
+    /// Get the index of this entity.
+    /// @return The entity index as `IdType`.
     IdType value() const noexcept;
 
+    /// Get the index of this entity.
+    /// @return The 32-bit entity index.
+    IndexType index() const noexcept;
+
+    /// Get the generation of this entity.
+    /// @return The generation the index had when the entity was spawned.
+    GenerationType generation() const noexcept;
+
+    /// Get the index and generation packed in a single integer (generation in the high bits).
+    /// @return The packed handle.
+    std::uint64_t handle() const noexcept;
+
     /// Equality comparison operator.
     /// @param other The other entity to compare with.
-    /// @return True if the entities have the same id.
+    /// @return True if the entities have the same index and generation.
     bool operator==(const Entity& other) const noexcept {
-        return m_id == other.m_id;
+        return m_index == other.m_index && m_generation == other.m_generation;
     }
 
     /// Inequality comparison operator.
     /// @param other The other entity to compare with.
-    /// @return True if the entities have different ids.
+    /// @return True if the entities differ by index or generation.
     bool operator!=(const Entity& other) const noexcept {
-        return m_id != other.m_id;
+        return !(*this == other);
     }
 
   private:
-    /// Construct an Entity from a raw id. Only `Registry` may create entities.
-    /// @param v The raw id to wrap.
-    explicit Entity(IdType v) noexcept;
+    /// Construct an Entity from a raw index. Only `Registry` may create entities.
+    /// @param index The raw index to wrap.
+    /// @param generation Generation of the index.
+    explicit Entity(IdType index, GenerationType generation = 0) noexcept;
+
+    /// Build the handle of the entity currently at `index`.
+    /// @param generations Generation table of the registry, or `nullptr` for generation 0.
+    /// @param index Entity index.
+    static Entity at(GenerationTable const* generations, IdType index) noexcept;
 
-    /// The underlying id stored for this entity.
-    IdType m_id{0};
+    IndexType m_index{0};
+    GenerationType m_generation{0};
 
     /// `Registry` is a friend to allow it to construct and manage entities.
     friend class Registry;
+    /// Views hand out the entities they iterate over.
+    template <typename... TComponents> friend class View;
+    /// Groups hand out the entities they iterate over.
+    template <typename TOwned, typename TGet> friend class Group;
 };
 
 } // namespace ecs
@@ -59,7 +94,7 @@ class Entity {
 template <>
 struct std::hash<ecs::Entity> {
     std::size_t operator()(const ecs::Entity& entity) const noexcept {
-        return std::hash<ecs::Entity::IdType>{}(entity.value());
+        return std::hash<std::uint64_t>{}(entity.handle());
     }
 };
 
@@ -0,0 +1,22 @@
+#include "entity_remap.h"
+
+#include <algorithm>
+#include <utility>
+
+ecs::EntityRemap::EntityRemap(std::vector<EntityMove> moves) noexcept : m_moves(std::move(moves)) {}
+
+ecs::Entity ecs::EntityRemap::apply(Entity e) const noexcept {
+    auto it = std::lower_bound(m_moves.begin(), m_moves.end(), e.index(),
+                               [](EntityMove const& move, Entity::IndexType index) { return move.from.index() < index; });
+    if (it == m_moves.end() || it->from != e)
+        return e;
+    return it->to;
+}
+
+std::span<ecs::EntityMove const> ecs::EntityRemap::moves() const noexcept {
+    return m_moves;
+}
+
+bool ecs::EntityRemap::empty() const noexcept {
+    return m_moves.empty();
+}
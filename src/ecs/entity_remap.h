@@ -0,0 +1,41 @@
+#pragma once
+
+#include "entity.h"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace ecs {
+
+/// Old and new handle of an entity renumbered by `Registry::compact`.
+struct EntityMove {
+    Entity from;
+    Entity to;
+};
+
+/// Renumbering applied by `Registry::compact`, to be replayed on every structure keeping
+/// entity handles outside the registry (id maps, cached handles...).
+class EntityRemap {
+  public:
+    EntityRemap() = default;
+
+    /// @param moves Renumbered entities, sorted by old index.
+    explicit EntityRemap(std::vector<EntityMove> moves) noexcept;
+
+    /// Get the handle an entity has after the compaction.
+    /// @param e Handle taken before the compaction.
+    /// @return The new handle of `e`, or `e` itself if it was not renumbered.
+    Entity apply(Entity e) const noexcept;
+
+    /// @return The renumbered entities, sorted by old index.
+    std::span<EntityMove const> moves() const noexcept;
+
+    /// @return True if no entity was renumbered.
+    bool empty() const noexcept;
+
+  private:
+    std::vector<EntityMove> m_moves;
+};
+
+} // namespace ecs
@@ -0,0 +1,199 @@
+#pragma once
+
+#include "component_pool.h"
+#include "entity.h"
+#include "sparse_array.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+
+namespace ecs {
+
+/// Component types whose pools are owned (kept sorted) by a group.
+template <typename... TComponents> struct Owned {};
+
+/// Component types a group requires but does not own (looked up through their sparse index).
+template <typename... TComponents> struct Get {};
+
+/// Type-erased bookkeeping of an owning group, notified by the registry on structural changes.
+class IGroupHandler {
+  public:
+    IGroupHandler() = default;
+    virtual ~IGroupHandler() = default;
+
+    IGroupHandler(IGroupHandler const&) = delete;
+    IGroupHandler& operator=(IGroupHandler const&) = delete;
+    IGroupHandler(IGroupHandler&&) = delete;
+    IGroupHandler& operator=(IGroupHandler&&) = delete;
+
+    /// Check whether the group owns the pool of a component.
+    /// @param id Component id.
+    virtual bool owns(ComponentId id) const noexcept = 0;
+
+    /// Check whether a component takes part in the group (owned or not).
+    /// @param id Component id.
+    virtual bool involves(ComponentId id) const noexcept = 0;
+
+    /// Pull the entity into the group if it now owns every component. Called after a component is added.
+    /// @param idx Entity index.
+    virtual void enter(std::size_t idx) = 0;
+
+    /// Push the entity out of the group if it is a member. Called before a component is removed.
+    /// @param idx Entity index.
+    virtual void leave(std::size_t idx) = 0;
+
+    /// @return Number of members, the length of the sorted prefix of the owned pools.
+    virtual std::size_t size() const noexcept = 0;
+
+    /// Set the number of members after the owned pools were rolled back, then pull in the
+    /// entities matching past that prefix.
+    /// @param size Length the prefix had when the pools were in their current state.
+    virtual void reset(std::size_t size) = 0;
+};
+
+template <typename TOwned, typename TGet> class GroupHandler;
+
+/// Keeps the members of a group at the front of every owned pool, in the same order,
+/// so that position `i < size()` of each owned dense array belongs to the same entity.
+/// @tparam TOwned Owned component types (packed storage only).
+/// @tparam TGet Required but non-owned component types.
+template <typename... TOwned, typename... TGet>
+class GroupHandler<Owned<TOwned...>, Get<TGet...>> final : public IGroupHandler {
+    static_assert(sizeof...(TOwned) > 0, "A group must own at least one component type");
+    static_assert(((StorageTraits<TOwned>::k_mode == StorageMode::Packed) && ...),
+                  "Owned components must use packed storage");
+
+  public:
+    using SizeType = std::size_t;
+
+    GroupHandler(std::tuple<SparseArray<TOwned>*...> owned, std::tuple<SparseArray<TGet>*...> get,
+                 Entity::GenerationTable const* generations = nullptr);
+    ~GroupHandler() override = default;
+
+    GroupHandler(GroupHandler const&) = delete;
+    GroupHandler& operator=(GroupHandler const&) = delete;
+    GroupHandler(GroupHandler&&) = delete;
+    GroupHandler& operator=(GroupHandler&&) = delete;
+
+    bool owns(ComponentId id) const noexcept override;
+    bool involves(ComponentId id) const noexcept override;
+    void enter(SizeType idx) override;
+    void leave(SizeType idx) override;
+    SizeType size() const noexcept override;
+    void reset(SizeType size) override;
+
+    /// Pull every entity already matching the group into it.
+    void refresh();
+
+    std::tuple<SparseArray<TOwned>*...> const& owned() const noexcept;
+    std::tuple<SparseArray<TGet>*...> const& get() const noexcept;
+    SizeType const& length() const noexcept;
+    Entity::GenerationTable const* generations() const noexcept;
+
+  private:
+    std::tuple<SparseArray<TOwned>*...> m_owned;
+    std::tuple<SparseArray<TGet>*...> m_get;
+    Entity::GenerationTable const* m_generations;
+    SizeType m_length{0};
+
+    bool in_group(SizeType idx) const noexcept;
+    bool matches(SizeType idx) const noexcept;
+};
+
+template <typename TOwned, typename TGet = Get<>> class Group;
+
+/// Iterable owning group. Iteration is a linear walk over the shared prefix of the
+/// owned pools, yielding `(entity, TOwned&..., TGet&...)` without membership checks.
+/// Const-qualify a component type to get read-only access to it: the components handed
+/// out non-const are stamped as written when the group was given a version.
+///
+/// Membership is maintained by the registry on `add_component`, `emplace_component`,
+/// `remove_component` and `kill_entity`; owned pools must not be modified through
+/// their SparseArray directly. Components must not be removed while iterating.
+/// @tparam TOwned Owned component types.
+/// @tparam TGet Required but non-owned component types.
+template <typename... TOwned, typename... TGet> class Group<Owned<TOwned...>, Get<TGet...>> {
+  public:
+    using SizeType = std::size_t;
+    using ValueType = std::tuple<Entity, TOwned&..., TGet&...>;
+    using HandlerType = GroupHandler<Owned<std::remove_const_t<TOwned>...>, Get<std::remove_const_t<TGet>...>>;
+
+    class Iterator {
+      public:
+        using Reference = ValueType;
+        using Pointer = void;
+        using DifferenceType = std::ptrdiff_t;
+        using IteratorCategory = std::input_iterator_tag;
+
+        Iterator() = default;
+        Iterator(Group const* group, SizeType pos) noexcept : m_group(group), m_pos(pos) {}
+
+        Reference operator*() const { return m_group->at(m_pos); }
+
+        Iterator& operator++() noexcept {
+            ++m_pos;
+            return *this;
+        }
+        Iterator operator++(int) noexcept {
+            Iterator tmp(*this);
+            ++m_pos;
+            return tmp;
+        }
+
+        bool operator==(Iterator const& rhs) const noexcept { return m_pos == rhs.m_pos; }
+        bool operator!=(Iterator const& rhs) const noexcept { return m_pos != rhs.m_pos; }
+
+      private:
+        Group const* m_group{nullptr};
+        SizeType m_pos{0};
+    };
+
+    /// @param handler Bookkeeping of the group.
+    /// @param version Version the non-const components are stamped with, 0 to leave the stamps untouched.
+    explicit Group(HandlerType const& handler, Version version = 0) noexcept;
+
+    Iterator begin() const noexcept;
+    Iterator end() const noexcept;
+
+    /// Number of entities in the group.
+    SizeType size() const noexcept;
+
+    /// Check whether the entity at `idx` is a member of the group.
+    /// @param idx Entity index.
+    bool contains(SizeType idx) const noexcept;
+
+    /// Call `fn(entity, owned&..., get&...)` for every member, splitting the owned prefix into
+    /// cache-line-aligned chunks run concurrently on `pool`. Below `threshold` members the walk
+    /// is serial on the calling thread. `fn` must only touch the entity it is given.
+    /// @param pool Thread pool running the chunks.
+    /// @param fn Callable invoked once per member, possibly concurrently.
+    /// @param threshold Number of members from which the walk is split.
+    template <typename TFunction>
+    void par_each(ThreadPool& pool, TFunction&& fn, SizeType threshold = k_default_parallel_threshold) const;
+
+    /// Call `fn(begin, end)` on ranges of member positions, split like `par_each`. Members are
+    /// reached with `at(pos)`: suited to batched kernels working on a block of members at once.
+    /// @param pool Thread pool running the chunks.
+    /// @param fn Callable invoked once per range, possibly concurrently.
+    /// @param threshold Number of members from which the walk is split.
+    template <typename TFunction>
+    void par_chunks(ThreadPool& pool, TFunction&& fn, SizeType threshold = k_default_parallel_threshold) const;
+
+    /// Access the member at position `pos` of the owned pools, stamping its non-const components.
+    /// @param pos Position, must be lower than `size()`.
+    /// @return Tuple of the entity and references to its components.
+    ValueType at(SizeType pos) const;
+
+  private:
+    HandlerType const* m_handler;
+    Version m_version;
+};
+
+} // namespace ecs
+
+#include "group.tcc"
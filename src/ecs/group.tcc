@@ -0,0 +1,162 @@
+#pragma once
+
+#include "group.h"
+
+namespace ecs {
+
+template <typename... TOwned, typename... TGet>
+GroupHandler<Owned<TOwned...>, Get<TGet...>>::GroupHandler(std::tuple<SparseArray<TOwned>*...> owned,
+                                                            std::tuple<SparseArray<TGet>*...> get,
+                                                            Entity::GenerationTable const* generations)
+    : m_owned(owned), m_get(get), m_generations(generations) {}
+
+template <typename... TOwned, typename... TGet>
+bool GroupHandler<Owned<TOwned...>, Get<TGet...>>::owns(ComponentId id) const noexcept {
+    return ((component_id<TOwned>() == id) || ...);
+}
+
+template <typename... TOwned, typename... TGet>
+bool GroupHandler<Owned<TOwned...>, Get<TGet...>>::involves(ComponentId id) const noexcept {
+    return owns(id) || ((component_id<TGet>() == id) || ...);
+}
+
+template <typename... TOwned, typename... TGet>
+void GroupHandler<Owned<TOwned...>, Get<TGet...>>::enter(SizeType idx) {
+    if (in_group(idx) || !matches(idx))
+        return;
+
+    std::apply([this, idx](auto*... pools) { (pools->swap_dense(pools->dense_index(idx), m_length), ...); }, m_owned);
+    ++m_length;
+}
+
+template <typename... TOwned, typename... TGet>
+void GroupHandler<Owned<TOwned...>, Get<TGet...>>::leave(SizeType idx) {
+    if (!in_group(idx))
+        return;
+
+    --m_length;
+    std::apply([this, idx](auto*... pools) { (pools->swap_dense(pools->dense_index(idx), m_length), ...); }, m_owned);
+}
+
+template <typename... TOwned, typename... TGet>
+typename GroupHandler<Owned<TOwned...>, Get<TGet...>>::SizeType
+GroupHandler<Owned<TOwned...>, Get<TGet...>>::size() const noexcept {
+    return m_length;
+}
+
+template <typename... TOwned, typename... TGet>
+void GroupHandler<Owned<TOwned...>, Get<TGet...>>::reset(SizeType size) {
+    m_length = size;
+    refresh();
+}
+
+template <typename... TOwned, typename... TGet> void GroupHandler<Owned<TOwned...>, Get<TGet...>>::refresh() {
+    auto const& lead = *std::get<0>(m_owned);
+
+    // Members are swapped towards the front, behind positions that were already visited.
+    for (SizeType pos = m_length; pos < lead.count(); pos++)
+        enter(lead.indices()[pos]);
+}
+
+template <typename... TOwned, typename... TGet>
+std::tuple<SparseArray<TOwned>*...> const& GroupHandler<Owned<TOwned...>, Get<TGet...>>::owned() const noexcept {
+    return m_owned;
+}
+
+template <typename... TOwned, typename... TGet>
+std::tuple<SparseArray<TGet>*...> const& GroupHandler<Owned<TOwned...>, Get<TGet...>>::get() const noexcept {
+    return m_get;
+}
+
+template <typename... TOwned, typename... TGet>
+typename GroupHandler<Owned<TOwned...>, Get<TGet...>>::SizeType const&
+GroupHandler<Owned<TOwned...>, Get<TGet...>>::length() const noexcept {
+    return m_length;
+}
+
+template <typename... TOwned, typename... TGet>
+Entity::GenerationTable const* GroupHandler<Owned<TOwned...>, Get<TGet...>>::generations() const noexcept {
+    return m_generations;
+}
+
+template <typename... TOwned, typename... TGet>
+bool GroupHandler<Owned<TOwned...>, Get<TGet...>>::in_group(SizeType idx) const noexcept {
+    return std::get<0>(m_owned)->dense_index(idx) < m_length;
+}
+
+template <typename... TOwned, typename... TGet>
+bool GroupHandler<Owned<TOwned...>, Get<TGet...>>::matches(SizeType idx) const noexcept {
+    return std::apply([idx](auto const*... pools) { return (pools->contains(idx) && ...); }, m_owned) &&
+           std::apply([idx](auto const*... pools) { return (pools->contains(idx) && ...); }, m_get);
+}
+
+template <typename... TOwned, typename... TGet>
+Group<Owned<TOwned...>, Get<TGet...>>::Group(HandlerType const& handler, Version version) noexcept
+    : m_handler(&handler), m_version(version) {}
+
+template <typename... TOwned, typename... TGet>
+typename Group<Owned<TOwned...>, Get<TGet...>>::Iterator Group<Owned<TOwned...>, Get<TGet...>>::begin() const noexcept {
+    return Iterator(this, 0);
+}
+
+template <typename... TOwned, typename... TGet>
+typename Group<Owned<TOwned...>, Get<TGet...>>::Iterator Group<Owned<TOwned...>, Get<TGet...>>::end() const noexcept {
+    return Iterator(this, size());
+}
+
+template <typename... TOwned, typename... TGet>
+typename Group<Owned<TOwned...>, Get<TGet...>>::SizeType Group<Owned<TOwned...>, Get<TGet...>>::size() const noexcept {
+    return m_handler->length();
+}
+
+template <typename... TOwned, typename... TGet>
+bool Group<Owned<TOwned...>, Get<TGet...>>::contains(SizeType idx) const noexcept {
+    return std::get<0>(m_handler->owned())->dense_index(idx) < size();
+}
+
+template <typename... TOwned, typename... TGet>
+template <typename TFunction>
+void Group<Owned<TOwned...>, Get<TGet...>>::par_each(ThreadPool& pool, TFunction&& fn, SizeType threshold) const {
+    par_chunks(
+        pool,
+        [this, &fn](SizeType begin, SizeType end) {
+            for (SizeType pos = begin; pos < end; pos++)
+                std::apply(fn, at(pos));
+        },
+        threshold);
+}
+
+template <typename... TOwned, typename... TGet>
+template <typename TFunction>
+void Group<Owned<TOwned...>, Get<TGet...>>::par_chunks(ThreadPool& pool, TFunction&& fn, SizeType threshold) const {
+    const SizeType k_size = size();
+    if (k_size < threshold) {
+        fn(SizeType{0}, k_size);
+        return;
+    }
+    // Owned pools share positions: chunk boundaries follow the widest of their elements
+    const SizeType k_element_size = std::max({sizeof(std::optional<std::remove_const_t<TOwned>>)...});
+    pool.parallel_for(k_size, pool.chunk_size(k_size, k_element_size), fn);
+}
+
+template <typename... TOwned, typename... TGet>
+typename Group<Owned<TOwned...>, Get<TGet...>>::ValueType Group<Owned<TOwned...>, Get<TGet...>>::at(SizeType pos) const {
+    const SizeType k_idx = std::get<0>(m_handler->owned())->indices()[pos];
+
+    if (m_version != 0) {
+        auto stamp = [this, k_idx]<typename TComponent>(std::type_identity<TComponent> /*type*/, auto* pool) {
+            if constexpr (!std::is_const_v<TComponent>)
+                pool->stamp(k_idx, m_version);
+        };
+        std::apply([&stamp](auto*... pools) { (stamp(std::type_identity<TOwned>{}, pools), ...); }, m_handler->owned());
+        std::apply([&stamp](auto*... pools) { (stamp(std::type_identity<TGet>{}, pools), ...); }, m_handler->get());
+    }
+    return std::tuple_cat(
+        std::tuple<Entity>(Entity::at(m_handler->generations(), k_idx)),
+        std::apply([pos](auto*... pools) { return std::tuple<TOwned&...>(pools->dense_at(pos).value()...); },
+                   m_handler->owned()),
+        std::apply([k_idx](auto*... pools) { return std::tuple<TGet&...>((*pools)[k_idx].value()...); },
+                   m_handler->get()));
+}
+
+} // namespace ecs
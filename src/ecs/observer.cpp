@@ -0,0 +1,41 @@
+#include "observer.h"
+
+#include <algorithm>
+#include <utility>
+
+void ecs::ComponentObservers::connect(ComponentEvent event, Callback callback) {
+    std::scoped_lock lock(m_mutex);
+    m_channels[static_cast<std::size_t>(event)].callbacks.push_back(std::move(callback));
+}
+
+void ecs::ComponentObservers::record(ComponentEvent event, Entity e) {
+    if (!observes(event))
+        return;
+
+    std::scoped_lock lock(m_mutex);
+    m_channels[static_cast<std::size_t>(event)].queue.push_back(e);
+}
+
+void ecs::ComponentObservers::dispatch(Registry& registry) {
+    for (std::size_t event = 0; event < k_event_count; event++) {
+        auto& channel = m_channels[event];
+        {
+            std::scoped_lock lock(m_mutex);
+            if (channel.queue.empty())
+                continue;
+            std::swap(channel.batch, channel.queue);
+        }
+
+        if (static_cast<ComponentEvent>(event) == ComponentEvent::update) {
+            auto by_handle = [](Entity const& lhs, Entity const& rhs) {
+                return std::pair(lhs.index(), lhs.generation()) < std::pair(rhs.index(), rhs.generation());
+            };
+            std::sort(channel.batch.begin(), channel.batch.end(), by_handle);
+            channel.batch.erase(std::unique(channel.batch.begin(), channel.batch.end()), channel.batch.end());
+        }
+        // Indexed: a callback may connect another one
+        for (std::size_t i = 0; i < channel.callbacks.size(); i++)
+            channel.callbacks[i](registry, std::span<Entity const>(channel.batch));
+        channel.batch.clear();
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "entity.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <vector>
+
+namespace ecs {
+
+class Registry;
+
+/// Lifecycle events of a component, in dispatch order.
+enum class ComponentEvent : std::uint8_t {
+    construct, ///< The entity got the component.
+    update,    ///< The component was replaced or written (`get_component`, `patch`, `mark_dirty`).
+    destroy,   ///< The component was removed, or its entity killed.
+};
+
+/// Observers of one component type, and the events queued for them since the last dispatch.
+///
+/// Events are only recorded for the kinds that have a callback. They are delivered in batches
+/// by `dispatch`, construct events first, then updates (each entity once), then destroy
+/// events; a callback must therefore check the registry for the current state of an entity.
+/// Recording is thread-safe, so systems running in parallel may raise events.
+class ComponentObservers {
+  public:
+    /// Receives the registry and the entities of a batch: in recording order, except for
+    /// updates which are sorted by index.
+    using Callback = std::function<void(Registry&, std::span<Entity const>)>;
+
+    ComponentObservers() = default;
+    ~ComponentObservers() = default;
+
+    ComponentObservers(ComponentObservers const&) = delete;
+    ComponentObservers& operator=(ComponentObservers const&) = delete;
+    ComponentObservers(ComponentObservers&&) = delete;
+    ComponentObservers& operator=(ComponentObservers&&) = delete;
+
+    /// Add a callback for an event. Events recorded before the call are not delivered to it.
+    /// @param event Event to observe.
+    /// @param callback Callable receiving each batch.
+    void connect(ComponentEvent event, Callback callback);
+
+    /// @return True if a callback observes `event`.
+    bool observes(ComponentEvent event) const noexcept {
+        return !m_channels[static_cast<std::size_t>(event)].callbacks.empty();
+    }
+
+    /// Queue an event, unless nothing observes it.
+    /// @param event Event raised.
+    /// @param e Entity whose component raised it.
+    void record(ComponentEvent event, Entity e);
+
+    /// Deliver the queued events. Events raised by the callbacks are queued for the next dispatch.
+    /// @param registry Registry handed to the callbacks.
+    void dispatch(Registry& registry);
+
+  private:
+    struct Channel {
+        std::vector<Callback> callbacks;
+        std::vector<Entity> queue;
+        // events being delivered, swapped with the queue so that callbacks may record new ones
+        std::vector<Entity> batch;
+    };
+
+    static constexpr std::size_t k_event_count = 3;
+
+    std::array<Channel, k_event_count> m_channels;
+    std::mutex m_mutex;
+};
+
+} // namespace ecs
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace ecs {
+
+/// Elements per copy-on-write page of a checkpointed array.
+inline constexpr std::size_t k_cow_page_size = 64;
+
+/// Pre-images of the pages of an array written since a checkpoint.
+///
+/// A page is copied once, right before its first write (see `PageTracker`), so the log holds
+/// exactly the pages that changed. Restoring copies those pages back and drops whatever was
+/// appended since the checkpoint.
+/// @tparam T Element type of the array.
+template <typename T> class PageLog {
+  public:
+    /// @param size Size of the array when the checkpoint was taken.
+    explicit PageLog(std::size_t size = 0) noexcept;
+
+    /// @return Size of the array when the checkpoint was taken.
+    std::size_t size() const noexcept;
+
+    /// @return Number of pages saved.
+    std::size_t page_count() const noexcept;
+
+    /// Check whether a page has been saved.
+    /// @param page Page index.
+    bool contains(std::size_t page) const noexcept;
+
+    /// Save a page of the array. Elements past the checkpoint size are not kept.
+    /// @param data Current content of the array, not modified yet in this page.
+    /// @param page Page index.
+    void save(std::span<T const> data, std::size_t page);
+
+    /// Bring an array back to its state at the checkpoint.
+    /// @param data The array: resized to the checkpoint size, then given back the saved pages.
+    template <typename TVector> void restore(TVector& data) const;
+
+    /// Hand the pages over to the log of the previous checkpoint, which keeps its own copy
+    /// of the pages both logs saved. This log is left empty.
+    /// @param previous Log of the checkpoint taken before this one.
+    void merge_into(PageLog& previous);
+
+    /// Call `fn(page)` for every saved page.
+    template <typename TFunction> void each_page(TFunction&& fn) const;
+
+  private:
+    std::size_t m_size;
+    std::unordered_map<std::size_t, std::vector<T>> m_pages;
+};
+
+/// Write barrier of an array: saves each page into the current log before its first write.
+///
+/// Every function writing to the array calls `touch` with the positions it is about to
+/// modify, remove or overwrite; appending past the checkpoint size needs no touch.
+/// Without a log, a touch is a single branch. Touches may come from several threads at
+/// once (systems writing distinct entities); `track` must not run concurrently with them.
+/// Copies of a tracker do not track anything.
+/// @tparam T Element type of the array.
+template <typename T> class PageTracker {
+  public:
+    PageTracker() = default;
+    ~PageTracker() = default;
+
+    PageTracker(PageTracker const& /*other*/) noexcept {}
+    PageTracker(PageTracker&& /*other*/) noexcept {}
+    PageTracker& operator=(PageTracker const& other) noexcept;
+    PageTracker& operator=(PageTracker&& other) noexcept;
+
+    /// Save the pages written from now on into `log`. The pages it already holds are not saved again.
+    /// @param log Log of the newest checkpoint, or `nullptr` to stop saving.
+    void track(PageLog<T>* log);
+
+    /// @return The log pages are saved into, `nullptr` if none.
+    PageLog<T>* log() const noexcept { return m_log; }
+
+    /// Save the page holding `idx`, unless already saved.
+    /// @param data Current content of the array.
+    /// @param idx Position about to be written.
+    void touch(std::span<T const> data, std::size_t idx) {
+        if (m_log != nullptr) [[unlikely]]
+            save(data, idx / k_cow_page_size);
+    }
+
+    /// Save the pages holding `[begin, end)`.
+    void touch(std::span<T const> data, std::size_t begin, std::size_t end);
+
+  private:
+    PageLog<T>* m_log{nullptr};
+    // pages saved into m_log hold the current epoch, so a new log does not clear the table
+    std::uint32_t m_epoch{0};
+    std::unique_ptr<std::atomic<std::uint32_t>[]> m_saved;
+    std::size_t m_pages{0};
+    std::mutex m_mutex;
+
+    void save(std::span<T const> data, std::size_t page);
+};
+
+} // namespace ecs
+
+#include "page_log.tcc"
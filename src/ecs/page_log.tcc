@@ -0,0 +1,118 @@
+#pragma once
+
+#include "page_log.h"
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace ecs {
+
+// ========== PageLog ==========
+
+template <typename T> PageLog<T>::PageLog(std::size_t size) noexcept : m_size(size) {}
+
+template <typename T> std::size_t PageLog<T>::size() const noexcept {
+    return m_size;
+}
+
+template <typename T> std::size_t PageLog<T>::page_count() const noexcept {
+    return m_pages.size();
+}
+
+template <typename T> bool PageLog<T>::contains(std::size_t page) const noexcept {
+    return m_pages.find(page) != m_pages.end();
+}
+
+/// Copy the part of the page that existed at the checkpoint.
+template <typename T> void PageLog<T>::save(std::span<T const> data, std::size_t page) {
+    const std::size_t k_begin = page * k_cow_page_size;
+    const std::size_t k_end = std::min({k_begin + k_cow_page_size, m_size, data.size()});
+
+    if (k_begin >= k_end || contains(page))
+        return;
+    // Arrays of non-copyable elements have no log to save into, see `ComponentPool::checkpoint`
+    if constexpr (std::is_copy_constructible_v<T>)
+        m_pages.emplace(page, std::vector<T>(data.begin() + static_cast<std::ptrdiff_t>(k_begin),
+                                             data.begin() + static_cast<std::ptrdiff_t>(k_end)));
+}
+
+template <typename T> template <typename TVector> void PageLog<T>::restore(TVector& data) const {
+    data.resize(m_size);
+    for (auto const& [page, elements] : m_pages)
+        std::copy(elements.begin(), elements.end(), data.begin() + static_cast<std::ptrdiff_t>(page * k_cow_page_size));
+}
+
+/// Pages the previous log lacks did not change between both checkpoints: ours are its pre-images too.
+template <typename T> void PageLog<T>::merge_into(PageLog& previous) {
+    for (auto& [page, elements] : m_pages) {
+        const std::size_t k_begin = page * k_cow_page_size;
+
+        if (k_begin >= previous.m_size || previous.contains(page))
+            continue;
+        elements.resize(std::min(elements.size(), previous.m_size - k_begin));
+        previous.m_pages.emplace(page, std::move(elements));
+    }
+    m_pages.clear();
+}
+
+template <typename T> template <typename TFunction> void PageLog<T>::each_page(TFunction&& fn) const {
+    for (auto const& entry : m_pages)
+        fn(entry.first);
+}
+
+// ========== PageTracker ==========
+
+template <typename T> PageTracker<T>& PageTracker<T>::operator=(PageTracker const& other) noexcept {
+    if (this != &other)
+        m_log = nullptr;
+    return *this;
+}
+
+template <typename T> PageTracker<T>& PageTracker<T>::operator=(PageTracker&& other) noexcept {
+    if (this != &other)
+        m_log = nullptr;
+    return *this;
+}
+
+/// A new epoch forgets which pages were saved, then the pages already in the log are marked.
+template <typename T> void PageTracker<T>::track(PageLog<T>* log) {
+    m_log = log;
+    if (log == nullptr)
+        return;
+
+    const std::size_t k_pages = (log->size() + k_cow_page_size - 1) / k_cow_page_size;
+    if (k_pages > m_pages) {
+        m_pages = std::max(k_pages, m_pages * 2);
+        m_saved = std::make_unique<std::atomic<std::uint32_t>[]>(m_pages);
+    }
+    if (++m_epoch == 0) {
+        for (std::size_t page = 0; page < m_pages; page++)
+            m_saved[page].store(0, std::memory_order_relaxed);
+        m_epoch = 1;
+    }
+    log->each_page([this](std::size_t page) { m_saved[page].store(m_epoch, std::memory_order_relaxed); });
+}
+
+template <typename T> void PageTracker<T>::touch(std::span<T const> data, std::size_t begin, std::size_t end) {
+    if (m_log == nullptr || begin >= end)
+        return;
+    for (std::size_t page = begin / k_cow_page_size; page <= (end - 1) / k_cow_page_size; page++)
+        save(data, page);
+}
+
+/// Pages past the checkpoint size only hold appended elements, dropped on restore.
+/// The flag is published after the copy: a writer seeing it may modify the page.
+template <typename T> void PageTracker<T>::save(std::span<T const> data, std::size_t page) {
+    if (page * k_cow_page_size >= m_log->size() || m_saved[page].load(std::memory_order_acquire) == m_epoch)
+        return;
+
+    std::scoped_lock lock(m_mutex);
+    if (m_saved[page].load(std::memory_order_relaxed) == m_epoch)
+        return;
+    m_log->save(data, page);
+    m_saved[page].store(m_epoch, std::memory_order_release);
+}
+
+} // namespace ecs
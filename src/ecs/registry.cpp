@@ -2,8 +2,52 @@
 
 #include "utils/logger.h"
 
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
 using namespace ecs;
 
+void ecs::CapacityHints::merge(CapacityHints const& other) {
+    entities = std::max(entities, other.entities);
+    journal = std::max(journal, other.journal);
+    if (pools.size() < other.pools.size())
+        pools.resize(other.pools.size());
+    for (std::size_t i = 0; i < other.pools.size(); i++) {
+        pools[i].count = std::max(pools[i].count, other.pools[i].count);
+        pools[i].size = std::max(pools[i].size, other.pools[i].size);
+    }
+}
+
+ecs::Registry::Registry() : Registry(std::pmr::get_default_resource()) {}
+
+ecs::Registry::Registry(std::pmr::memory_resource* resource)
+    : m_resource(resource), m_free_entities(resource), m_generations(resource), m_journal(resource) {}
+
+CapacityHints ecs::Registry::capacity_hints() const {
+    CapacityHints hints;
+    hints.entities = m_generations.capacity();
+    hints.journal = m_journal.capacity();
+    hints.pools.resize(m_pools.size());
+    for (std::size_t id = 0; id < m_pools.size(); id++) {
+        if (m_pools[id])
+            hints.pools[id] = CapacityHints::Pool{m_pools[id]->capacity(), m_pools[id]->size()};
+    }
+    return hints;
+}
+
+void ecs::Registry::reserve(CapacityHints const& hints) {
+    m_generations.reserve(hints.entities);
+    m_free_entities.reserve(hints.entities);
+    m_journal.reserve(hints.journal);
+    m_pool_hints = hints.pools;
+    for (std::size_t id = 0; id < std::min(m_pools.size(), m_pool_hints.size()); id++) {
+        if (m_pools[id])
+            m_pools[id]->reserve(m_pool_hints[id].count, m_pool_hints[id].size);
+    }
+}
+
 void ecs::Registry::set_current_version(Version v) noexcept {
     m_current_version = v;
 }
@@ -12,102 +56,251 @@ ecs::Registry::Version ecs::Registry::get_current_version() const noexcept {
     return m_current_version;
 }
 
-const std::unordered_map<Registry::EntityType, Registry::Version>& ecs::Registry::get_entity_creation_tombstones() const noexcept {
-    return m_entity_creation_tumbstones;
+const ChangeJournal& ecs::Registry::get_change_journal() const noexcept {
+    return m_journal;
 }
 
-const std::unordered_map<Registry::EntityType, Registry::Version>& ecs::Registry::get_entity_destruction_tombstones() const noexcept {
-    return m_entity_destruction_tumbstones;
+void ecs::Registry::trim_change_journal(Version acknowledged) {
+    m_journal.trim(acknowledged);
 }
 
-const std::unordered_map<Registry::EntityType, std::unordered_map<std::type_index, Registry::Version>>&
-ecs::Registry::get_component_destruction_tombstones() const noexcept {
-    return m_component_destruction_tombstones;
+std::type_index ecs::Registry::component_type(ComponentId id) const {
+    if (id >= m_pools.size() || !m_pools[id])
+        throw std::out_of_range("Component id is not registered");
+    return m_pools[id]->type();
 }
 
-const std::unordered_map<std::pair<Registry::EntityType, std::type_index>, Registry::Version>&
-ecs::Registry::get_component_metadata() const noexcept {
-    return m_component_metadata;
+Registry::EntityType Registry::spawn_entity() {
+    EntityType e;
+    if (!m_free_entities.empty()) {
+        m_free_entities_cow.touch(m_free_entities, m_free_entities.size() - 1);
+        e = m_free_entities.back();
+        m_free_entities.pop_back();
+        m_generations_cow.touch(m_generations, e.index());
+        m_generations[e.index()] = e.generation();
+    } else {
+        e = EntityType{m_next_entity++, m_fresh_generation};
+        m_generations.push_back(e.generation());
+    }
+    m_journal.record(m_current_version, e, ChangeJournal::Op::entity_created);
+    return e;
+}
+
+Registry::EntityType Registry::entity_from_index(std::size_t idx) const noexcept {
+    return EntityType::at(&m_generations, idx);
 }
 
-void ecs::Registry::remove_entity_creation_tombstone(EntityType const& e) {
-    if (m_entity_creation_tumbstones.find(e) != m_entity_creation_tumbstones.end())
-        m_entity_creation_tumbstones.erase(e);
+void Registry::release(EntityType const& e) {
+    auto next = static_cast<Entity::GenerationType>(e.generation() + 1);
+    if (next == k_dead_generation)
+        next = 0;
+
+    m_generations_cow.touch(m_generations, e.index());
+    m_generations[e.index()] = k_dead_generation;
+    m_journal.record(m_current_version, e, ChangeJournal::Op::entity_destroyed);
+    m_free_entities_cow.touch(m_free_entities, m_free_entities.size());
+    m_free_entities.push_back(EntityType{e.index(), next});
 }
 
-void ecs::Registry::remove_entity_destruction_tombstone(EntityType const& e) {
-    if (m_entity_destruction_tumbstones.find(e) != m_entity_destruction_tumbstones.end()) {
-        m_entity_destruction_tumbstones.erase(e);
-        remove_entity_components_metadata(e);
+void Registry::kill_entity(EntityType const& e) {
+    if (!alive(e))
+        return;
+    for (auto& group : m_groups)
+        group->leave(static_cast<Entity::IdType>(e));
+    observe_kills(std::span<EntityType const>(&e, 1));
+    for (auto& pool : m_pools) {
+        if (pool)
+            pool->erase(static_cast<Entity::IdType>(e));
     }
+    release(e);
 }
 
-void ecs::Registry::remove_component_destruction_tombstone(EntityType const& e, std::type_index const& ti) {
-    if (m_component_destruction_tombstones.find(e) != m_component_destruction_tombstones.end()
-        && m_component_destruction_tombstones.find(e)->second.find(ti) != m_component_destruction_tombstones.find(e)->second.end()) {
-        m_component_destruction_tombstones.find(e)->second.erase(ti);
-        remove_component_metadata(e, ti);
+std::vector<Registry::EntityType> Registry::spawn_entities(std::size_t count) {
+    std::vector<EntityType> entities;
+    entities.reserve(count);
+
+    const std::size_t k_recycled = std::min(count, m_free_entities.size());
+    entities.insert(entities.end(), m_free_entities.rbegin(), m_free_entities.rbegin() + static_cast<std::ptrdiff_t>(k_recycled));
+    m_free_entities_cow.touch(m_free_entities, m_free_entities.size() - k_recycled, m_free_entities.size());
+    m_free_entities.resize(m_free_entities.size() - k_recycled);
+    for (auto e : entities) {
+        m_generations_cow.touch(m_generations, e.index());
+        m_generations[e.index()] = e.generation();
+    }
+
+    m_generations.reserve(m_generations.size() + count - k_recycled);
+    for (std::size_t i = k_recycled; i < count; i++) {
+        entities.push_back(EntityType{m_next_entity++, m_fresh_generation});
+        m_generations.push_back(entities.back().generation());
+    }
+
+    m_journal.reserve(count);
+    for (auto e : entities)
+        m_journal.record(m_current_version, e, ChangeJournal::Op::entity_created);
+    return entities;
+}
+
+void Registry::kill_entities(std::span<EntityType const> entities) {
+    std::vector<std::size_t> indices;
+    std::vector<EntityType> killed;
+    indices.reserve(entities.size());
+    killed.reserve(entities.size());
+
+    m_journal.reserve(entities.size());
+    for (auto e : entities) {
+        // Released right away so that a handle listed twice is stale the second time
+        if (!alive(e))
+            continue;
+        indices.push_back(e.index());
+        killed.push_back(e);
+        release(e);
+    }
+    observe_kills(killed);
+
+    for (auto& group : m_groups) {
+        for (auto idx : indices)
+            group->leave(idx);
+    }
+    for (auto& pool : m_pools) {
+        if (pool)
+            pool->erase(indices);
     }
 }
 
-void ecs::Registry::remove_component_metadata(EntityType const& e, std::type_index const& ti) {
-    if (m_component_metadata.find({e, ti}) != m_component_metadata.end())
-        m_component_metadata.erase({e, ti});
+std::size_t MemoryReport::total() const noexcept {
+    std::size_t bytes = entity_bytes + journal_bytes;
+    for (auto const& pool : pools)
+        bytes += pool.storage.total();
+    return bytes;
 }
 
-void ecs::Registry::remove_entity_components_metadata(EntityType const& e) {
-    for (auto it = m_component_metadata.begin(); it != m_component_metadata.end(); ) {
-        if (it->first.first == e) {
-            it = m_component_metadata.erase(it);
-        } else {
-            ++it;
-        }
+MemoryReport Registry::memory_report() const {
+    MemoryReport report;
+    report.entity_bytes =
+        m_generations.capacity() * sizeof(Entity::GenerationType) + m_free_entities.capacity() * sizeof(EntityType);
+    report.journal_bytes = m_journal.memory_usage();
+
+    for (ComponentId id = 0; id < m_pools.size(); id++) {
+        if (m_pools[id])
+            report.pools.push_back(MemoryReport::Pool{id, m_pools[id]->type(), m_pools[id]->footprint()});
     }
+    return report;
 }
 
-Registry::EntityType Registry::spawn_entity() {
-    if (!m_free_entities.empty()) {
-        EntityType e = m_free_entities.back();
-        m_free_entities.pop_back();
-        return e;
+std::size_t Registry::memory_usage() const {
+    return memory_report().total();
+}
+
+CompactionReport Registry::compact() {
+    if (!m_checkpoints.empty())
+        throw std::logic_error("Cannot compact a registry while checkpoints are held");
+    dispatch_observers();
+
+    CompactionReport report;
+    report.bytes_before = memory_usage();
+
+    // Ids spanned by the pools can outgrow the entity table through stale handles
+    std::size_t span = m_generations.size();
+    for (auto const& pool : m_pools) {
+        if (pool)
+            span = std::max(span, pool->size());
+    }
+
+    // Above every generation an index had, so that no old handle matches a renumbered entity
+    Entity::GenerationType fresh = m_fresh_generation;
+    for (auto generation : m_generations) {
+        if (generation != k_dead_generation)
+            fresh = std::max<Entity::GenerationType>(fresh, generation + 1);
+    }
+    for (auto e : m_free_entities)
+        fresh = std::max(fresh, e.generation());
+    if (fresh == k_dead_generation)
+        fresh = 0;
+
+    constexpr std::size_t k_no_id = static_cast<std::size_t>(-1);
+    std::vector<std::size_t> new_ids(span, k_no_id);
+    std::vector<EntityMove> moves;
+    std::size_t count = 0;
+
+    for (std::size_t idx = 0; idx < span; idx++) {
+        if (idx < m_generations.size() && m_generations[idx] != k_dead_generation) {
+            if (idx != count)
+                moves.push_back(EntityMove{EntityType{idx, m_generations[idx]}, EntityType{count, fresh}});
+            new_ids[idx] = count++;
+            continue;
+        }
+        // Components left on a dead index (added through a stale handle) have nowhere to go
+        for (auto& pool : m_pools) {
+            if (!pool || !pool->contains(idx))
+                continue;
+            for (auto& group : m_groups)
+                group->leave(idx);
+            pool->erase(idx);
+        }
+    }
+
+    for (auto& pool : m_pools) {
+        if (pool)
+            pool->compact(new_ids, m_current_version);
     }
-    m_entity_creation_tumbstones[EntityType{m_next_entity}] = m_current_version;
-    return EntityType{m_next_entity++};
+    m_journal.reserve(moves.size() * 2);
+    for (auto const& move : moves) {
+        m_generations[move.to.index()] = move.to.generation();
+        m_journal.record(m_current_version, move.from, ChangeJournal::Op::entity_destroyed);
+        m_journal.record(m_current_version, move.to, ChangeJournal::Op::entity_created);
+    }
+    m_generations.resize(count);
+    m_generations.shrink_to_fit();
+    m_free_entities.clear();
+    m_free_entities.shrink_to_fit();
+    m_next_entity = count;
+    m_fresh_generation = fresh;
+
+    report.remap = EntityRemap(std::move(moves));
+    report.entities = count;
+    tag_registry.remap(report.remap);
+    for (auto const& callback : m_compact_observers)
+        callback(*this, report.remap);
+    report.bytes_after = memory_usage();
+    return report;
 }
 
-Registry::EntityType Registry::entity_from_index(std::size_t idx) const noexcept {
-    return EntityType{static_cast<Entity::IdType>(idx)};
+void Registry::on_compact(std::function<void(Registry&, EntityRemap const&)> callback) {
+    m_compact_observers.push_back(std::move(callback));
 }
 
-void Registry::kill_entity(EntityType const& e) {
-    for (auto& fn : m_erase_functions) {
-        if (fn)
-            fn(*this, e);
-    }
-    m_entity_destruction_tumbstones[e] = m_current_version;
-    m_free_entities.push_back(e);
-}
-
-const std::unordered_map<std::type_index, std::any>&
-ecs::Registry::get_entity_components(Entity entity) const noexcept {
-    // Use a thread-local static map to store the result and return by reference
-    thread_local std::unordered_map<std::type_index, std::any> s_entity_components;
-    s_entity_components.clear();
-
-    // Iterate through all registered component types and extract components for this entity
-    for (const auto& [type_idx, component_array] : m_components_arrays) {
-        // Look up the extractor
-        auto extract_it = m_extract_functions.find(type_idx);
-
-        if (extract_it != m_extract_functions.end() && extract_it->second) {
-            auto component = extract_it->second(*this, entity);
-            if (component.has_value()) {
-                s_entity_components[type_idx] = std::move(component.value());
-            }
+void Registry::observe_kills(std::span<EntityType const> killed) {
+    for (auto& pool : m_pools) {
+        auto* observers = pool ? pool->observers() : nullptr;
+        if (observers == nullptr || !observers->observes(ComponentEvent::destroy))
+            continue;
+        for (auto e : killed) {
+            if (pool->contains(e.index()))
+                observers->record(ComponentEvent::destroy, e);
         }
     }
+}
+
+void Registry::dispatch_observers() {
+    // Indexed: callbacks may register new component types
+    for (std::size_t id = 0; id < m_pools.size(); id++) {
+        if (m_pools[id] && m_pools[id]->observers() != nullptr)
+            m_pools[id]->observers()->dispatch(*this);
+    }
+}
+
+void Registry::groups_enter(ComponentId id, std::size_t idx) {
+    for (auto& group : m_groups) {
+        if (group->involves(id))
+            group->enter(idx);
+    }
+}
 
-    return s_entity_components;
+void Registry::groups_leave(ComponentId id, std::size_t idx) {
+    for (auto& group : m_groups) {
+        if (group->involves(id))
+            group->leave(idx);
+    }
 }
 
 TagRegistry& Registry::get_tag_registry() noexcept {
@@ -118,3 +311,117 @@ const TagRegistry& Registry::get_tag_registry() const noexcept {
     return tag_registry;
 }
 
+
+ecs::Checkpoint::Checkpoint(Registry* registry, std::uint64_t id) noexcept : m_registry(registry), m_id(id) {}
+
+ecs::Checkpoint::~Checkpoint() {
+    if (m_registry != nullptr)
+        m_registry->drop_checkpoint(m_id);
+}
+
+ecs::Checkpoint::Checkpoint(Checkpoint&& other) noexcept
+    : m_registry(std::exchange(other.m_registry, nullptr)), m_id(other.m_id) {}
+
+ecs::Checkpoint& ecs::Checkpoint::operator=(Checkpoint&& other) noexcept {
+    if (this != &other) {
+        if (m_registry != nullptr)
+            m_registry->drop_checkpoint(m_id);
+        m_registry = std::exchange(other.m_registry, nullptr);
+        m_id = other.m_id;
+    }
+    return *this;
+}
+
+bool ecs::Checkpoint::valid() const noexcept {
+    return m_registry != nullptr;
+}
+
+Checkpoint Registry::checkpoint() {
+    const std::uint64_t k_id = m_next_checkpoint_id++;
+
+    m_checkpoints.push_back(capture(k_id));
+    return Checkpoint{this, k_id};
+}
+
+std::unique_ptr<Registry::CheckpointState> Registry::capture(std::uint64_t id) {
+    auto state = std::make_unique<CheckpointState>(CheckpointState{
+        id, {}, {}, PageLog<Entity::GenerationType>(m_generations.size()), PageLog<EntityType>(m_free_entities.size()),
+        m_next_entity});
+
+    state->pools.resize(m_pools.size());
+    for (std::size_t pool = 0; pool < m_pools.size(); pool++) {
+        if (m_pools[pool])
+            state->pools[pool] = m_pools[pool]->checkpoint();
+    }
+    state->group_lengths.reserve(m_groups.size());
+    for (auto const& group : m_groups)
+        state->group_lengths.push_back(group->size());
+    m_generations_cow.track(&state->generations);
+    m_free_entities_cow.track(&state->free_entities);
+    return state;
+}
+
+void Registry::restore(Checkpoint const& checkpoint) {
+    auto target = std::find_if(m_checkpoints.begin(), m_checkpoints.end(),
+                               [&checkpoint](auto const& state) { return state->id == checkpoint.m_id; });
+    if (checkpoint.m_registry != this || target == m_checkpoints.end())
+        throw std::invalid_argument("Checkpoint does not belong to this registry");
+
+    // Each state holds the pages changed until the next one: apply them newest first
+    for (auto it = m_checkpoints.end(); it != target;) {
+        auto const& state = **--it;
+
+        for (std::size_t id = 0; id < m_pools.size(); id++) {
+            if (!m_pools[id])
+                continue;
+            if (id < state.pools.size() && state.pools[id])
+                m_pools[id]->restore(*state.pools[id]);
+            else
+                m_pools[id]->clear();
+        }
+        state.generations.restore(m_generations);
+        state.free_entities.restore(m_free_entities);
+        m_next_entity = state.next_entity;
+    }
+    for (std::size_t i = 0; i < m_groups.size(); i++)
+        m_groups[i]->reset(i < (*target)->group_lengths.size() ? (*target)->group_lengths[i] : 0);
+
+    // The pages restored were copied out of the states: start this one afresh and drop the newer ones
+    for (auto it = m_checkpoints.end(); it != target;) {
+        auto& state = **--it;
+        for (std::size_t id = 0; id < state.pools.size(); id++) {
+            if (state.pools[id])
+                m_pools[id]->release(*state.pools[id], nullptr);
+        }
+    }
+    const std::uint64_t k_id = (*target)->id;
+    m_checkpoints.erase(std::next(target), m_checkpoints.end());
+    m_checkpoints.back() = capture(k_id);
+}
+
+void Registry::drop_checkpoint(std::uint64_t id) {
+    auto it = std::find_if(m_checkpoints.begin(), m_checkpoints.end(),
+                           [id](auto const& state) { return state->id == id; });
+    if (it == m_checkpoints.end())
+        return;
+
+    auto& state = **it;
+    CheckpointState* previous = (it == m_checkpoints.begin()) ? nullptr : std::prev(it)->get();
+    const bool k_newest = std::next(it) == m_checkpoints.end();
+
+    for (std::size_t pool = 0; pool < state.pools.size(); pool++) {
+        if (!state.pools[pool])
+            continue;
+        PoolUndo* before = (previous != nullptr && pool < previous->pools.size()) ? previous->pools[pool].get() : nullptr;
+        m_pools[pool]->release(*state.pools[pool], before);
+    }
+    if (previous != nullptr) {
+        state.generations.merge_into(previous->generations);
+        state.free_entities.merge_into(previous->free_entities);
+    }
+    if (k_newest) {
+        m_generations_cow.track(previous != nullptr ? &previous->generations : nullptr);
+        m_free_entities_cow.track(previous != nullptr ? &previous->free_entities : nullptr);
+    }
+    m_checkpoints.erase(it);
+}
@@ -1,28 +1,101 @@
 #pragma once
 
+#include "change_journal.h"
+#include "component_pool.h"
 #include "entity.h"
+#include "entity_remap.h"
+#include "group.h"
+#include "observer.h"
+#include "page_log.h"
 #include "sparse_array.h"
 #include "tag_registry.h"
+#include "view.h"
 
-#include <any>
+#include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <memory>
+#include <memory_resource>
+#include <span>
 #include <stdexcept>
 #include <typeindex>
 #include <unordered_map>
 #include <vector>
 
-// Hash specialization for std::pair<ecs::Entity, std::type_index>
-template <>
-struct std::hash<std::pair<ecs::Entity, std::type_index>> {
-    std::size_t operator()(const std::pair<ecs::Entity, std::type_index>& pair) const noexcept {
-        std::size_t h1 = std::hash<ecs::Entity>{}(pair.first);
-        std::size_t h2 = std::hash<std::type_index>{}(pair.second);
-        // Combine hashes using a simple method
-        return h1 ^ (h2 << 1);
-    }
+namespace ecs {
+
+/// List of component types, e.g. the ones a caller replicates, for `Registry::visit_components`.
+template <typename... TComponents> struct ComponentList {};
+
+/// Storage sizes reached by a registry, replayed with `Registry::reserve` so that the next
+/// registry holding the same content allocates each of its arrays once.
+struct CapacityHints {
+    struct Pool {
+        std::size_t count{0}; ///< Components held.
+        std::size_t size{0};  ///< Id slots spanned.
+    };
+
+    std::size_t entities{0};
+    std::size_t journal{0};
+    /// Indexed by component id.
+    std::vector<Pool> pools;
+
+    /// Keep the largest of both hints for every size.
+    /// @param other Hints to merge in.
+    void merge(CapacityHints const& other);
 };
 
-namespace ecs {
+/// Memory held by a registry, per component pool, see `Registry::memory_report`.
+struct MemoryReport {
+    struct Pool {
+        ComponentId id{0};
+        std::type_index type{typeid(void)};
+        StorageFootprint storage;
+    };
+
+    /// Registered pools, by component id.
+    std::vector<Pool> pools;
+    std::size_t entity_bytes{0};  ///< Generation table and free list.
+    std::size_t journal_bytes{0}; ///< Change journal: destroyed entities and removed components.
+
+    /// @return Bytes held in total.
+    std::size_t total() const noexcept;
+};
+
+/// Outcome of `Registry::compact`.
+struct CompactionReport {
+    /// Entities renumbered, to apply to the handles kept outside the registry.
+    EntityRemap remap;
+    std::size_t entities{0};     ///< Living entities, now numbered `[0, entities)`.
+    std::size_t bytes_before{0}; ///< `Registry::memory_usage` before the compaction.
+    std::size_t bytes_after{0};  ///< `Registry::memory_usage` after the compaction.
+};
+
+class Registry;
+
+/// Handle of a registry checkpoint, see `Registry::checkpoint`. Dropping the handle drops
+/// the checkpoint; it must not outlive its registry.
+class Checkpoint {
+  public:
+    Checkpoint() = default;
+    ~Checkpoint();
+
+    Checkpoint(Checkpoint const&) = delete;
+    Checkpoint& operator=(Checkpoint const&) = delete;
+    Checkpoint(Checkpoint&& other) noexcept;
+    Checkpoint& operator=(Checkpoint&& other) noexcept;
+
+    /// @return False for a default-constructed or moved-from handle.
+    bool valid() const noexcept;
+
+  private:
+    Checkpoint(Registry* registry, std::uint64_t id) noexcept;
+
+    Registry* m_registry{nullptr};
+    std::uint64_t m_id{0};
+
+    friend class Registry;
+};
 
 /// Registry manages entities, component storage and registered systems.
 ///
@@ -30,16 +103,28 @@ namespace ecs {
 ///   arrays (SparseArray).
 /// - Manages entity creation / recycling.
 /// - Allows systems to be registered and executed with bound component views.
-/// - Keeps metadata about creation, destruction & modification of entities and components.
+/// - Journals the creation & destruction of entities and components, and stamps
+///   components with the version they were last written at.
 class Registry {
   public:
     using EntityType = Entity;
-    using Version = std::uint32_t;
-    using ExtractFunction = std::function<std::optional<std::any>(const Registry&, EntityType const&)>;
+    using Version = ecs::Version;
 
-    struct ComponentMetadata {
-        Version version = 0;
-    };
+    /// Build a registry allocating from the default memory resource.
+    Registry();
+
+    /// Build a registry whose component pools, entity table and change journal allocate from
+    /// `resource`, which must outlive the registry.
+    /// @param resource Memory resource, e.g. the arena of the current scene.
+    explicit Registry(std::pmr::memory_resource* resource);
+
+    /// Get the sizes the storage has grown to, to be replayed on a later registry with `reserve`.
+    /// @return The capacity of the entity table, the change journal and every pool.
+    CapacityHints capacity_hints() const;
+
+    /// Pre-allocate the storage from hints. Pools registered later are reserved on creation.
+    /// @param hints Capacities to reserve, usually taken from a previous registry.
+    void reserve(CapacityHints const& hints);
 
     // Component registration / access
     /// Register storage for a component type if not already present.
@@ -57,25 +142,66 @@ class Registry {
     /// @return Const reference to the SparseArray holding `TComponent`.
     template <class TComponent> SparseArray<TComponent> const& get_components() const;
 
+    /// Build a view over the entities owning every component in `TComponents`.
+    /// Const-qualified component types are accessed read-only; the others are stamped with
+    /// the current version as the view hands them out, so they are replicated.
+    /// @tparam TComponents Component types to query.
+    /// @throws std::runtime_error if one of the component types is not registered.
+    /// @return A view yielding `(entity, TComponents&...)`.
+    template <class... TComponents> View<TComponents...> view();
+
+    /// Build a read-only view over the entities owning every component in `TComponents`.
+    /// @tparam TComponents Component types to query.
+    /// @throws std::runtime_error if one of the component types is not registered.
+    /// @return A view yielding `(entity, TComponents const&...)`.
+    template <class... TComponents> View<TComponents const...> view() const;
+
+    /// Get the owning group of the entities holding every component in `TOwned` and `TGet`,
+    /// creating it on first use. The group keeps the `TOwned` pools sorted so that its
+    /// members form a contiguous prefix of each of them; `TGet` pools are only looked up.
+    /// A component type can be owned by a single group. As with `view`, const-qualified types
+    /// are read-only and the others are stamped as they are handed out.
+    /// @tparam TOwned Owned component types (packed storage only).
+    /// @tparam TGet Required but non-owned component types, deduced from the `Get` tag.
+    /// @throws std::logic_error if one of `TOwned` is already owned by another group.
+    /// @return A group yielding `(entity, TOwned&..., TGet&...)`.
+    template <class... TOwned, class... TGet> Group<Owned<TOwned...>, Get<TGet...>> group(Get<TGet...> /*get*/ = {});
+
     // Entity lifecycle
     /// Create a new entity id, reusing freed ids when possible.
     /// @return A new `Entity` handle.
     EntityType spawn_entity();
 
-    /// Convert a raw index to an `Entity` object.
+    /// Get the handle of the entity currently using an index.
     /// @param idx The raw index value.
-    /// @return An `Entity` corresponding to the index.
+    /// @return The `Entity` at that index, with its current generation (not alive if the index is free).
     EntityType entity_from_index(std::size_t idx) const noexcept;
 
-    /// Mark an entity as dead and remove its components.
+    /// Check whether a handle still designates a living entity (single array compare).
+    /// @param e The handle to check.
+    /// @return `false` if the entity was killed, even if its index has been reused since.
+    bool alive(EntityType const& e) const noexcept;
+
+    /// Mark an entity as dead and remove its components. Stale handles are ignored.
     /// @param e The entity to destroy.
     void kill_entity(EntityType const& e);
 
+    /// Create `count` entities at once. Freed ids are reused first; the remaining entities
+    /// get a contiguous block of new ids.
+    /// @param count Number of entities to create.
+    /// @return The new `Entity` handles, recycled ids first.
+    std::vector<EntityType> spawn_entities(std::size_t count);
+
+    /// Destroy several entities, erasing their components pool by pool. Stale handles are ignored.
+    /// @param entities Entities to destroy.
+    void kill_entities(std::span<EntityType const> entities);
+
     // Component management
     /// Add or replace a component instance for the given entity.
     /// @tparam TComponent Component type to add.
     /// @param to Target entity receiving the component.
     /// @param c The component instance to add (moved or copied).
+    /// @throws std::runtime_error if `to` is a stale handle.
     /// @return A reference to the inserted component storage slot.
     template <typename TComponent>
     typename SparseArray<TComponent>::ReferenceType add_component(EntityType const& to, TComponent&& c);
@@ -85,27 +211,75 @@ class Registry {
     /// @tparam TParams Constructor parameter pack forwarded to TComponent.
     /// @param to Target entity receiving the component.
     /// @param p Parameters forwarded to TComponent's constructor.
+    /// @throws std::runtime_error if `to` is a stale handle.
     /// @return A reference to the emplaced component storage slot.
     template <typename TComponent, typename... TParams>
     typename SparseArray<TComponent>::ReferenceType emplace_component(EntityType const& to, TParams&&... p);
 
-    /// Remove the component of type `TComponent` from an entity.
+    /// Add a component to each entity of a batch, growing the pool once.
+    /// @tparam TComponent Component type to add.
+    /// @param to Target entities.
+    /// @param values One component per target entity, copied in.
+    /// @throws std::runtime_error if any handle is stale; nothing is inserted then.
+    template <typename TComponent>
+    void add_components(std::span<EntityType const> to, std::span<TComponent const> values);
+
+    /// Construct the same component for each entity of a batch, growing the pool once.
+    /// @tparam TComponent Component type to emplace.
+    /// @tparam TParams Constructor parameters, shared by every constructed component.
+    /// @param to Target entities.
+    /// @param p Parameters passed to TComponent's constructor for each entity.
+    /// @throws std::runtime_error if any handle is stale; nothing is inserted then.
+    template <typename TComponent, typename... TParams>
+    void emplace_components(std::span<EntityType const> to, TParams const&... p);
+
+    /// Remove the component of type `TComponent` from an entity. Stale handles are ignored.
     /// @tparam TComponent Component type to remove.
     /// @param from Entity from which the component will be removed.
     template <typename TComponent> void remove_component(EntityType const& from);
 
+    /// Get the component of an entity for writing. The component is stamped with the current
+    /// version, so it is replicated without calling `mark_dirty`.
+    /// @tparam TComponent Component type to access.
+    /// @param e The entity owning the component.
+    /// @throws std::runtime_error if the handle is stale, the component type is not registered or the entity has none.
+    /// @return Reference to the component.
+    template <typename TComponent> TComponent& get_component(EntityType const& e);
+
+    /// Read the component of an entity. Const access does not stamp the component.
+    /// @tparam TComponent Component type to access.
+    /// @param e The entity owning the component.
+    /// @throws std::runtime_error if the handle is stale, the component type is not registered or the entity has none.
+    /// @return Const reference to the component.
+    template <typename TComponent> TComponent const& get_component(EntityType const& e) const;
+
+    /// Modify the component of an entity in place and stamp it with the current version.
+    /// @tparam TComponent Component type to modify.
+    /// @param e The entity owning the component.
+    /// @param fn Callable invoked with `TComponent&`.
+    /// @throws std::runtime_error if the handle is stale, the component type is not registered or the entity has none.
+    /// @return What `fn` returns.
+    template <typename TComponent, typename TFunction> decltype(auto) patch(EntityType const& e, TFunction&& fn);
+
     /// Check if an entity has a component of type `TComponent`.
     /// @tparam TComponent Component type to check.
     /// @param entity The entity to check.
-    /// @return `true` if the entity has the component, `false` otherwise.
+    /// @return `true` if the entity is alive and has the component, `false` otherwise.
     template <typename TComponent> bool has_component(EntityType const& entity) const;
 
-    /// Dump all components stored in the registry for a given entity.
-    /// @tparam Entity The entity whose components to retrieve.
-    /// @param entity The entity whose components to retrieve.
-    /// @return A const reference to a map of component type_index to storage any which contains all components.
-    const std::unordered_map<std::type_index, std::any>& get_entity_components(Entity entity) const noexcept;
+    /// Call `visitor(component)` with a const reference to each component of `e` whose type is
+    /// listed in `TComponents`, in list order. Nothing is copied or allocated: the dispatch is
+    /// resolved at compile time over the listed types only.
+    /// @tparam TComponents Component types to look for; unregistered ones are skipped.
+    /// @param e The entity whose components to visit (none for a stale handle).
+    /// @param visitor Generic callable, invoked once per present component.
+    template <class... TComponents, class TVisitor> void visit_components(EntityType const& e, TVisitor&& visitor) const;
 
+    /// Same as above, taking the component types as a `ComponentList`.
+    /// @param e The entity whose components to visit.
+    /// @param visitor Generic callable, invoked once per present component.
+    template <class... TComponents, class TVisitor>
+    void visit_components(EntityType const& e, ComponentList<TComponents...> /*types*/, TVisitor&& visitor) const;
 
     /// Get the tag registry (non-const).
     /// @return Reference to the tag registry.
@@ -123,71 +297,196 @@ class Registry {
     /// @return The current version.
     Version get_current_version() const noexcept;
 
-    /// Mark an entitie's component has dirty
-    /// This must be called each time you modify a component you need to track (eg. for networking).
+    /// Mark an entitie's component has dirty by stamping it with the current version.
+    /// Components written through `get_component`, `patch`, views or groups are stamped already;
+    /// this is for the ones modified through zippers or the pools themselves.
+    /// Safe to call from systems running concurrently on distinct entities. Stale handles are ignored.
     /// @param e The entity whose component is dirty.
     /// @tparam TComponent The component type to mark as dirty.
     template <typename TComponent>
     void mark_dirty(EntityType const& e);
 
-    const std::unordered_map<EntityType, Version>& get_entity_creation_tombstones() const noexcept;
-    const std::unordered_map<EntityType, Version>& get_entity_destruction_tombstones() const noexcept;
-    const std::unordered_map<EntityType,
-        std::unordered_map<std::type_index, Version>>&
-        get_component_destruction_tombstones() const noexcept;
-    const std::unordered_map<std::pair<EntityType, std::type_index>, Version>&
-        get_component_metadata() const noexcept;
-
-    /// Must be called when the tombstone is no longer needed to save up RAM
-    void remove_entity_creation_tombstone(EntityType const& e);
-    /// Must be called when the tombstone is no longer needed to save up RAM
-    /// Also delete the entity's component's metadatas entry
-    void remove_entity_destruction_tombstone(EntityType const& e);
-    /// Must be called when the tombstone is no longer needed to save up RAM
-    /// Also delete the component's metadatas entry
-    void remove_component_destruction_tombstone(EntityType const& e, std::type_index const& ti);
-    /// Remove an entity's component metadatas entry
-    void remove_component_metadata(EntityType const& e, std::type_index const& ti);
+    /// Call `fn(type, indices)` for every registered component type, with the indices of the
+    /// entities whose component was stamped after `since`. Each pool is scanned linearly.
+    /// @param since Last version already known by the caller.
+    /// @param fn Callable taking `(std::type_index, std::span<std::size_t const>)`.
+    template <typename TFunction> void each_changed(Version since, TFunction&& fn) const;
+
+    /// Get the journal of the entity creations & destructions and component removals, in version order.
+    /// @return Const reference to the change journal.
+    const ChangeJournal& get_change_journal() const noexcept;
+
+    /// Drop the journaled changes every reader already knows about, to save up RAM.
+    /// @param acknowledged Changes up to and including this version are discarded.
+    void trim_change_journal(Version acknowledged);
+
+    /// Get the runtime type of a registered component.
+    /// @param id The component id, as found in the change journal.
+    /// @throws std::out_of_range if no component is registered under `id`.
+    /// @return The `std::type_index` of the component type.
+    std::type_index component_type(ComponentId id) const;
+
+    // Memory
+    /// Sizes and bytes held by each pool, the entity tables and the change journal, reserved
+    /// capacity included. Meant for diagnostics: it walks every pool and page table.
+    /// @return The report, pools ordered by component id.
+    MemoryReport memory_report() const;
+
+    /// Bytes held by the storage of the registry: pools, entity tables and change journal,
+    /// reserved capacity included. Memory given back to an arena is only reused after its reset.
+    /// @return The footprint in bytes, `memory_report().total()`.
+    std::size_t memory_usage() const;
+
+    // Compaction
+
+    /// Renumber the living entities into `[0, count)`, keeping their order, then shrink the
+    /// pools, the entity table and the free list to that range. Meant to run between waves,
+    /// once a burst of short-lived entities left the pools sized for its peak.
+    ///
+    /// Renumbered entities get a new generation, so that their old handles and the ones of
+    /// dead entities stay stale. Each move is journaled as a destruction followed by a creation,
+    /// and the moved components are stamped, so replication sees the new ids. The tag registry
+    /// is remapped; the other holders of handles apply the returned table, or subscribe with
+    /// `on_compact`. Pending observer events are dispatched first.
+    /// Must not run while systems run.
+    /// @throws std::logic_error if a checkpoint is held.
+    /// @return The renumbering and the memory footprint before and after.
+    CompactionReport compact();
+
+    /// Call `callback(registry, remap)` after every compaction.
+    /// @param callback Callable taking `(Registry&, EntityRemap const&)`.
+    void on_compact(std::function<void(Registry&, EntityRemap const&)> callback);
+
+    // Observers
+    /// Call `callback(registry, entities)` with the entities that got a `TComponent`, in batches
+    /// delivered by `dispatch_observers`. Observers live as long as the registry; they must
+    /// not be connected while systems run. Types without observers raise no event.
+    /// @tparam TComponent Component type to observe.
+    /// @param callback Callable taking `(Registry&, std::span<Entity const>)`.
+    template <class TComponent> void on_construct(ComponentObservers::Callback callback);
+
+    /// Same as `on_construct`, for the entities whose `TComponent` was replaced or written
+    /// through `get_component`, `patch` or `mark_dirty`. Writes through views, groups and zippers
+    /// raise no event.
+    /// @tparam TComponent Component type to observe.
+    /// @param callback Callable taking `(Registry&, std::span<Entity const>)`.
+    template <class TComponent> void on_update(ComponentObservers::Callback callback);
+
+    /// Same as `on_construct`, for the entities that lost their `TComponent`, either removed or
+    /// killed. The entities may be dead by the time the batch is delivered.
+    /// @tparam TComponent Component type to observe.
+    /// @param callback Callable taking `(Registry&, std::span<Entity const>)`.
+    template <class TComponent> void on_destroy(ComponentObservers::Callback callback);
+
+    /// Deliver the events queued since the last call, pool by pool. This is the sync point of
+    /// the observers: call it once the systems and command buffers of a frame are done.
+    /// Events raised by the callbacks are delivered on the next call. Restoring a checkpoint
+    /// raises no event.
+    void dispatch_observers();
+
+    // Checkpoints
+    /// Remember the current entities and components, to come back to them with `restore`.
+    ///
+    /// Taking a checkpoint costs O(pools): nothing is copied until a page (64 slots) of an array
+    /// is first written, then only that page. The version counter, the change journal and the
+    /// tags are not part of a checkpoint. Checkpoints must not be taken or restored while
+    /// systems run, and references obtained before a checkpoint must not be written through after it.
+    /// @throws std::logic_error if a registered component type cannot be copied.
+    /// @return The handle of the checkpoint, dropping it when destroyed.
+    Checkpoint checkpoint();
+
+    /// Roll the entities and components back to a checkpoint, copying back the pages changed
+    /// since. Newer checkpoints are dropped; this one stays valid and can be restored again.
+    /// Pools registered after the checkpoint are emptied.
+    /// @param checkpoint A checkpoint of this registry.
+    /// @throws std::invalid_argument if the handle does not belong to this registry.
+    void restore(Checkpoint const& checkpoint);
 
   private:
+    // backs the pools, the entity tables and the journal
+    std::pmr::memory_resource* m_resource;
+    // pool capacities to reserve on registration, indexed by component id
+    std::vector<CapacityHints::Pool> m_pool_hints;
+
     // Tag registry
     TagRegistry tag_registry;
 
-    // one sparse array per component type, stored via type erasure
-    std::unordered_map<std::type_index, std::any> m_components_arrays;
+    // one sparse array per component type, indexed by component id (null if not registered)
+    std::vector<std::unique_ptr<IComponentPool>> m_pools;
 
-    // erase callbacks (one per component type)
-    std::vector<std::function<void(Registry&, EntityType const&)>> m_erase_functions;
-
-    // component extraction callbacks (one per component type)
-    std::unordered_map<std::type_index, ExtractFunction> m_extract_functions;
-    // It needs to be an unordered_map to allow iteration along with the m_components_array
-    // in the method 'get_entity_components()'
+    // owning groups, notified of every structural change of the pools they involve
+    std::vector<std::unique_ptr<IGroupHandler>> m_groups;
 
     // registered systems
     std::vector<std::function<void(Registry&)>> m_systems;
 
     // entity id management
     Entity::IdType m_next_entity{0};
-    std::vector<EntityType> m_free_entities;
+    // freed indices, already carrying the generation of their next entity
+    std::pmr::vector<EntityType> m_free_entities;
+    // generation of the entities given a new index, above every generation used before a compaction
+    Entity::GenerationType m_fresh_generation{0};
+    std::vector<std::function<void(Registry&, EntityRemap const&)>> m_compact_observers;
+    // current generation per index, `k_dead_generation` while the index is free
+    Entity::GenerationTable m_generations;
+
+    static constexpr Entity::GenerationType k_dead_generation = static_cast<Entity::GenerationType>(-1);
+
+    /// Free the index of a living entity and hand it to the free list with its next generation.
+    void release(EntityType const& e);
+    /// Throw if `e` is not alive, so that a stale handle never touches the entity reusing its index.
+    void expect_alive(EntityType const& e) const;
 
     // Current version counter
     Version m_current_version = 1; // The 0 is reserved for error values
 
-    // Tumbstones to track created entities
-    std::unordered_map<EntityType, Version> m_entity_creation_tumbstones;
-    // Tumbstones to track destroyed entities
-    std::unordered_map<EntityType, Version> m_entity_destruction_tumbstones;
-    // Tumbstones to track destroyed components per entity
-    std::unordered_map<EntityType,
-        std::unordered_map<std::type_index, Version>>
-        m_component_destruction_tombstones;
+    // Creations & destructions of entities and components
+    ChangeJournal m_journal;
+
+    /// Let the groups involving component `id` pull entity `idx` in.
+    void groups_enter(ComponentId id, std::size_t idx);
+    /// Let the groups involving component `id` push entity `idx` out.
+    void groups_leave(ComponentId id, std::size_t idx);
+
+    /// Register `TComponent` and reserve its pool for the batch `to`, then insert
+    /// `insert(array, idx, i)` for the i-th entity of the batch.
+    template <typename TComponent, typename TInsert>
+    void insert_components(std::span<EntityType const> to, TInsert&& insert);
+
+    // Pages saved since a checkpoint, up to the next one
+    struct CheckpointState {
+        std::uint64_t id;
+        // indexed by component id, null for pools registered afterwards
+        std::vector<std::unique_ptr<PoolUndo>> pools;
+        std::vector<std::size_t> group_lengths;
+        PageLog<Entity::GenerationType> generations;
+        PageLog<EntityType> free_entities;
+        Entity::IdType next_entity;
+    };
+
+    // oldest first, the newest one being written to
+    std::vector<std::unique_ptr<CheckpointState>> m_checkpoints;
+    std::uint64_t m_next_checkpoint_id{1};
+    PageTracker<Entity::GenerationType> m_generations_cow;
+    PageTracker<EntityType> m_free_entities_cow;
+
+    /// Start logging into a new state, which becomes the newest one.
+    std::unique_ptr<CheckpointState> capture(std::uint64_t id);
+    /// Hand the pages of a state over to the one before it and destroy it.
+    void drop_checkpoint(std::uint64_t id);
+
+    friend class Checkpoint;
+
+    /// Get the pool of `TComponent`.
+    /// @return The pool, or `nullptr` if the component is not registered.
+    template <class TComponent> ComponentPool<TComponent>* find_pool() const noexcept;
 
-    // Last version in which an entity's component has changed/been created
-    std::unordered_map<std::pair<EntityType, std::type_index>, Version> m_component_metadata;
+    /// Get the pool of `TComponent`, registering it if needed.
+    template <class TComponent> ComponentPool<TComponent>& assure_pool();
 
-    /// Remove all of an entity's components metadatas entries
-    void remove_entity_components_metadata(EntityType const& e);
+    /// Queue the destroy events of the components of killed entities.
+    /// @param killed Entities about to lose their components.
+    void observe_kills(std::span<EntityType const> killed);
 };
 
 } // namespace ecs
@@ -4,69 +4,157 @@
 
 namespace ecs {
 
-/// Set current version (Used to track changes).
-/// @param v The new version to set.
+/// Stamp the component slot: a plain store, so distinct entities can be marked concurrently.
+/// @param e The entity whose component is dirty.
 template <typename TComponent> inline void Registry::mark_dirty(EntityType const& e) {
-    m_component_metadata[{e, std::type_index(typeid(TComponent))}] = m_current_version;
+    auto* pool = find_pool<TComponent>();
+    if (pool == nullptr || !alive(e))
+        return;
+    pool->array().stamp(static_cast<Entity::IdType>(e), m_current_version);
+    if (auto* observers = pool->observers(); observers != nullptr && pool->array().contains(static_cast<Entity::IdType>(e)))
+        observers->record(ComponentEvent::update, e);
+}
+
+/// Scan the stamps of every pool, reusing one index buffer.
+/// @param since Last version already known by the caller.
+/// @param fn Callable taking `(std::type_index, std::span<std::size_t const>)`.
+template <typename TFunction> void Registry::each_changed(Version since, TFunction&& fn) const {
+    std::vector<std::size_t> indices;
+
+    for (auto const& pool : m_pools) {
+        if (!pool)
+            continue;
+        indices.clear();
+        pool->changed_since(since, indices);
+        if (!indices.empty())
+            fn(pool->type(), std::span<std::size_t const>(indices));
+    }
+}
+
+/// Compare the handle generation with the one of its index.
+/// @param e The handle to check.
+inline bool Registry::alive(EntityType const& e) const noexcept {
+    return e.generation() != k_dead_generation && e.index() < m_generations.size() &&
+           m_generations[e.index()] == e.generation();
+}
+
+/// Reject a handle whose index was freed, or reused by another entity since.
+/// @param e The handle to check.
+/// @throws std::runtime_error if the entity is not alive.
+inline void Registry::expect_alive(EntityType const& e) const {
+    if (!alive(e))
+        throw std::runtime_error("Stale entity handle");
+}
+
+/// Look up the pool of `TComponent` by its component id.
+/// @tparam TComponent The component type to look up.
+/// @return The pool, or `nullptr` if the component is not registered.
+template <class TComponent> inline ComponentPool<TComponent>* Registry::find_pool() const noexcept {
+    const auto k_id = component_id<TComponent>();
+    if (k_id >= m_pools.size() || !m_pools[k_id])
+        return nullptr;
+    return static_cast<ComponentPool<TComponent>*>(m_pools[k_id].get());
 }
 
 /// Ensure storage exists for `Component` and return a reference to it.
 /// @tparam TComponent The component type to register/access.
 /// @return Reference to the corresponding `SparseArray<TComponent>`.
 template <class TComponent> SparseArray<TComponent>& Registry::register_component() {
-    const auto k_key = std::type_index(typeid(TComponent));
-    auto it = m_components_arrays.find(k_key);
-
-    if (it == m_components_arrays.end()) {
-        auto [new_it, inserted] = m_components_arrays.emplace(k_key, std::any(SparseArray<TComponent>{}));
-
-        m_erase_functions.emplace_back([](Registry& reg, EntityType const& e) {
-            auto& arr = reg.get_components<TComponent>();
-            arr.erase(static_cast<typename SparseArray<TComponent>::SizeType>(static_cast<Entity::IdType>(e)));
-        });
-
-        // Add extraction function for get_entity_components
-        m_extract_functions[k_key] = ([k_key](const Registry& reg, EntityType const& e) -> std::optional<std::any> {
-            try {
-                const auto& arr = reg.get_components<TComponent>();
-                auto idx = static_cast<typename SparseArray<TComponent>::SizeType>(static_cast<Entity::IdType>(e));
-                if (idx >= arr.size() || !arr[idx].has_value()) {
-                    return std::nullopt;
-                }
-                return std::make_any<TComponent>(arr[idx].value());
-            } catch (...) {
-                return std::nullopt;
-            }
-        });
-
-        return std::any_cast<SparseArray<TComponent>&>(new_it->second);
+    return assure_pool<TComponent>().array();
+}
+
+/// Create the pool of `TComponent` on first use, reserved from the capacity hints.
+/// @tparam TComponent The component type to register.
+template <class TComponent> ComponentPool<TComponent>& Registry::assure_pool() {
+    const auto k_id = component_id<TComponent>();
+
+    if (k_id >= m_pools.size())
+        m_pools.resize(k_id + 1);
+    if (!m_pools[k_id]) {
+        m_pools[k_id] = std::make_unique<ComponentPool<TComponent>>(m_resource);
+        if (k_id < m_pool_hints.size())
+            m_pools[k_id]->reserve(m_pool_hints[k_id].count, m_pool_hints[k_id].size);
     }
 
-    return std::any_cast<SparseArray<TComponent>&>(it->second);
+    return static_cast<ComponentPool<TComponent>&>(*m_pools[k_id]);
+}
+
+template <class TComponent> void Registry::on_construct(ComponentObservers::Callback callback) {
+    assure_pool<TComponent>().observe().connect(ComponentEvent::construct, std::move(callback));
+}
+
+template <class TComponent> void Registry::on_update(ComponentObservers::Callback callback) {
+    assure_pool<TComponent>().observe().connect(ComponentEvent::update, std::move(callback));
+}
+
+template <class TComponent> void Registry::on_destroy(ComponentObservers::Callback callback) {
+    assure_pool<TComponent>().observe().connect(ComponentEvent::destroy, std::move(callback));
 }
 
 /// Access the non-const component storage for `TComponent`.
 /// @tparam TComponent The component type to access.
 /// @throws std::runtime_error if the component type is not registered.
 template <class TComponent> SparseArray<TComponent>& Registry::get_components() {
-    const auto k_key = std::type_index(typeid(TComponent));
-    auto it = m_components_arrays.find(k_key);
-    if (it == m_components_arrays.end())
+    auto* pool = find_pool<TComponent>();
+    if (pool == nullptr)
         throw std::runtime_error("Component not registered");
 
-    return std::any_cast<SparseArray<TComponent>&>(it->second);
+    return pool->array();
 }
 
 /// Access the const component storage for `TComponent`.
 /// @tparam TComponent The component type to access.
 /// @throws std::runtime_error if the component type is not registered.
 template <class TComponent> SparseArray<TComponent> const& Registry::get_components() const {
-    const auto k_key = std::type_index(typeid(TComponent));
-    auto it = m_components_arrays.find(k_key);
-    if (it == m_components_arrays.end())
+    const auto* pool = find_pool<TComponent>();
+    if (pool == nullptr)
         throw std::runtime_error("Component not registered");
 
-    return std::any_cast<SparseArray<TComponent> const&>(it->second);
+    return pool->array();
+}
+
+/// Build a view over the entities owning every component in `TComponents`, stamping the
+/// non-const ones with the current version as they are handed out.
+/// @tparam TComponents Component types to query, const-qualified for read-only access.
+/// @throws std::runtime_error if one of the component types is not registered.
+template <class... TComponents> View<TComponents...> Registry::view() {
+    return View<TComponents...>(m_generations, m_current_version,
+                                get_components<std::remove_const_t<TComponents>>()...);
+}
+
+/// Build a read-only view over the entities owning every component in `TComponents`.
+/// @tparam TComponents Component types to query.
+/// @throws std::runtime_error if one of the component types is not registered.
+template <class... TComponents> View<TComponents const...> Registry::view() const {
+    return View<TComponents const...>(m_generations, get_components<std::remove_const_t<TComponents>>()...);
+}
+
+/// Get (or create) the owning group of `TOwned` with the required `TGet` components. The
+/// constness of the types only affects the returned group, which stamps the non-const ones.
+/// @tparam TOwned Owned component types.
+/// @tparam TGet Required but non-owned component types.
+/// @throws std::logic_error if one of `TOwned` is already owned by another group.
+template <class... TOwned, class... TGet>
+Group<Owned<TOwned...>, Get<TGet...>> Registry::group(Get<TGet...> /*get*/) {
+    using GroupType = Group<Owned<TOwned...>, Get<TGet...>>;
+    using HandlerType = typename GroupType::HandlerType;
+
+    for (auto const& handler : m_groups) {
+        if (auto const* existing = dynamic_cast<HandlerType const*>(handler.get()))
+            return GroupType(*existing, m_current_version);
+    }
+    for (auto const& handler : m_groups) {
+        if ((handler->owns(component_id<TOwned>()) || ...))
+            throw std::logic_error("Component already owned by another group");
+    }
+
+    auto handler = std::make_unique<HandlerType>(std::make_tuple(&register_component<std::remove_const_t<TOwned>>()...),
+                                                 std::make_tuple(&register_component<std::remove_const_t<TGet>>()...),
+                                                 &m_generations);
+    handler->refresh();
+    auto const& ref = *handler;
+    m_groups.push_back(std::move(handler));
+    return GroupType(ref, m_current_version);
 }
 
 /// Add or replace a component instance for the given entity.
@@ -76,13 +164,20 @@ template <class TComponent> SparseArray<TComponent> const& Registry::get_compone
 /// @return Reference to the inserted component slot.
 template <typename TComponent>
 typename SparseArray<TComponent>::ReferenceType Registry::add_component(EntityType const& to, TComponent&& c) {
-    register_component<TComponent>();
-    auto& arr = get_components<TComponent>();
+    expect_alive(to);
+    auto& pool = assure_pool<TComponent>();
+    auto& arr = pool.array();
     auto idx = static_cast<typename SparseArray<TComponent>::SizeType>(static_cast<Entity::IdType>(to));
+    auto* observers = pool.observers();
+    const bool k_replaced = observers != nullptr && arr.contains(idx);
 
-    m_component_metadata[{to, std::type_index(typeid(TComponent))}] = m_current_version;
-
-    return arr.insert_at(idx, std::forward<TComponent>(c));
+    arr.insert_at(idx, std::forward<TComponent>(c));
+    arr.stamp(idx, m_current_version);
+    if (!m_groups.empty())
+        groups_enter(component_id<TComponent>(), idx);
+    if (observers != nullptr)
+        observers->record(k_replaced ? ComponentEvent::update : ComponentEvent::construct, to);
+    return arr[idx];
 }
 
 /// Emplace-construct a component for the entity in-place.
@@ -91,33 +186,172 @@ typename SparseArray<TComponent>::ReferenceType Registry::add_component(EntityTy
 /// @param to Target entity receiving the component.
 template <typename TComponent, typename... TParams>
 typename SparseArray<TComponent>::ReferenceType Registry::emplace_component(EntityType const& to, TParams&&... p) {
-    register_component<TComponent>();
-    auto& arr = get_components<TComponent>();
+    expect_alive(to);
+    auto& pool = assure_pool<TComponent>();
+    auto& arr = pool.array();
     auto idx = static_cast<typename SparseArray<TComponent>::SizeType>(static_cast<Entity::IdType>(to));
+    auto* observers = pool.observers();
+    const bool k_replaced = observers != nullptr && arr.contains(idx);
+
+    arr.emplace_at(idx, std::forward<TParams>(p)...);
+    arr.stamp(idx, m_current_version);
+    if (!m_groups.empty())
+        groups_enter(component_id<TComponent>(), idx);
+    if (observers != nullptr)
+        observers->record(k_replaced ? ComponentEvent::update : ComponentEvent::construct, to);
+    return arr[idx];
+}
+
+/// Add one component per entity of a batch.
+/// @tparam TComponent Component type to add.
+/// @param to Target entities.
+/// @param values Components, `values[i]` going to `to[i]`.
+template <typename TComponent>
+void Registry::add_components(std::span<EntityType const> to, std::span<TComponent const> values) {
+    insert_components<TComponent>(to, [values](auto& arr, auto idx, std::size_t i) { arr.insert_at(idx, values[i]); });
+}
+
+/// Construct the same component for every entity of a batch.
+/// @tparam TComponent Component type to emplace.
+/// @tparam TParams Constructor parameters forwarded (by const reference) to every component.
+/// @param to Target entities.
+template <typename TComponent, typename... TParams>
+void Registry::emplace_components(std::span<EntityType const> to, TParams const&... p) {
+    insert_components<TComponent>(to, [&p...](auto& arr, auto idx, std::size_t /*i*/) { arr.emplace_at(idx, p...); });
+}
+
+/// Grow the pool and the group memberships once for the whole batch.
+/// @tparam TComponent Component type to insert.
+/// @param to Target entities.
+/// @param insert Callable inserting the component of the i-th entity.
+template <typename TComponent, typename TInsert>
+void Registry::insert_components(std::span<EntityType const> to, TInsert&& insert) {
+    using SizeType = typename SparseArray<TComponent>::SizeType;
+    // Checked up front so that a stale handle leaves the batch untouched
+    for (auto e : to)
+        expect_alive(e);
+    auto& pool = assure_pool<TComponent>();
+    auto& arr = pool.array();
+    auto* observers = pool.observers();
+    const auto k_id = component_id<TComponent>();
 
-    m_component_metadata[{to, std::type_index(typeid(TComponent))}] = m_current_version;
+    SizeType size = arr.size();
+    for (auto e : to)
+        size = std::max(size, static_cast<SizeType>(static_cast<Entity::IdType>(e)) + 1);
+    arr.reserve(arr.count() + to.size(), size);
 
-    return arr.emplace_at(idx, std::forward<TParams>(p)...);
+    for (std::size_t i = 0; i < to.size(); i++) {
+        auto idx = static_cast<SizeType>(static_cast<Entity::IdType>(to[i]));
+        const bool k_replaced = observers != nullptr && arr.contains(idx);
+
+        insert(arr, idx, i);
+        arr.stamp(idx, m_current_version);
+        if (observers != nullptr)
+            observers->record(k_replaced ? ComponentEvent::update : ComponentEvent::construct, to[i]);
+    }
+    if (!m_groups.empty()) {
+        for (auto e : to)
+            groups_enter(k_id, static_cast<Entity::IdType>(e));
+    }
 }
 
 /// Remove the component of type `TComponent` from an entity.
 /// @tparam TComponent Component type to remove.
 /// @param from Entity from which the component will be removed.
 template <typename TComponent> void Registry::remove_component(EntityType const& from) {
-    auto& arr = get_components<TComponent>();
+    auto* pool = find_pool<TComponent>();
+    if (pool == nullptr)
+        throw std::runtime_error("Component not registered");
+    // Like kill_entity: the entity of a stale handle is already gone
+    if (!alive(from))
+        return;
+    auto& arr = pool->array();
     auto idx = static_cast<typename SparseArray<TComponent>::SizeType>(static_cast<Entity::IdType>(from));
 
-    m_component_destruction_tombstones[from][std::type_index(typeid(TComponent))] = m_current_version;
+    if (!arr.contains(idx))
+        return;
+    if (auto* observers = pool->observers())
+        observers->record(ComponentEvent::destroy, from);
+    m_journal.record(m_current_version, from, ChangeJournal::Op::component_removed, component_id<TComponent>());
 
+    if (!m_groups.empty())
+        groups_leave(component_id<TComponent>(), idx);
     arr.erase(idx);
 }
 
+/// Fold over the listed types, looking each pool up by component id.
+/// @param e The entity whose components to visit.
+/// @param visitor Generic callable, invoked with `TComponent const&`.
+template <class... TComponents, class TVisitor>
+void Registry::visit_components(EntityType const& e, TVisitor&& visitor) const {
+    if (!alive(e))
+        return;
+    const auto k_idx = static_cast<Entity::IdType>(e);
+    auto visit = [k_idx, &visitor](auto const* pool) {
+        if (pool != nullptr && pool->array().contains(k_idx))
+            visitor(*pool->array()[k_idx]);
+    };
+
+    // Pools are stored unqualified: `T const` must not be cast to a `ComponentPool<T const>`
+    (visit(find_pool<std::remove_cvref_t<TComponents>>()), ...);
+}
+
+/// Unpack a `ComponentList` into the explicit overload.
+/// @param e The entity whose components to visit.
+/// @param visitor Generic callable, invoked with `TComponent const&`.
+template <class... TComponents, class TVisitor>
+void Registry::visit_components(EntityType const& e, ComponentList<TComponents...> /*types*/, TVisitor&& visitor) const {
+    visit_components<TComponents...>(e, std::forward<TVisitor>(visitor));
+}
+
+/// Get the component of an entity for writing, stamping it with the current version.
+/// @tparam TComponent Component type to access.
+/// @param e The entity owning the component.
+/// @throws std::runtime_error if the handle is stale, the component type is not registered or the entity has none.
+template <typename TComponent> TComponent& Registry::get_component(EntityType const& e) {
+    expect_alive(e);
+    auto* pool = find_pool<TComponent>();
+    if (pool == nullptr)
+        throw std::runtime_error("Component not registered");
+    auto& arr = pool->array();
+    auto idx = static_cast<typename SparseArray<TComponent>::SizeType>(static_cast<Entity::IdType>(e));
+
+    if (!arr.contains(idx))
+        throw std::runtime_error("Entity has no such component");
+    arr.stamp(idx, m_current_version);
+    if (auto* observers = pool->observers())
+        observers->record(ComponentEvent::update, e);
+    return *arr[idx];
+}
+
+/// Read the component of an entity, leaving its stamp untouched.
+/// @tparam TComponent Component type to access.
+/// @param e The entity owning the component.
+/// @throws std::runtime_error if the handle is stale, the component type is not registered or the entity has none.
+template <typename TComponent> TComponent const& Registry::get_component(EntityType const& e) const {
+    expect_alive(e);
+    const auto& arr = get_components<TComponent>();
+    auto idx = static_cast<typename SparseArray<TComponent>::SizeType>(static_cast<Entity::IdType>(e));
+
+    if (!arr.contains(idx))
+        throw std::runtime_error("Entity has no such component");
+    return *arr[idx];
+}
+
+/// Modify the component of an entity in place and stamp it.
+/// @tparam TComponent Component type to modify.
+/// @param e The entity owning the component.
+/// @param fn Callable invoked with `TComponent&`.
+template <typename TComponent, typename TFunction> decltype(auto) Registry::patch(EntityType const& e, TFunction&& fn) {
+    return std::invoke(std::forward<TFunction>(fn), get_component<TComponent>(e));
+}
+
 template <typename TComponent> inline bool Registry::has_component(EntityType const& entity) const {
+    if (!alive(entity))
+        return false;
     const auto& arr = get_components<TComponent>();
     auto idx = static_cast<typename SparseArray<TComponent>::SizeType>(static_cast<Entity::IdType>(entity));
-    if (idx >= arr.size())
-        return false;
-    return arr[idx].has_value();
+    return arr.contains(idx);
 }
 
 } // namespace ecs
@@ -0,0 +1,157 @@
+#include "scheduler.h"
+
+#include "command_buffer.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+
+namespace {
+
+bool on_main_thread(ecs::SystemPolicy policy) noexcept {
+    return policy != ecs::SystemPolicy::Parallel;
+}
+
+bool intersects(std::vector<ecs::ComponentId> const& lhs, std::vector<ecs::ComponentId> const& rhs) noexcept {
+    return std::any_of(lhs.begin(), lhs.end(),
+                       [&rhs](ecs::ComponentId id) { return std::find(rhs.begin(), rhs.end(), id) != rhs.end(); });
+}
+
+} // namespace
+
+bool ecs::SystemAccess::conflicts_with(SystemAccess const& other) const noexcept {
+    if (policy == SystemPolicy::Exclusive || other.policy == SystemPolicy::Exclusive)
+        return true;
+    if (on_main_thread(policy) && on_main_thread(other.policy))
+        return true;
+    return intersects(writes, other.writes) || intersects(writes, other.reads) || intersects(reads, other.writes);
+}
+
+ecs::Scheduler::Scheduler(std::size_t workers) : m_graph(std::make_shared<Graph>()), m_pool(workers) {}
+
+void ecs::Scheduler::add(Task task, SystemAccess access) {
+    // A running graph is shared with `run`: edit a copy instead
+    if (m_graph.use_count() > 1)
+        m_graph = std::make_shared<Graph>(*m_graph);
+
+    auto& nodes = m_graph->nodes;
+    Node node{std::move(task), std::move(access), {}, 0};
+    for (std::size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i].access.conflicts_with(node.access)) {
+            nodes[i].successors.push_back(nodes.size());
+            node.dependencies++;
+        }
+    }
+    nodes.push_back(std::move(node));
+}
+
+void ecs::Scheduler::clear() {
+    m_graph = std::make_shared<Graph>();
+}
+
+std::size_t ecs::Scheduler::size() const noexcept {
+    return m_graph->nodes.size();
+}
+
+std::size_t ecs::Scheduler::workers() const noexcept {
+    return m_pool.size();
+}
+
+ecs::ThreadPool& ecs::Scheduler::pool() noexcept {
+    return m_pool;
+}
+
+void ecs::Scheduler::run(std::function<bool()> const& stop) {
+    std::shared_ptr<Graph const> graph = m_graph;
+    auto const& nodes = graph->nodes;
+
+    std::vector<std::size_t> remaining(nodes.size());
+    std::transform(nodes.begin(), nodes.end(), remaining.begin(), [](Node const& node) { return node.dependencies; });
+
+    // Main-thread systems are chained, so at most one is ready at a time; the heap keeps it general.
+    std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<>> main_ready;
+    std::size_t in_flight = 0;
+    bool stopped = false;
+
+    // Shared with the workers
+    std::mutex mutex;
+    std::condition_variable done_cv;
+    std::vector<std::size_t> done;
+    std::exception_ptr error;
+
+    auto launch = [&](std::size_t i) {
+        if (stopped)
+            return;
+        if (on_main_thread(nodes[i].access.policy) || m_pool.size() == 0) {
+            main_ready.push(i);
+            return;
+        }
+        in_flight++;
+        m_pool.submit([&, i] {
+            std::exception_ptr caught;
+            try {
+                const CommandOrderScope k_order(CommandOrder{i + 1, 0});
+                nodes[i].task();
+            } catch (...) {
+                caught = std::current_exception();
+            }
+            // Notified under the lock: `run` may return as soon as it sees the entry
+            std::lock_guard<std::mutex> lock(mutex);
+            if (caught && !error)
+                error = caught;
+            done.push_back(i);
+            done_cv.notify_one();
+        });
+    };
+
+    auto complete = [&](std::size_t i) {
+        for (std::size_t next : nodes[i].successors)
+            if (--remaining[next] == 0)
+                launch(next);
+    };
+
+    for (std::size_t i = 0; i < nodes.size(); i++)
+        if (remaining[i] == 0)
+            launch(i);
+
+    while (true) {
+        if (!stopped && !main_ready.empty()) {
+            std::size_t i = main_ready.top();
+            main_ready.pop();
+            try {
+                const CommandOrderScope k_order(CommandOrder{i + 1, 0});
+                nodes[i].task();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error)
+                    error = std::current_exception();
+                stopped = true;
+            }
+            if (stop && stop())
+                stopped = true;
+            complete(i);
+            continue;
+        }
+
+        if (in_flight == 0)
+            break;
+
+        std::vector<std::size_t> finished;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            done_cv.wait(lock, [&done] { return !done.empty(); });
+            finished.swap(done);
+            if (error)
+                stopped = true;
+        }
+        in_flight -= finished.size();
+        for (std::size_t i : finished)
+            complete(i);
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+}
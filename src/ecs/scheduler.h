@@ -0,0 +1,92 @@
+#pragma once
+
+#include "component_pool.h"
+#include "thread_pool.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ecs {
+
+/// Where a system may run and what it may touch besides its declared pools.
+enum class SystemPolicy {
+    /// Only touches its declared pools: runs on any thread, concurrently with non-conflicting systems.
+    Parallel,
+    /// Only touches its declared pools but must stay on the thread calling `run` (eg. raylib calls).
+    /// Main-thread systems run one at a time, in registration order.
+    MainThread,
+    /// May touch anything (structural changes, shared engine state): runs on the thread calling
+    /// `run` once every earlier system is done, and before any later one starts.
+    Exclusive,
+};
+
+/// Component pools a system reads and writes, and how it must be scheduled.
+struct SystemAccess {
+    std::vector<ComponentId> reads;
+    std::vector<ComponentId> writes;
+    SystemPolicy policy{SystemPolicy::Exclusive};
+
+    /// Check whether two systems must keep their registration order.
+    /// @param other Access of the other system.
+    /// @return True if one writes a pool the other touches, or neither may leave the main thread.
+    bool conflicts_with(SystemAccess const& other) const noexcept;
+};
+
+/// Runs a list of systems as a dependency graph.
+///
+/// Each system depends on every earlier system it conflicts with, so the outcome is the one of
+/// running them one after another in registration order. Independent systems run concurrently
+/// on a work-stealing thread pool.
+/// Commands recorded through `ThreadCommandBuffers` are tagged with the registration index of
+/// their system (plus one), so that they are applied in registration order too.
+class Scheduler {
+  public:
+    using Task = std::function<void()>;
+
+    /// @param workers Number of worker threads; with 0 every system runs on the calling thread.
+    explicit Scheduler(std::size_t workers = ThreadPool::default_worker_count());
+
+    /// Append a system after the ones already added.
+    /// Safe to call from a running system: the current run keeps the graph it started with.
+    /// @param task Callable running the system.
+    /// @param access Declared access of the system.
+    void add(Task task, SystemAccess access);
+
+    /// Remove every system. Safe to call from a running system.
+    void clear();
+
+    /// Number of systems.
+    std::size_t size() const noexcept;
+
+    /// Number of worker threads.
+    std::size_t workers() const noexcept;
+
+    /// Thread pool running the parallel systems, shared with their parallel loops.
+    ThreadPool& pool() noexcept;
+
+    /// Run every system once and wait for all of them.
+    /// If a system throws, no further system is started and the first exception is rethrown.
+    /// @param stop Checked on the calling thread after each main-thread system; once it returns
+    ///             true no further system is started, and the ones still running are waited for.
+    void run(std::function<bool()> const& stop = {});
+
+  private:
+    struct Node {
+        Task task;
+        SystemAccess access;
+        std::vector<std::size_t> successors;
+        std::size_t dependencies{0};
+    };
+
+    struct Graph {
+        std::vector<Node> nodes;
+    };
+
+    // replaced (never modified) while a run holds it
+    std::shared_ptr<Graph> m_graph;
+    ThreadPool m_pool;
+};
+
+} // namespace ecs
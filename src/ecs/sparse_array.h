@@ -1,22 +1,75 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "page_log.h"
+
 namespace ecs {
 
+/// Memory held by the storage of a SparseArray.
+struct StorageFootprint {
+    std::size_t element_size{0};   ///< Bytes per component slot (optional-wrapped component).
+    std::size_t capacity{0};       ///< Component slots allocated.
+    std::size_t count{0};          ///< Components stored.
+    std::size_t component_bytes{0}; ///< Bytes of the component slots.
+    std::size_t sparse_bytes{0};   ///< Bytes of the sparse index (page table, pages, dense entity ids).
+    std::size_t metadata_bytes{0}; ///< Bytes of the change stamps.
+
+    /// @return Share of the allocated slots holding a component, 0 when nothing is allocated.
+    double occupancy() const noexcept {
+        return capacity == 0 ? 0.0 : static_cast<double>(count) / static_cast<double>(capacity);
+    }
+
+    /// @return Bytes held in total.
+    std::size_t total() const noexcept {
+        return component_bytes + sparse_bytes + metadata_bytes;
+    }
+};
+
+/// Change counter components are stamped with when they are written (see `Registry::set_current_version`).
+using Version = std::uint32_t;
+
+/// Memory layout used to store a component type.
+/// - `Sparse`: one optional slot per entity id (fast random access, iteration scans every id).
+/// - `Packed`: sparse-set layout (dense components + dense entity ids + paged sparse index),
+///   iteration only touches the components that actually exist.
+enum class StorageMode { Sparse, Packed };
+
+/// Storage layout selected for `TComponent`.
+/// A component opts into packed storage by declaring
+/// `static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;`.
+/// @tparam TComponent Component type to inspect.
+template <typename TComponent> struct StorageTraits {
+    static constexpr StorageMode k_mode = StorageMode::Sparse;
+};
+
+template <typename TComponent>
+    requires requires { TComponent::k_storage_mode; }
+struct StorageTraits<TComponent> {
+    static constexpr StorageMode k_mode = TComponent::k_storage_mode;
+};
+
 /// SparseArray is a compact optional-storage container for components indexed by
 /// entity ids. It provides random access insertion/erasure while keeping the
 /// storage contiguous as a vector of optional values.
 /// @tparam TComponent Type stored inside the sparse array.
-template <typename TComponent> class SparseArray {
+/// @tparam TMode Storage layout, selected per component through `StorageTraits`.
+template <typename TComponent, StorageMode TMode = StorageTraits<TComponent>::k_mode> class SparseArray {
   public:
     using ValueType = std::optional<TComponent>;
     using ReferenceType = ValueType&;
     using ConstReferenceType = ValueType const&;
-    using ContainerT = std::vector<ValueType>;
+    using ContainerT = std::pmr::vector<ValueType>;
     using SizeType = typename ContainerT::size_type;
 
     using Iterator = typename ContainerT::iterator;
@@ -25,6 +78,10 @@ template <typename TComponent> class SparseArray {
     SparseArray() = default;
     ~SparseArray() = default;
 
+    /// Build an empty array allocating its storage from `resource`.
+    /// @param resource Memory resource backing every internal array, e.g. a scene arena.
+    explicit SparseArray(std::pmr::memory_resource* resource);
+
     SparseArray(SparseArray const&) = default;
     SparseArray(SparseArray&&) noexcept = default;
     SparseArray& operator=(SparseArray const&) = default;
@@ -41,8 +98,8 @@ template <typename TComponent> class SparseArray {
     /// @return Const reference to the optional-wrapped component.
     ConstReferenceType operator[](SizeType idx) const;
 
-    /// Iterator to first element.
-    Iterator begin() noexcept;
+    /// Iterator to first element. While a checkpoint is saving pages, every page is saved.
+    Iterator begin();
     /// Const iterator to first element.
     ConstIterator begin() const noexcept;
     ConstIterator cbegin() const noexcept;
@@ -56,6 +113,34 @@ template <typename TComponent> class SparseArray {
     /// @return The slot count.
     SizeType size() const noexcept;
 
+    /// Number of components actually stored.
+    /// @return The live component count.
+    SizeType count() const noexcept;
+
+    /// Number of components the array can hold before its storage grows.
+    /// @return The reserved component count.
+    SizeType capacity() const noexcept;
+
+    /// Memory held by the storage of the array, its reserved capacity included.
+    /// @return Sizes and byte counts of every internal array.
+    StorageFootprint footprint() const noexcept;
+
+    /// Check whether a component is stored at `idx`.
+    /// @param idx Position to check.
+    /// @return `true` if the slot holds a component.
+    bool contains(SizeType idx) const noexcept;
+
+    /// Look up the component stored at `idx`.
+    /// @param idx Position to look up.
+    /// @return Pointer to the component, or `nullptr` if the slot is empty or out of range.
+    TComponent* find(SizeType idx);
+    TComponent const* find(SizeType idx) const noexcept;
+
+    /// Range over the stored components as `(index, component&)` pairs, skipping empty slots.
+    /// The array must not be structurally modified while the range is being iterated.
+    auto each();
+    auto each() const;
+
     /// Insert a copy of `value` at `pos`, resizing storage if necessary.
     /// @param pos Index where to insert.
     /// @param value TComponent instance to copy.
@@ -79,13 +164,334 @@ template <typename TComponent> class SparseArray {
     /// @param pos Index of the slot to clear.
     void erase(SizeType pos);
 
+    /// Pre-allocate storage so that inserting up to `count` components with ids lower than
+    /// `size` does not reallocate. Empty slots are not created.
+    /// @param count Number of components the array will hold.
+    /// @param size Number of id slots the array will span.
+    void reserve(SizeType count, SizeType size);
+
+    /// Stamp the component at `idx` as changed at `version`. Ignored if there is no component.
+    /// @param idx Position of the component.
+    /// @param version Version the component changed at.
+    void stamp(SizeType idx, Version version);
+
+    /// Version the component at `idx` was last stamped with.
+    /// @param idx Position of the component.
+    /// @return The stamp, or 0 if there is no component or it was never stamped.
+    Version version(SizeType idx) const noexcept;
+
+    /// Append the indices of the components stamped after `since`.
+    /// Stamps are stored contiguously beside the components, so this is a linear compare.
+    /// @param since Last version already known by the caller.
+    /// @param indices Receives the entity indices, in storage order.
+    void changed_since(Version since, std::vector<SizeType>& indices) const;
+
     /// Find the index of a given optional value pointer within the storage.
     /// @param value Optional reference to compare by address.
     /// @return Index of matching slot, or `static_cast<SizeType>(-1)` if not found.
     SizeType get_index(ValueType const& value) const;
 
+    /// Pages of the array saved since a checkpoint.
+    struct Undo {
+        PageLog<ValueType> data;
+        PageLog<Version> stamps;
+        SizeType count{0};
+
+        /// Hand the pages over to the log of the previous checkpoint, see `PageLog::merge_into`.
+        void merge_into(Undo& previous);
+    };
+
+    /// Start saving the pages written from now on, for a new checkpoint.
+    /// References handed out before the call must not be written to afterwards.
+    /// @return The log the pages are saved into, to be kept as long as the checkpoint.
+    std::unique_ptr<Undo> checkpoint();
+
+    /// Save the pages written from now on into another log, e.g. the one of an older
+    /// checkpoint once the newest is dropped.
+    /// @param undo Log to save into, or `nullptr` to stop saving.
+    void track(Undo* undo);
+
+    /// Bring the array back to its state when `undo` was started, copying back the saved
+    /// pages only. The pages written are not saved: start a new checkpoint afterwards.
+    /// @param undo Log of the checkpoint, or of any checkpoint taken after it, newest first.
+    void restore(Undo const& undo);
+
+    /// Remove every component.
+    void clear();
+
+    /// Move every component to the new id of its entity, then give back the memory past the
+    /// highest id. Not allowed while a checkpoint is active.
+    /// @param new_ids New id of each id spanned by the array; ids are only ever lowered, in
+    /// order, and ids holding a component must have a new one.
+    /// @param version Version the moved components are stamped with.
+    void compact(std::span<SizeType const> new_ids, Version version);
+
   private:
     ContainerT m_data;
+    // change stamp of each slot, 0 for empty slots
+    std::pmr::vector<Version> m_stamps;
+    SizeType m_count{0};
+
+    PageTracker<ValueType> m_data_cow;
+    PageTracker<Version> m_stamps_cow;
+};
+
+/// Packed (sparse-set) specialization of SparseArray.
+///
+/// Components live contiguously in a dense array, alongside a dense array of the
+/// entity ids owning them. A paged sparse index maps an entity id to its dense
+/// position, so lookups stay O(1) while pages for id ranges without components are
+/// never allocated. Erasure swaps the last dense element into the hole.
+///
+/// The public interface mirrors the sparse layout: `operator[]` still yields an
+/// optional slot and `begin()`/`end()` still walk every id up to `size()`, yielding
+/// empty optionals for ids without a component, so zippers keep lining containers up
+/// by id. Use `each()` to walk only the stored components, and `find()` to look up
+/// an id that may have none.
+/// @tparam TComponent Type stored inside the sparse array.
+template <typename TComponent> class SparseArray<TComponent, StorageMode::Packed> {
+  public:
+    using ValueType = std::optional<TComponent>;
+    using ReferenceType = ValueType&;
+    using ConstReferenceType = ValueType const&;
+    using ContainerT = std::pmr::vector<ValueType>;
+    using SizeType = typename ContainerT::size_type;
+
+    /// Iterator walking every id slot in `[0, size())`, yielding empty optionals for
+    /// ids without a component. A mutable iterator hands those out from a slot of its
+    /// own, so writes through it are discarded rather than shared between iterators.
+    template <bool TConst> class SlotIterator {
+      public:
+        using ArrayType = std::conditional_t<TConst, SparseArray const, SparseArray>;
+        using Reference = std::conditional_t<TConst, ConstReferenceType, ReferenceType>;
+        using Pointer = std::add_pointer_t<std::remove_reference_t<Reference>>;
+        using DifferenceType = std::ptrdiff_t;
+        using IteratorCategory = std::forward_iterator_tag;
+
+        SlotIterator() = default;
+        SlotIterator(ArrayType* array, SizeType idx) noexcept : m_array(array), m_idx(idx) {}
+
+        Reference operator*() const;
+        Pointer operator->() const { return std::addressof(**this); }
+
+        SlotIterator& operator++() noexcept {
+            ++m_idx;
+            return *this;
+        }
+        SlotIterator operator++(int) noexcept {
+            SlotIterator tmp(*this);
+            ++m_idx;
+            return tmp;
+        }
+
+        bool operator==(SlotIterator const& rhs) const noexcept { return m_idx == rhs.m_idx; }
+        bool operator!=(SlotIterator const& rhs) const noexcept { return m_idx != rhs.m_idx; }
+
+      private:
+        ArrayType* m_array{nullptr};
+        SizeType m_idx{0};
+        mutable ValueType m_empty;
+    };
+
+    using Iterator = SlotIterator<false>;
+    using ConstIterator = SlotIterator<true>;
+
+    /// Number of sparse index entries per page.
+    static constexpr SizeType k_page_size = 4096;
+    /// Sparse index value marking an id without a component.
+    static constexpr SizeType k_null_index = static_cast<SizeType>(-1);
+
+    SparseArray() = default;
+    ~SparseArray() = default;
+
+    /// Build an empty array allocating its storage from `resource`.
+    /// @param resource Memory resource backing every internal array, e.g. a scene arena.
+    explicit SparseArray(std::pmr::memory_resource* resource);
+
+    SparseArray(SparseArray const&) = default;
+    SparseArray(SparseArray&&) noexcept = default;
+    SparseArray& operator=(SparseArray const&) = default;
+    SparseArray& operator=(SparseArray&&) noexcept = default;
+
+    /// Access element by entity index (non-const).
+    /// @param idx Entity index to access; the entity must have a component.
+    /// @return Reference to the optional-wrapped component.
+    /// @throws std::runtime_error if the entity has no component, use `find()` when it may not.
+    ReferenceType operator[](SizeType idx);
+
+    /// Access element by entity index (const).
+    /// @param idx Entity index to access.
+    /// @return Const reference to the optional-wrapped component.
+    ConstReferenceType operator[](SizeType idx) const;
+
+    /// Iterator to the first id slot.
+    Iterator begin() noexcept;
+    ConstIterator begin() const noexcept;
+    ConstIterator cbegin() const noexcept;
+
+    /// Iterator past the last id slot.
+    Iterator end() noexcept;
+    ConstIterator end() const noexcept;
+    ConstIterator cend() const noexcept;
+
+    /// Number of id slots (highest inserted id + 1), matching the sparse layout.
+    /// @return The slot count.
+    SizeType size() const noexcept;
+
+    /// Number of components actually stored.
+    /// @return The live component count.
+    SizeType count() const noexcept;
+
+    /// Number of components the array can hold before its storage grows.
+    /// @return The reserved component count.
+    SizeType capacity() const noexcept;
+
+    /// Memory held by the storage of the array, its reserved capacity included.
+    /// @return Sizes and byte counts of every internal array.
+    StorageFootprint footprint() const noexcept;
+
+    /// Check whether a component is stored for `idx`.
+    /// @param idx Entity index to check.
+    /// @return `true` if the entity has a component in this array.
+    bool contains(SizeType idx) const noexcept;
+
+    /// Look up the component of `idx`; the lookup to use when the entity may have none.
+    /// @param idx Entity index to look up.
+    /// @return Pointer to the component, or `nullptr` if the entity has none.
+    TComponent* find(SizeType idx);
+    TComponent const* find(SizeType idx) const noexcept;
+
+    /// Range over the stored components as `(index, component&)` pairs, in dense order.
+    /// The array must not be structurally modified while the range is being iterated.
+    auto each();
+    auto each() const;
+
+    /// Entity indices of the stored components, in dense order.
+    /// @return Const reference to the dense entity array.
+    std::pmr::vector<SizeType> const& indices() const noexcept;
+
+    /// Position of the component of entity `idx` in the dense array.
+    /// @param idx Entity index.
+    /// @return The dense position, or `k_null_index` if the entity has no component.
+    SizeType dense_index(SizeType idx) const noexcept;
+
+    /// Access the component at dense position `pos`.
+    /// @param pos Dense position, must be lower than `count()`.
+    /// @return Reference to the optional-wrapped component.
+    ReferenceType dense_at(SizeType pos);
+    ConstReferenceType dense_at(SizeType pos) const noexcept;
+
+    /// Swap two components in the dense array, keeping the sparse index in sync.
+    /// Used by owning groups to keep their members packed at the front of the pool.
+    /// @param lhs Dense position of the first component.
+    /// @param rhs Dense position of the second component.
+    void swap_dense(SizeType lhs, SizeType rhs);
+
+    /// Insert a copy of `value` for entity `pos` (replaces any existing component).
+    /// @param pos Entity index.
+    /// @param value TComponent instance to copy.
+    /// @return Reference to the dense slot now containing the component.
+    ReferenceType insert_at(SizeType pos, TComponent const& value);
+
+    /// Insert by moving `value` for entity `pos` (replaces any existing component).
+    /// @param pos Entity index.
+    /// @param value TComponent instance to move.
+    /// @return Reference to the dense slot now containing the component.
+    ReferenceType insert_at(SizeType pos, TComponent&& value);
+
+    /// Construct a component in-place for entity `pos` forwarding constructor arguments.
+    /// @tparam TParams Constructor parameter pack.
+    /// @param pos Entity index.
+    /// @param params Forwarded to component constructor.
+    /// @return Reference to the emplaced dense slot.
+    template <class... TParams> ReferenceType emplace_at(SizeType pos, TParams&&... params);
+
+    /// Erase the component of entity `pos`. The last dense element is moved into its place.
+    /// @param pos Entity index of the component to remove.
+    void erase(SizeType pos);
+
+    /// Pre-allocate the dense arrays for `count` components and the page table for ids
+    /// lower than `size`. Pages themselves are still allocated on first use.
+    /// @param count Number of components the array will hold.
+    /// @param size Number of id slots the array will span.
+    void reserve(SizeType count, SizeType size);
+
+    /// Stamp the component at `idx` as changed at `version`. Ignored if there is no component.
+    /// @param idx Entity index of the component.
+    /// @param version Version the component changed at.
+    void stamp(SizeType idx, Version version);
+
+    /// Version the component at `idx` was last stamped with.
+    /// @param idx Entity index of the component.
+    /// @return The stamp, or 0 if there is no component or it was never stamped.
+    Version version(SizeType idx) const noexcept;
+
+    /// Append the indices of the components stamped after `since`.
+    /// Stamps are stored contiguously beside the components, so this is a linear compare.
+    /// @param since Last version already known by the caller.
+    /// @param indices Receives the entity indices, in dense order.
+    void changed_since(Version since, std::vector<SizeType>& indices) const;
+
+    /// Find the entity index owning a given optional slot.
+    /// @param value Optional reference to compare by address.
+    /// @return Entity index of the matching slot, or `static_cast<SizeType>(-1)` if not found.
+    SizeType get_index(ValueType const& value) const;
+
+    /// Pages of the dense arrays saved since a checkpoint. The sparse index is not saved:
+    /// it is rebuilt from the dense entity array when that one is restored.
+    struct Undo {
+        PageLog<ValueType> dense;
+        PageLog<SizeType> entities;
+        PageLog<Version> stamps;
+        SizeType size{0};
+
+        /// Hand the pages over to the log of the previous checkpoint, see `PageLog::merge_into`.
+        void merge_into(Undo& previous);
+    };
+
+    /// Start saving the pages written from now on, for a new checkpoint.
+    /// References handed out before the call must not be written to afterwards.
+    /// @return The log the pages are saved into, to be kept as long as the checkpoint.
+    std::unique_ptr<Undo> checkpoint();
+
+    /// Save the pages written from now on into another log, e.g. the one of an older
+    /// checkpoint once the newest is dropped.
+    /// @param undo Log to save into, or `nullptr` to stop saving.
+    void track(Undo* undo);
+
+    /// Bring the array back to its state when `undo` was started, copying back the saved
+    /// pages only. The pages written are not saved: start a new checkpoint afterwards.
+    /// @param undo Log of the checkpoint, or of any checkpoint taken after it, newest first.
+    void restore(Undo const& undo);
+
+    /// Remove every component. Sparse index pages stay allocated.
+    void clear();
+
+    /// Move every component to the new id of its entity, then give back the memory past the
+    /// highest id. Not allowed while a checkpoint is active.
+    /// @param new_ids New id of each id spanned by the array; ids are only ever lowered, in
+    /// order, and ids holding a component must have a new one.
+    /// @param version Version the moved components are stamped with.
+    void compact(std::span<SizeType const> new_ids, Version version);
+
+  private:
+    ContainerT m_dense;
+    std::pmr::vector<SizeType> m_entities;
+    // change stamp of each dense component
+    std::pmr::vector<Version> m_stamps;
+    std::pmr::vector<std::pmr::vector<SizeType>> m_pages;
+    SizeType m_size{0};
+
+    PageTracker<ValueType> m_dense_cow;
+    PageTracker<SizeType> m_entities_cow;
+    PageTracker<Version> m_stamps_cow;
+
+    SizeType& assure_sparse(SizeType idx);
+    ReferenceType push_dense(SizeType pos);
+    /// Save the pages of the three dense arrays holding position `pos`.
+    void touch_dense(SizeType pos);
+    /// Point the sparse index at the dense positions again.
+    void rebuild_sparse();
 };
 
 } // namespace ecs
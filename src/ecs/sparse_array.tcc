@@ -2,99 +2,230 @@
 
 #include "sparse_array.h"
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
 namespace ecs {
 
+// ========== Sparse layout ==========
+
+template <typename TComponent, StorageMode TMode>
+SparseArray<TComponent, TMode>::SparseArray(std::pmr::memory_resource* resource) : m_data(resource), m_stamps(resource) {}
+
 /// Non-const indexed access to the underlying optional slot.
-template <typename TComponent>
-typename SparseArray<TComponent>::ReferenceType SparseArray<TComponent>::operator[](SizeType idx) {
+template <typename TComponent, StorageMode TMode>
+typename SparseArray<TComponent, TMode>::ReferenceType SparseArray<TComponent, TMode>::operator[](SizeType idx) {
+    m_data_cow.touch(m_data, idx);
     return m_data[idx];
 }
 
 /// Const indexed access to the underlying optional slot.
-template <typename TComponent>
-typename SparseArray<TComponent>::ConstReferenceType SparseArray<TComponent>::operator[](SizeType idx) const {
+template <typename TComponent, StorageMode TMode>
+typename SparseArray<TComponent, TMode>::ConstReferenceType
+SparseArray<TComponent, TMode>::operator[](SizeType idx) const {
     return m_data[idx];
 }
 
-/// Iterator to first element.
-template <typename TComponent> typename SparseArray<TComponent>::Iterator SparseArray<TComponent>::begin() noexcept {
+/// Iterator to first element. Writes through it cannot be told apart, so every page is saved.
+template <typename TComponent, StorageMode TMode>
+typename SparseArray<TComponent, TMode>::Iterator SparseArray<TComponent, TMode>::begin() {
+    m_data_cow.touch(m_data, 0, m_data.size());
     return m_data.begin();
 }
 
 /// Const iterator to first element.
-template <typename TComponent>
-typename SparseArray<TComponent>::ConstIterator SparseArray<TComponent>::begin() const noexcept {
+template <typename TComponent, StorageMode TMode>
+typename SparseArray<TComponent, TMode>::ConstIterator SparseArray<TComponent, TMode>::begin() const noexcept {
     return m_data.begin();
 }
 
 /// Const iterator to first element.
-template <typename TComponent>
-typename SparseArray<TComponent>::ConstIterator SparseArray<TComponent>::cbegin() const noexcept {
+template <typename TComponent, StorageMode TMode>
+typename SparseArray<TComponent, TMode>::ConstIterator SparseArray<TComponent, TMode>::cbegin() const noexcept {
     return m_data.cbegin();
 }
 
 /// Iterator past-the-end.
-template <typename TComponent> typename SparseArray<TComponent>::Iterator SparseArray<TComponent>::end() noexcept {
+template <typename TComponent, StorageMode TMode>
+typename SparseArray<TComponent, TMode>::Iterator SparseArray<TComponent, TMode>::end() noexcept {
     return m_data.end();
 }
 
 /// Const past-the-end iterator.
-template <typename TComponent>
-typename SparseArray<TComponent>::ConstIterator SparseArray<TComponent>::end() const noexcept {
+template <typename TComponent, StorageMode TMode>
+typename SparseArray<TComponent, TMode>::ConstIterator SparseArray<TComponent, TMode>::end() const noexcept {
     return m_data.end();
 }
 
 /// Const past-the-end iterator.
-template <typename TComponent>
-typename SparseArray<TComponent>::ConstIterator SparseArray<TComponent>::cend() const noexcept {
+template <typename TComponent, StorageMode TMode>
+typename SparseArray<TComponent, TMode>::ConstIterator SparseArray<TComponent, TMode>::cend() const noexcept {
     return m_data.cend();
 }
 
 /// Number of slots in the underlying container.
-template <typename TComponent>
-typename SparseArray<TComponent>::SizeType SparseArray<TComponent>::size() const noexcept {
+template <typename TComponent, StorageMode TMode>
+typename SparseArray<TComponent, TMode>::SizeType SparseArray<TComponent, TMode>::size() const noexcept {
     return m_data.size();
 }
 
+/// Number of engaged slots, tracked by insert/emplace/erase.
+template <typename TComponent, StorageMode TMode>
+typename SparseArray<TComponent, TMode>::SizeType SparseArray<TComponent, TMode>::count() const noexcept {
+    return m_count;
+}
+
+/// Slots the vector holds before reallocating: the sparse layout spans one slot per id.
+template <typename TComponent, StorageMode TMode>
+typename SparseArray<TComponent, TMode>::SizeType SparseArray<TComponent, TMode>::capacity() const noexcept {
+    return m_data.capacity();
+}
+
+/// Slots are indexed by id directly: there is no separate sparse index.
+template <typename TComponent, StorageMode TMode>
+StorageFootprint SparseArray<TComponent, TMode>::footprint() const noexcept {
+    StorageFootprint footprint;
+    footprint.element_size = sizeof(ValueType);
+    footprint.capacity = m_data.capacity();
+    footprint.count = m_count;
+    footprint.component_bytes = m_data.capacity() * sizeof(ValueType);
+    footprint.metadata_bytes = m_stamps.capacity() * sizeof(Version);
+    return footprint;
+}
+
+/// Check whether the slot at `idx` exists and is engaged.
+template <typename TComponent, StorageMode TMode>
+bool SparseArray<TComponent, TMode>::contains(SizeType idx) const noexcept {
+    return idx < m_data.size() && m_data[idx].has_value();
+}
+
+/// Engaged slot at `idx`, saving its page for a checkpoint.
+template <typename TComponent, StorageMode TMode> TComponent* SparseArray<TComponent, TMode>::find(SizeType idx) {
+    if (!contains(idx))
+        return nullptr;
+    m_data_cow.touch(m_data, idx);
+    return std::addressof(*m_data[idx]);
+}
+
+/// Engaged slot at `idx`.
+template <typename TComponent, StorageMode TMode>
+TComponent const* SparseArray<TComponent, TMode>::find(SizeType idx) const noexcept {
+    return contains(idx) ? std::addressof(*m_data[idx]) : nullptr;
+}
+
+/// Range over engaged slots, scanning every id.
+template <typename TComponent, StorageMode TMode> auto SparseArray<TComponent, TMode>::each() {
+    return std::views::iota(SizeType{0}, m_data.size()) |
+           std::views::filter([this](SizeType i) { return m_data[i].has_value(); }) |
+           std::views::transform([this](SizeType i) {
+               m_data_cow.touch(m_data, i);
+               return std::pair<SizeType, TComponent&>(i, *m_data[i]);
+           });
+}
+
+/// Const range over engaged slots, scanning every id.
+template <typename TComponent, StorageMode TMode> auto SparseArray<TComponent, TMode>::each() const {
+    return std::views::iota(SizeType{0}, m_data.size()) |
+           std::views::filter([this](SizeType i) { return m_data[i].has_value(); }) |
+           std::views::transform(
+               [this](SizeType i) { return std::pair<SizeType, TComponent const&>(i, *m_data[i]); });
+}
+
 /// Insert a copy of `value` at `pos`, resizing storage if necessary.
-template <typename TComponent>
-typename SparseArray<TComponent>::ReferenceType SparseArray<TComponent>::insert_at(SizeType pos,
-                                                                                   TComponent const& value) {
-    if (pos >= m_data.size())
+template <typename TComponent, StorageMode TMode>
+typename SparseArray<TComponent, TMode>::ReferenceType SparseArray<TComponent, TMode>::insert_at(SizeType pos,
+                                                                                                 TComponent const& value) {
+    if (pos >= m_data.size()) {
         m_data.resize(pos + 1);
+        m_stamps.resize(pos + 1);
+    }
+    m_data_cow.touch(m_data, pos);
+    if (!m_data[pos].has_value())
+        ++m_count;
     m_data[pos] = value;
     return m_data[pos];
 }
 
 /// Insert by moving `value` into the storage at `pos`.
-template <typename TComponent>
-typename SparseArray<TComponent>::ReferenceType SparseArray<TComponent>::insert_at(SizeType pos, TComponent&& value) {
-    if (pos >= m_data.size())
+template <typename TComponent, StorageMode TMode>
+typename SparseArray<TComponent, TMode>::ReferenceType SparseArray<TComponent, TMode>::insert_at(SizeType pos,
+                                                                                                 TComponent&& value) {
+    if (pos >= m_data.size()) {
         m_data.resize(pos + 1);
+        m_stamps.resize(pos + 1);
+    }
+    m_data_cow.touch(m_data, pos);
+    if (!m_data[pos].has_value())
+        ++m_count;
     m_data[pos] = std::move(value);
     return m_data[pos];
 }
 
 /// Emplace a component in-place at `pos`.
-template <typename TComponent>
+template <typename TComponent, StorageMode TMode>
 template <class... TParams>
-typename SparseArray<TComponent>::ReferenceType SparseArray<TComponent>::emplace_at(SizeType pos, TParams&&... params) {
-    if (pos >= m_data.size())
+typename SparseArray<TComponent, TMode>::ReferenceType SparseArray<TComponent, TMode>::emplace_at(SizeType pos,
+                                                                                                  TParams&&... params) {
+    if (pos >= m_data.size()) {
         m_data.resize(pos + 1);
+        m_stamps.resize(pos + 1);
+    }
+    m_data_cow.touch(m_data, pos);
+    if (!m_data[pos].has_value())
+        ++m_count;
     m_data[pos].emplace(std::forward<TParams>(params)...);
     return m_data[pos];
 }
 
 /// Erase the stored component at `pos` (makes the optional empty).
-template <typename TComponent> void SparseArray<TComponent>::erase(SizeType pos) {
+template <typename TComponent, StorageMode TMode> void SparseArray<TComponent, TMode>::erase(SizeType pos) {
     if (pos >= m_data.size())
         return;
+    m_data_cow.touch(m_data, pos);
+    m_stamps_cow.touch(m_stamps, pos);
+    if (m_data[pos].has_value())
+        --m_count;
     m_data[pos].reset();
+    m_stamps[pos] = 0;
+}
+
+/// Reserve the slot vector; `insert_at` then grows it without reallocating.
+template <typename TComponent, StorageMode TMode>
+void SparseArray<TComponent, TMode>::reserve(SizeType /*count*/, SizeType size) {
+    m_data.reserve(size);
+    m_stamps.reserve(size);
+}
+
+/// Stamp the slot, if it holds a component.
+template <typename TComponent, StorageMode TMode>
+void SparseArray<TComponent, TMode>::stamp(SizeType idx, Version version) {
+    if (!contains(idx))
+        return;
+    m_stamps_cow.touch(m_stamps, idx);
+    m_stamps[idx] = version;
+}
+
+/// Stamp of the slot, 0 when empty.
+template <typename TComponent, StorageMode TMode>
+Version SparseArray<TComponent, TMode>::version(SizeType idx) const noexcept {
+    return idx < m_stamps.size() ? m_stamps[idx] : 0;
+}
+
+/// Compare every slot stamp; empty slots are stamped 0 and never match.
+template <typename TComponent, StorageMode TMode>
+void SparseArray<TComponent, TMode>::changed_since(Version since, std::vector<SizeType>& indices) const {
+    for (SizeType i = 0; i < m_stamps.size(); ++i) {
+        if (m_stamps[i] > since)
+            indices.push_back(i);
+    }
 }
 
 /// Find index by pointer comparison to the provided optional.
-template <typename TComponent>
-typename SparseArray<TComponent>::SizeType SparseArray<TComponent>::get_index(ValueType const& value) const {
+template <typename TComponent, StorageMode TMode>
+typename SparseArray<TComponent, TMode>::SizeType
+SparseArray<TComponent, TMode>::get_index(ValueType const& value) const {
     for (SizeType i = 0; i < m_data.size(); ++i) {
         if (std::addressof(m_data[i]) == std::addressof(value))
             return i;
@@ -102,4 +233,481 @@ typename SparseArray<TComponent>::SizeType SparseArray<TComponent>::get_index(Va
     return static_cast<SizeType>(-1);
 }
 
+template <typename TComponent, StorageMode TMode>
+void SparseArray<TComponent, TMode>::Undo::merge_into(Undo& previous) {
+    data.merge_into(previous.data);
+    stamps.merge_into(previous.stamps);
+}
+
+/// The log starts empty: pages are copied by the write barriers, on their first write.
+template <typename TComponent, StorageMode TMode>
+std::unique_ptr<typename SparseArray<TComponent, TMode>::Undo> SparseArray<TComponent, TMode>::checkpoint() {
+    auto undo = std::make_unique<Undo>(Undo{PageLog<ValueType>(m_data.size()), PageLog<Version>(m_stamps.size()), m_count});
+
+    track(undo.get());
+    return undo;
+}
+
+template <typename TComponent, StorageMode TMode> void SparseArray<TComponent, TMode>::track(Undo* undo) {
+    m_data_cow.track(undo != nullptr ? &undo->data : nullptr);
+    m_stamps_cow.track(undo != nullptr ? &undo->stamps : nullptr);
+}
+
+template <typename TComponent, StorageMode TMode> void SparseArray<TComponent, TMode>::restore(Undo const& undo) {
+    undo.data.restore(m_data);
+    undo.stamps.restore(m_stamps);
+    m_count = undo.count;
+}
+
+template <typename TComponent, StorageMode TMode> void SparseArray<TComponent, TMode>::clear() {
+    m_data_cow.touch(m_data, 0, m_data.size());
+    m_stamps_cow.touch(m_stamps, 0, m_stamps.size());
+    m_data.clear();
+    m_stamps.clear();
+    m_count = 0;
+}
+
+/// New ids are lower and in the same order: moving front to back never overwrites a live slot.
+template <typename TComponent, StorageMode TMode>
+void SparseArray<TComponent, TMode>::compact(std::span<SizeType const> new_ids, Version version) {
+    SizeType size = 0;
+
+    for (SizeType idx = 0; idx < m_data.size(); idx++) {
+        if (!m_data[idx].has_value())
+            continue;
+        const SizeType k_new = new_ids[idx];
+        if (k_new != idx) {
+            m_data[k_new] = std::move(m_data[idx]);
+            m_data[idx].reset();
+            m_stamps[k_new] = version;
+            m_stamps[idx] = 0;
+        }
+        size = k_new + 1;
+    }
+    m_data.resize(size);
+    m_stamps.resize(size);
+    m_data.shrink_to_fit();
+    m_stamps.shrink_to_fit();
+}
+
+// ========== Packed layout ==========
+
+template <typename TComponent>
+SparseArray<TComponent, StorageMode::Packed>::SparseArray(std::pmr::memory_resource* resource)
+    : m_dense(resource), m_entities(resource), m_stamps(resource), m_pages(resource) {}
+
+/// Dense position of the component owned by `idx`, or `k_null_index`.
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::SizeType
+SparseArray<TComponent, StorageMode::Packed>::dense_index(SizeType idx) const noexcept {
+    const SizeType k_page = idx / k_page_size;
+
+    if (k_page >= m_pages.size() || m_pages[k_page].empty())
+        return k_null_index;
+    return m_pages[k_page][idx % k_page_size];
+}
+
+/// Sparse index entry for `idx`, allocating its page on first use.
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::SizeType&
+SparseArray<TComponent, StorageMode::Packed>::assure_sparse(SizeType idx) {
+    const SizeType k_page = idx / k_page_size;
+
+    if (k_page >= m_pages.size())
+        m_pages.resize(k_page + 1);
+    if (m_pages[k_page].empty())
+        m_pages[k_page].assign(k_page_size, k_null_index);
+    return m_pages[k_page][idx % k_page_size];
+}
+
+/// Append an empty dense slot owned by `pos` and register it in the sparse index.
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::ReferenceType
+SparseArray<TComponent, StorageMode::Packed>::push_dense(SizeType pos) {
+    SizeType& sparse = assure_sparse(pos);
+
+    touch_dense(m_dense.size());
+    m_entities.push_back(pos);
+    m_stamps.push_back(0);
+    m_dense.emplace_back();
+    sparse = m_dense.size() - 1;
+    m_size = std::max(m_size, pos + 1);
+    return m_dense.back();
+}
+
+/// Non-const access through the sparse index. There is no slot to hand out for a missing
+/// id: one shared empty optional would be written to by every caller, from every thread.
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::ReferenceType
+SparseArray<TComponent, StorageMode::Packed>::operator[](SizeType idx) {
+    const SizeType k_dense = dense_index(idx);
+
+    if (k_dense == k_null_index)
+        throw std::runtime_error("No component stored for this entity");
+    return dense_at(k_dense);
+}
+
+/// Const access through the sparse index.
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::ConstReferenceType
+SparseArray<TComponent, StorageMode::Packed>::operator[](SizeType idx) const {
+    static const ValueType s_null{};
+    const SizeType k_dense = dense_index(idx);
+
+    if (k_dense == k_null_index)
+        return s_null;
+    return m_dense[k_dense];
+}
+
+/// Slot of the current id; a missing id yields the iterator's own empty optional.
+template <typename TComponent>
+template <bool TConst>
+typename SparseArray<TComponent, StorageMode::Packed>::template SlotIterator<TConst>::Reference
+SparseArray<TComponent, StorageMode::Packed>::SlotIterator<TConst>::operator*() const {
+    const SizeType k_dense = m_array->dense_index(m_idx);
+
+    if (k_dense != k_null_index)
+        return m_array->dense_at(k_dense);
+    if constexpr (TConst) {
+        return m_empty;
+    } else {
+        m_empty.reset();
+        return m_empty;
+    }
+}
+
+/// Iterator to the first id slot.
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::Iterator
+SparseArray<TComponent, StorageMode::Packed>::begin() noexcept {
+    return Iterator(this, 0);
+}
+
+/// Const iterator to the first id slot.
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::ConstIterator
+SparseArray<TComponent, StorageMode::Packed>::begin() const noexcept {
+    return ConstIterator(this, 0);
+}
+
+/// Const iterator to the first id slot.
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::ConstIterator
+SparseArray<TComponent, StorageMode::Packed>::cbegin() const noexcept {
+    return ConstIterator(this, 0);
+}
+
+/// Iterator past the last id slot.
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::Iterator
+SparseArray<TComponent, StorageMode::Packed>::end() noexcept {
+    return Iterator(this, m_size);
+}
+
+/// Const iterator past the last id slot.
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::ConstIterator
+SparseArray<TComponent, StorageMode::Packed>::end() const noexcept {
+    return ConstIterator(this, m_size);
+}
+
+/// Const iterator past the last id slot.
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::ConstIterator
+SparseArray<TComponent, StorageMode::Packed>::cend() const noexcept {
+    return ConstIterator(this, m_size);
+}
+
+/// Number of id slots (highest inserted id + 1).
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::SizeType
+SparseArray<TComponent, StorageMode::Packed>::size() const noexcept {
+    return m_size;
+}
+
+/// Number of components in the dense array.
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::SizeType
+SparseArray<TComponent, StorageMode::Packed>::count() const noexcept {
+    return m_dense.size();
+}
+
+/// Components the dense array holds before reallocating.
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::SizeType
+SparseArray<TComponent, StorageMode::Packed>::capacity() const noexcept {
+    return m_dense.capacity();
+}
+
+/// The sparse index spans the page table, the allocated pages and the dense entity ids.
+template <typename TComponent>
+StorageFootprint SparseArray<TComponent, StorageMode::Packed>::footprint() const noexcept {
+    StorageFootprint footprint;
+    footprint.element_size = sizeof(ValueType);
+    footprint.capacity = m_dense.capacity();
+    footprint.count = m_dense.size();
+    footprint.component_bytes = m_dense.capacity() * sizeof(ValueType);
+    footprint.sparse_bytes = m_entities.capacity() * sizeof(SizeType) + m_pages.capacity() * sizeof(m_pages.front());
+    for (auto const& page : m_pages)
+        footprint.sparse_bytes += page.capacity() * sizeof(SizeType);
+    footprint.metadata_bytes = m_stamps.capacity() * sizeof(Version);
+    return footprint;
+}
+
+/// Check the sparse index for `idx`.
+template <typename TComponent>
+bool SparseArray<TComponent, StorageMode::Packed>::contains(SizeType idx) const noexcept {
+    return dense_index(idx) != k_null_index;
+}
+
+/// Component of `idx` through the sparse index, saving its page for a checkpoint.
+template <typename TComponent> TComponent* SparseArray<TComponent, StorageMode::Packed>::find(SizeType idx) {
+    const SizeType k_dense = dense_index(idx);
+
+    return k_dense == k_null_index ? nullptr : std::addressof(*dense_at(k_dense));
+}
+
+/// Component of `idx` through the sparse index.
+template <typename TComponent>
+TComponent const* SparseArray<TComponent, StorageMode::Packed>::find(SizeType idx) const noexcept {
+    const SizeType k_dense = dense_index(idx);
+
+    return k_dense == k_null_index ? nullptr : std::addressof(*m_dense[k_dense]);
+}
+
+/// Range over the dense array only.
+template <typename TComponent> auto SparseArray<TComponent, StorageMode::Packed>::each() {
+    return std::views::iota(SizeType{0}, m_dense.size()) | std::views::transform([this](SizeType i) {
+               m_dense_cow.touch(m_dense, i);
+               return std::pair<SizeType, TComponent&>(m_entities[i], *m_dense[i]);
+           });
+}
+
+/// Const range over the dense array only.
+template <typename TComponent> auto SparseArray<TComponent, StorageMode::Packed>::each() const {
+    return std::views::iota(SizeType{0}, m_dense.size()) | std::views::transform([this](SizeType i) {
+               return std::pair<SizeType, TComponent const&>(m_entities[i], *m_dense[i]);
+           });
+}
+
+/// Dense entity array.
+template <typename TComponent>
+std::pmr::vector<typename SparseArray<TComponent, StorageMode::Packed>::SizeType> const&
+SparseArray<TComponent, StorageMode::Packed>::indices() const noexcept {
+    return m_entities;
+}
+
+/// Insert a copy of `value`, appending to the dense arrays if `pos` has no component yet.
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::ReferenceType
+SparseArray<TComponent, StorageMode::Packed>::insert_at(SizeType pos, TComponent const& value) {
+    const SizeType k_dense = dense_index(pos);
+    auto& slot = (k_dense == k_null_index) ? push_dense(pos) : dense_at(k_dense);
+
+    slot = value;
+    return slot;
+}
+
+/// Move `value` in, appending to the dense arrays if `pos` has no component yet.
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::ReferenceType
+SparseArray<TComponent, StorageMode::Packed>::insert_at(SizeType pos, TComponent&& value) {
+    const SizeType k_dense = dense_index(pos);
+    auto& slot = (k_dense == k_null_index) ? push_dense(pos) : dense_at(k_dense);
+
+    slot = std::move(value);
+    return slot;
+}
+
+/// Emplace a component in-place, appending to the dense arrays if `pos` has no component yet.
+template <typename TComponent>
+template <class... TParams>
+typename SparseArray<TComponent, StorageMode::Packed>::ReferenceType
+SparseArray<TComponent, StorageMode::Packed>::emplace_at(SizeType pos, TParams&&... params) {
+    const SizeType k_dense = dense_index(pos);
+    auto& slot = (k_dense == k_null_index) ? push_dense(pos) : dense_at(k_dense);
+
+    slot.emplace(std::forward<TParams>(params)...);
+    return slot;
+}
+
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::ReferenceType
+SparseArray<TComponent, StorageMode::Packed>::dense_at(SizeType pos) {
+    m_dense_cow.touch(m_dense, pos);
+    return m_dense[pos];
+}
+
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::ConstReferenceType
+SparseArray<TComponent, StorageMode::Packed>::dense_at(SizeType pos) const noexcept {
+    return m_dense[pos];
+}
+
+template <typename TComponent> void SparseArray<TComponent, StorageMode::Packed>::swap_dense(SizeType lhs, SizeType rhs) {
+    if (lhs == rhs)
+        return;
+
+    touch_dense(lhs);
+    touch_dense(rhs);
+    std::swap(m_dense[lhs], m_dense[rhs]);
+    std::swap(m_entities[lhs], m_entities[rhs]);
+    std::swap(m_stamps[lhs], m_stamps[rhs]);
+    assure_sparse(m_entities[lhs]) = lhs;
+    assure_sparse(m_entities[rhs]) = rhs;
+}
+
+/// Swap-and-pop removal keeping the dense arrays contiguous.
+template <typename TComponent> void SparseArray<TComponent, StorageMode::Packed>::erase(SizeType pos) {
+    const SizeType k_dense = dense_index(pos);
+
+    if (k_dense == k_null_index)
+        return;
+
+    const SizeType k_last = m_dense.size() - 1;
+    touch_dense(k_dense);
+    touch_dense(k_last);
+    if (k_dense != k_last) {
+        m_dense[k_dense] = std::move(m_dense[k_last]);
+        m_entities[k_dense] = m_entities[k_last];
+        m_stamps[k_dense] = m_stamps[k_last];
+        assure_sparse(m_entities[k_dense]) = k_dense;
+    }
+    m_dense.pop_back();
+    m_entities.pop_back();
+    m_stamps.pop_back();
+    assure_sparse(pos) = k_null_index;
+}
+
+/// Reserve the dense arrays and the page table.
+template <typename TComponent>
+void SparseArray<TComponent, StorageMode::Packed>::reserve(SizeType count, SizeType size) {
+    m_dense.reserve(count);
+    m_entities.reserve(count);
+    m_stamps.reserve(count);
+    m_pages.reserve((size + k_page_size - 1) / k_page_size);
+}
+
+/// Stamp the dense slot of `idx`, if any.
+template <typename TComponent>
+void SparseArray<TComponent, StorageMode::Packed>::stamp(SizeType idx, Version version) {
+    const SizeType k_dense = dense_index(idx);
+
+    if (k_dense == k_null_index)
+        return;
+    m_stamps_cow.touch(m_stamps, k_dense);
+    m_stamps[k_dense] = version;
+}
+
+/// Stamp of the dense slot of `idx`, 0 when there is none.
+template <typename TComponent>
+Version SparseArray<TComponent, StorageMode::Packed>::version(SizeType idx) const noexcept {
+    const SizeType k_dense = dense_index(idx);
+
+    return k_dense == k_null_index ? 0 : m_stamps[k_dense];
+}
+
+/// Compare the dense stamps only, yielding the owning entity indices.
+template <typename TComponent>
+void SparseArray<TComponent, StorageMode::Packed>::changed_since(Version since, std::vector<SizeType>& indices) const {
+    for (SizeType i = 0; i < m_stamps.size(); ++i) {
+        if (m_stamps[i] > since)
+            indices.push_back(m_entities[i]);
+    }
+}
+
+/// Resolve the owning entity of a dense slot from its address.
+template <typename TComponent>
+typename SparseArray<TComponent, StorageMode::Packed>::SizeType
+SparseArray<TComponent, StorageMode::Packed>::get_index(ValueType const& value) const {
+    const auto* first = m_dense.data();
+    const auto* last = first + m_dense.size();
+    const auto* ptr = std::addressof(value);
+
+    if (std::less<>{}(ptr, first) || !std::less<>{}(ptr, last))
+        return static_cast<SizeType>(-1);
+    return m_entities[static_cast<SizeType>(ptr - first)];
+}
+
+template <typename TComponent>
+void SparseArray<TComponent, StorageMode::Packed>::Undo::merge_into(Undo& previous) {
+    dense.merge_into(previous.dense);
+    entities.merge_into(previous.entities);
+    stamps.merge_into(previous.stamps);
+}
+
+/// The log starts empty: pages are copied by the write barriers, on their first write.
+template <typename TComponent>
+std::unique_ptr<typename SparseArray<TComponent, StorageMode::Packed>::Undo>
+SparseArray<TComponent, StorageMode::Packed>::checkpoint() {
+    auto undo = std::make_unique<Undo>(Undo{PageLog<ValueType>(m_dense.size()), PageLog<SizeType>(m_entities.size()),
+                                            PageLog<Version>(m_stamps.size()), m_size});
+
+    track(undo.get());
+    return undo;
+}
+
+template <typename TComponent> void SparseArray<TComponent, StorageMode::Packed>::track(Undo* undo) {
+    m_dense_cow.track(undo != nullptr ? &undo->dense : nullptr);
+    m_entities_cow.track(undo != nullptr ? &undo->entities : nullptr);
+    m_stamps_cow.track(undo != nullptr ? &undo->stamps : nullptr);
+}
+
+/// The sparse index only needs rebuilding when entities moved in the dense array.
+template <typename TComponent> void SparseArray<TComponent, StorageMode::Packed>::restore(Undo const& undo) {
+    const bool k_moved = undo.entities.page_count() != 0 || undo.entities.size() != m_entities.size();
+
+    undo.dense.restore(m_dense);
+    undo.entities.restore(m_entities);
+    undo.stamps.restore(m_stamps);
+    m_size = undo.size;
+    if (k_moved)
+        rebuild_sparse();
+}
+
+template <typename TComponent> void SparseArray<TComponent, StorageMode::Packed>::clear() {
+    m_dense_cow.touch(m_dense, 0, m_dense.size());
+    m_entities_cow.touch(m_entities, 0, m_entities.size());
+    m_stamps_cow.touch(m_stamps, 0, m_stamps.size());
+    m_dense.clear();
+    m_entities.clear();
+    m_stamps.clear();
+    m_size = 0;
+    rebuild_sparse();
+}
+
+template <typename TComponent> void SparseArray<TComponent, StorageMode::Packed>::touch_dense(SizeType pos) {
+    m_dense_cow.touch(m_dense, pos);
+    m_entities_cow.touch(m_entities, pos);
+    m_stamps_cow.touch(m_stamps, pos);
+}
+
+template <typename TComponent> void SparseArray<TComponent, StorageMode::Packed>::rebuild_sparse() {
+    for (auto& page : m_pages)
+        std::fill(page.begin(), page.end(), k_null_index);
+    for (SizeType pos = 0; pos < m_entities.size(); ++pos)
+        assure_sparse(m_entities[pos]) = pos;
+}
+
+/// The dense order is kept, so groups stay valid: only the ids and the sparse index change.
+template <typename TComponent>
+void SparseArray<TComponent, StorageMode::Packed>::compact(std::span<SizeType const> new_ids, Version version) {
+    m_size = 0;
+    for (SizeType pos = 0; pos < m_entities.size(); pos++) {
+        const SizeType k_new = new_ids[m_entities[pos]];
+        if (k_new != m_entities[pos]) {
+            m_entities[pos] = k_new;
+            m_stamps[pos] = version;
+        }
+        m_size = std::max(m_size, k_new + 1);
+    }
+
+    m_pages.resize((m_size + k_page_size - 1) / k_page_size);
+    m_pages.shrink_to_fit();
+    m_dense.shrink_to_fit();
+    m_entities.shrink_to_fit();
+    m_stamps.shrink_to_fit();
+    rebuild_sparse();
+}
+
 } // namespace ecs
@@ -2,33 +2,37 @@
 
 #include "utils/logger.h"
 
-#include <algorithm>
-#include <stdexcept>
-
 using namespace ecs;
 
-TagRegistry::TagId TagRegistry::create_tag(const std::string& name) {
+TagRegistry::TagId TagRegistry::create_tag(Atom name) {
     if (m_name_to_id.find(name) != m_name_to_id.end()) {
         LOG_ERROR("Tag name {} already exists", name);
         return TagRegistry::k_invalid_tag_id;
     }
 
-    TagId new_id = m_next_id++;
+    TagId new_id = m_id_to_name.size();
     m_name_to_id[name] = new_id;
-    m_id_to_name[new_id] = name;
+    m_id_to_name.push_back(name);
     return new_id;
 }
 
 void TagRegistry::bind_tag(TagId tag_id, Entity entity) {
-    if (m_id_to_name.find(tag_id) == m_id_to_name.end()) {
+    if (tag_id >= m_id_to_name.size()) {
         LOG_ERROR("Cannot bind TagId {} to the entity n°{}, TagId {} does not exists", tag_id, entity, tag_id);
         return;
     }
 
+    auto it = m_tag_to_entity.find(tag_id);
+    if (it != m_tag_to_entity.end()) {
+        auto previous = m_entity_to_tag.find(it->second);
+        if (previous != m_entity_to_tag.end() && previous->second == tag_id)
+            m_entity_to_tag.erase(previous);
+    }
     m_tag_to_entity[tag_id] = entity;
+    m_entity_to_tag[entity] = tag_id;
 }
 
-TagRegistry::TagId TagRegistry::create_and_bind_tag(const std::string& name, Entity entity) {
+TagRegistry::TagId TagRegistry::create_and_bind_tag(Atom name, Entity entity) {
     TagId tag_id = create_tag(name);
 
     if (tag_id == TagRegistry::k_invalid_tag_id)
@@ -37,7 +41,7 @@ TagRegistry::TagId TagRegistry::create_and_bind_tag(const std::string& name, Ent
     return tag_id;
 }
 
-TagRegistry::TagId TagRegistry::get_tag_id(const std::string& name) const {
+TagRegistry::TagId TagRegistry::get_tag_id(Atom name) const {
     auto it = m_name_to_id.find(name);
     if (it == m_name_to_id.end()) {
         LOG_ERROR("No TagId is linked to the name {}", name);
@@ -47,26 +51,27 @@ TagRegistry::TagId TagRegistry::get_tag_id(const std::string& name) const {
 }
 
 TagRegistry::TagId TagRegistry::get_tag_id(Entity entity) const {
-    auto it = std::find_if(m_tag_to_entity.begin(), m_tag_to_entity.end(),
-                           [&entity](const auto& p) { return p.second == entity; });
-
-    if (it == m_tag_to_entity.end()) {
+    auto it = m_entity_to_tag.find(entity);
+    if (it == m_entity_to_tag.end()) {
         LOG_ERROR("No TagId is linked to the entity n°{}", entity.value());
         return TagRegistry::k_invalid_tag_id;
     }
-    return it->first;
+    return it->second;
 }
 
-std::string TagRegistry::get_tag_name(TagId tag_id) const {
-    auto it = m_id_to_name.find(tag_id);
-    if (it == m_id_to_name.end()) {
+Atom TagRegistry::get_tag_atom(TagId tag_id) const {
+    if (tag_id >= m_id_to_name.size()) {
         LOG_ERROR("No name is linked to the TagId {}", tag_id);
-        return "";
+        return Atom{};
     }
-    return it->second;
+    return m_id_to_name[tag_id];
+}
+
+std::string_view TagRegistry::get_tag_name(TagId tag_id) const {
+    return get_tag_atom(tag_id).str();
 }
 
-std::string TagRegistry::get_tag_name(Entity entity) const {
+std::string_view TagRegistry::get_tag_name(Entity entity) const {
     TagId tag_id = get_tag_id(entity);
 
     if (tag_id == TagRegistry::k_invalid_tag_id) {
@@ -85,7 +90,7 @@ std::optional<Entity> TagRegistry::get_entity(TagId tag_id) const {
     return it->second;
 }
 
-std::optional<Entity> TagRegistry::get_entity(const std::string& name) const {
+std::optional<Entity> TagRegistry::get_entity(Atom name) const {
     TagId tag_id = get_tag_id(name);
 
     if (tag_id == TagRegistry::k_invalid_tag_id) {
@@ -94,3 +99,16 @@ std::optional<Entity> TagRegistry::get_entity(const std::string& name) const {
     }
     return get_entity(tag_id);
 }
+
+void TagRegistry::remap(EntityRemap const& remap) {
+    for (auto const& move : remap.moves()) {
+        auto it = m_entity_to_tag.find(move.from);
+        if (it == m_entity_to_tag.end())
+            continue;
+
+        const TagId k_tag_id = it->second;
+        m_entity_to_tag.erase(it);
+        m_entity_to_tag[move.to] = k_tag_id;
+        m_tag_to_entity[k_tag_id] = move.to;
+    }
+}
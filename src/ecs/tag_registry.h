@@ -1,13 +1,17 @@
 #pragma once
 
+#include "atom.h"
 #include "entity.h"
+#include "entity_remap.h"
 
 #include <optional>
-#include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 namespace ecs {
 
+/// Names bound to entities. Every lookup, by name, id or entity, is a single hash or index.
 class TagRegistry {
   public:
     using TagId = std::size_t;
@@ -23,26 +27,34 @@ class TagRegistry {
     TagRegistry(TagRegistry&&) = delete;                  // Disable move constructor
     TagRegistry const& operator=(TagRegistry&&) = delete; // Disable move assignment
 
-    TagId create_tag(const std::string& name);
+    TagId create_tag(Atom name);
+    /// Bind a tag to an entity, unbinding it from the previous one.
+    /// An entity bound to several tags is looked up by the last one.
     void bind_tag(TagId tag_id, Entity entity);
 
-    TagId create_and_bind_tag(const std::string& name, Entity entity);
+    TagId create_and_bind_tag(Atom name, Entity entity);
 
-    TagId get_tag_id(const std::string& name) const;
+    TagId get_tag_id(Atom name) const;
     TagId get_tag_id(Entity entity) const;
 
-    std::string get_tag_name(TagId tag_id) const;
-    std::string get_tag_name(Entity entity) const;
+    Atom get_tag_atom(TagId tag_id) const;
 
-    std::optional<Entity> get_entity(const std::string& name) const;
+    /// @return The name of the tag, valid for the lifetime of the process.
+    std::string_view get_tag_name(TagId tag_id) const;
+    std::string_view get_tag_name(Entity entity) const;
+
+    std::optional<Entity> get_entity(Atom name) const;
     std::optional<Entity> get_entity(TagId tag_id) const;
 
+    /// Rebind the tags of the entities renumbered by `Registry::compact`.
+    void remap(EntityRemap const& remap);
+
   private:
-    std::unordered_map<std::string, TagId> m_name_to_id;
-    std::unordered_map<TagId, std::string> m_id_to_name;
+    std::unordered_map<Atom, TagId> m_name_to_id;
+    /// Indexed by TagId, ids are handed out in sequence.
+    std::vector<Atom> m_id_to_name;
     std::unordered_map<TagId, Entity> m_tag_to_entity;
-
-    TagId m_next_id = 0;
+    std::unordered_map<Entity, TagId> m_entity_to_tag;
 };
 
 } // namespace ecs
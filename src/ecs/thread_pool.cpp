@@ -0,0 +1,181 @@
+#include "thread_pool.h"
+
+#include "command_buffer.h"
+
+#include <algorithm>
+#include <exception>
+
+namespace {
+
+// Pool and deque index of the calling worker, if it is one
+thread_local ecs::ThreadPool const* t_owner = nullptr;
+thread_local std::size_t t_worker_id = 0;
+
+// Chunks handed out per thread, so that uneven chunks still balance
+constexpr std::size_t k_chunks_per_thread = 4;
+
+// Progress of one parallel_for, kept alive by the helpers that may start after it is over
+struct ParallelLoop {
+    std::function<void(std::size_t, std::size_t)> const* body;
+    // order of the calling thread: each chunk records its commands right after the previous one
+    ecs::CommandOrder order;
+    std::size_t count;
+    std::size_t grain;
+    std::size_t chunks;
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> done{0};
+    std::mutex mutex;
+    std::condition_variable finished;
+    std::exception_ptr error;
+
+    void work() {
+        for (std::size_t chunk = next.fetch_add(1); chunk < chunks; chunk = next.fetch_add(1)) {
+            try {
+                const ecs::CommandOrderScope k_order(ecs::CommandOrder{order.system, order.step + 1 + chunk});
+                (*body)(chunk * grain, std::min(count, (chunk + 1) * grain));
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+            if (done.fetch_add(1) + 1 == chunks) {
+                std::lock_guard<std::mutex> lock(mutex);
+                finished.notify_all();
+            }
+        }
+    }
+};
+
+} // namespace
+
+ecs::ThreadPool::ThreadPool(std::size_t workers) {
+    m_queues.reserve(workers);
+    for (std::size_t i = 0; i < workers; i++)
+        m_queues.push_back(std::make_unique<Queue>());
+
+    m_workers.reserve(workers);
+    for (std::size_t i = 0; i < workers; i++)
+        m_workers.emplace_back([this, i] { worker_loop(i); });
+}
+
+ecs::ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_wake_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (auto& worker : m_workers)
+        worker.join();
+}
+
+void ecs::ThreadPool::submit(Task task) {
+    if (m_queues.empty())
+        return;
+
+    std::size_t id = (t_owner == this) ? t_worker_id
+                                       : m_next_queue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+    {
+        // Counted before it is pushed so a stealer can never take the counter below zero,
+        // and under the wake mutex so a worker about to sleep cannot miss it
+        std::lock_guard<std::mutex> lock(m_wake_mutex);
+        m_pending.fetch_add(1, std::memory_order_relaxed);
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_queues[id]->mutex);
+        m_queues[id]->tasks.push_back(std::move(task));
+    }
+    m_wake.notify_one();
+}
+
+std::size_t ecs::ThreadPool::size() const noexcept {
+    return m_workers.size();
+}
+
+std::size_t ecs::ThreadPool::default_worker_count() noexcept {
+    unsigned int hardware = std::thread::hardware_concurrency();
+
+    return std::max(1U, hardware) - 1;
+}
+
+void ecs::ThreadPool::parallel_for(std::size_t count, std::size_t grain,
+                                   std::function<void(std::size_t, std::size_t)> const& body) {
+    if (count == 0)
+        return;
+    grain = std::max<std::size_t>(grain, 1);
+
+    const std::size_t k_chunks = (count + grain - 1) / grain;
+    if (m_workers.empty() || k_chunks == 1) {
+        body(0, count);
+        return;
+    }
+
+    auto loop = std::make_shared<ParallelLoop>();
+    loop->body = &body;
+    loop->order = CommandOrderScope::current();
+    loop->count = count;
+    loop->grain = grain;
+    loop->chunks = k_chunks;
+
+    const std::size_t k_helpers = std::min(m_workers.size(), k_chunks - 1);
+    for (std::size_t i = 0; i < k_helpers; i++)
+        submit([loop] { loop->work(); });
+    loop->work();
+
+    std::unique_lock<std::mutex> lock(loop->mutex);
+    loop->finished.wait(lock, [&loop] { return loop->done.load() == loop->chunks; });
+    // What the caller records after the loop goes after every chunk
+    CommandOrderScope::advance(k_chunks + 1);
+    if (loop->error)
+        std::rethrow_exception(loop->error);
+}
+
+std::size_t ecs::ThreadPool::chunk_size(std::size_t count, std::size_t element_size) const noexcept {
+    const std::size_t k_per_line = std::max<std::size_t>(1, k_cache_line_size / std::max<std::size_t>(element_size, 1));
+    const std::size_t k_target = count / ((m_workers.size() + 1) * k_chunks_per_thread);
+
+    return std::max(k_per_line, (k_target + k_per_line - 1) / k_per_line * k_per_line);
+}
+
+void ecs::ThreadPool::worker_loop(std::size_t id) {
+    t_owner = this;
+    t_worker_id = id;
+
+    Task task;
+    while (true) {
+        if (try_pop(id, task)) {
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_wake_mutex);
+        m_wake.wait(lock, [this] { return m_stop || m_pending.load(std::memory_order_relaxed) > 0; });
+        if (m_stop && m_pending.load(std::memory_order_relaxed) == 0)
+            return;
+    }
+}
+
+bool ecs::ThreadPool::try_pop(std::size_t id, Task& task) {
+    {
+        auto& own = *m_queues[id];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            m_pending.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    for (std::size_t offset = 1; offset < m_queues.size(); offset++) {
+        auto& victim = *m_queues[(id + offset) % m_queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            m_pending.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
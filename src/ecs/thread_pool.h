@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ecs {
+
+/// Size of a cache line. Parallel chunks are rounded to whole lines so that two
+/// threads do not write to the same one.
+inline constexpr std::size_t k_cache_line_size = 64;
+
+/// Number of elements below which parallel loops run serially on the calling thread.
+inline constexpr std::size_t k_default_parallel_threshold = 4096;
+
+/// Fixed set of worker threads with one task deque each.
+///
+/// A worker pops its own deque from the back (most recently pushed first) and,
+/// once it runs dry, steals from the front of the other deques. Tasks submitted
+/// from a worker go to that worker's deque; tasks submitted from any other thread
+/// are spread round-robin. Tasks must not throw.
+class ThreadPool {
+  public:
+    using Task = std::function<void()>;
+
+    /// Start the workers.
+    /// @param workers Number of worker threads (may be 0, in which case nothing runs).
+    explicit ThreadPool(std::size_t workers = default_worker_count());
+    ~ThreadPool();
+
+    ThreadPool(ThreadPool const&) = delete;
+    ThreadPool& operator=(ThreadPool const&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    /// Queue a task for execution on one of the workers.
+    /// @param task Callable to run.
+    void submit(Task task);
+
+    /// Number of worker threads.
+    std::size_t size() const noexcept;
+
+    /// Split `[0, count)` into chunks of `grain` elements and run `body(begin, end)` on each.
+    /// The calling thread takes chunks too, and returns once every chunk is done. Safe to call
+    /// from a task of this pool. The first exception thrown by `body` is rethrown. Commands recorded
+    /// by the chunks are applied in chunk order (see `CommandOrder`).
+    /// @param count Number of elements.
+    /// @param grain Number of elements per chunk (the last one may be shorter).
+    /// @param body Callable invoked once per chunk, possibly concurrently.
+    void parallel_for(std::size_t count, std::size_t grain,
+                      std::function<void(std::size_t, std::size_t)> const& body);
+
+    /// Chunk length for a parallel loop: a few chunks per thread, rounded up to whole cache lines.
+    /// @param count Number of elements.
+    /// @param element_size Size in bytes of the largest element written per iteration.
+    /// @return A multiple of the number of elements fitting in a cache line.
+    std::size_t chunk_size(std::size_t count, std::size_t element_size) const noexcept;
+
+    /// One worker per hardware thread, minus the thread driving the pool.
+    static std::size_t default_worker_count() noexcept;
+
+  private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> m_queues;
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_wake_mutex;
+    std::condition_variable m_wake;
+    std::atomic<std::size_t> m_pending{0};
+    std::atomic<std::size_t> m_next_queue{0};
+    bool m_stop{false};
+
+    void worker_loop(std::size_t id);
+    bool try_pop(std::size_t id, Task& task);
+};
+
+} // namespace ecs
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "entity.h"
+#include "sparse_array.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace ecs {
+
+/// Iterable set of entities owning every component in `TComponents`.
+///
+/// Iteration is driven by the cheapest participating pool (the dense id list of a
+/// packed pool, or the slot range of a sparse one); the other pools are only probed
+/// for each candidate. Each step yields `(entity, TComponents&...)` with no optional
+/// wrappers. Const-qualify a component type to get read-only access to it: the
+/// components handed out non-const are stamped as written (see `SparseArray::stamp`)
+/// when the view was given a version.
+///
+/// Pools must not be structurally modified while a view is being iterated, except
+/// by adding components (entities gaining components mid-iteration may be skipped).
+/// @tparam TComponents Component types the entities must own.
+template <typename... TComponents> class View {
+    static_assert(sizeof...(TComponents) > 0, "A view needs at least one component type");
+
+  public:
+    using SizeType = std::size_t;
+    using ValueType = std::tuple<Entity, TComponents&...>;
+
+    /// Storage of `TComponent`, const when the component is requested read-only.
+    template <typename TComponent>
+    using StorageType = std::conditional_t<std::is_const_v<TComponent>, SparseArray<std::remove_const_t<TComponent>> const,
+                                           SparseArray<TComponent>>;
+
+    class Iterator {
+      public:
+        using Reference = ValueType;
+        using Pointer = void;
+        using DifferenceType = std::ptrdiff_t;
+        using IteratorCategory = std::input_iterator_tag;
+
+        Iterator() = default;
+        Iterator(View const* view, std::pmr::vector<SizeType> const* candidates, SizeType pos, SizeType end);
+
+        Reference operator*() const;
+        Iterator& operator++();
+        Iterator operator++(int);
+
+        bool operator==(Iterator const& rhs) const noexcept;
+        bool operator!=(Iterator const& rhs) const noexcept;
+
+      private:
+        View const* m_view{nullptr};
+        // Dense ids of the leading pool, or nullptr to walk every id slot of a sparse pool
+        std::pmr::vector<SizeType> const* m_candidates{nullptr};
+        SizeType m_pos{0};
+        SizeType m_end{0};
+
+        SizeType candidate() const noexcept;
+        void skip_missing();
+    };
+
+    /// Build a view over the given pools. Entities are handed out with generation 0.
+    explicit View(StorageType<TComponents>&... pools) noexcept;
+
+    /// Build a view over the given pools, handing out entities with their current generation.
+    /// @param generations Generation table of the registry owning the pools.
+    explicit View(Entity::GenerationTable const& generations, StorageType<TComponents>&... pools) noexcept;
+
+    /// Build a view over the given pools, stamping the non-const components it hands out.
+    /// @param generations Generation table of the registry owning the pools.
+    /// @param version Version the components are stamped with, 0 to leave the stamps untouched.
+    View(Entity::GenerationTable const& generations, Version version, StorageType<TComponents>&... pools) noexcept;
+
+    /// Iterator to the first matching entity.
+    Iterator begin() const;
+    /// Iterator past the last candidate.
+    Iterator end() const;
+
+    /// Check whether the entity at `idx` owns every component of the view.
+    /// @param idx Entity index.
+    /// @return `true` if all the pools hold a component for `idx`.
+    bool contains(SizeType idx) const noexcept;
+
+    /// Upper bound on the number of matching entities (cost of the leading pool).
+    /// @return The number of candidates the view walks.
+    SizeType size_hint() const noexcept;
+
+    /// Call `fn(entity, components&...)` for every matching entity, splitting the leading pool
+    /// into cache-line-aligned chunks run concurrently on `pool`. Below `threshold` candidates
+    /// the walk is serial on the calling thread. `fn` must only touch the entity it is given.
+    /// @param pool Thread pool running the chunks.
+    /// @param fn Callable invoked once per entity, possibly concurrently.
+    /// @param threshold Number of candidates from which the walk is split.
+    template <typename TFunction>
+    void par_each(ThreadPool& pool, TFunction&& fn, SizeType threshold = k_default_parallel_threshold) const;
+
+    /// Access the components of an entity known to be in the view, stamping the non-const ones.
+    /// @param idx Entity index, must satisfy `contains(idx)`.
+    /// @return Tuple of the entity and references to its components.
+    ValueType get(SizeType idx) const;
+
+  private:
+    std::tuple<StorageType<TComponents>*...> m_pools;
+    Entity::GenerationTable const* m_generations{nullptr};
+    Version m_version{0};
+
+    struct Lead {
+        std::pmr::vector<SizeType> const* candidates;
+        SizeType end;
+    };
+
+    /// Pick the pool with the fewest candidates to drive the iteration.
+    Lead lead() const noexcept;
+};
+
+} // namespace ecs
+
+#include "view.tcc"
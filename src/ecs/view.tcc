@@ -0,0 +1,132 @@
+#pragma once
+
+#include "view.h"
+
+namespace ecs {
+
+template <typename... TComponents>
+View<TComponents...>::Iterator::Iterator(View const* view, std::pmr::vector<SizeType> const* candidates, SizeType pos,
+                                         SizeType end)
+    : m_view(view), m_candidates(candidates), m_pos(pos), m_end(end) {
+    skip_missing();
+}
+
+template <typename... TComponents>
+typename View<TComponents...>::Iterator::Reference View<TComponents...>::Iterator::operator*() const {
+    return m_view->get(candidate());
+}
+
+template <typename... TComponents>
+typename View<TComponents...>::Iterator& View<TComponents...>::Iterator::operator++() {
+    ++m_pos;
+    skip_missing();
+    return *this;
+}
+
+template <typename... TComponents>
+typename View<TComponents...>::Iterator View<TComponents...>::Iterator::operator++(int) {
+    Iterator tmp(*this);
+    ++(*this);
+    return tmp;
+}
+
+template <typename... TComponents>
+bool View<TComponents...>::Iterator::operator==(Iterator const& rhs) const noexcept {
+    return m_pos == rhs.m_pos;
+}
+
+template <typename... TComponents>
+bool View<TComponents...>::Iterator::operator!=(Iterator const& rhs) const noexcept {
+    return m_pos != rhs.m_pos;
+}
+
+template <typename... TComponents>
+typename View<TComponents...>::SizeType View<TComponents...>::Iterator::candidate() const noexcept {
+    return m_candidates ? (*m_candidates)[m_pos] : m_pos;
+}
+
+template <typename... TComponents> void View<TComponents...>::Iterator::skip_missing() {
+    while (m_pos < m_end && !m_view->contains(candidate()))
+        ++m_pos;
+}
+
+template <typename... TComponents>
+View<TComponents...>::View(StorageType<TComponents>&... pools) noexcept : m_pools(&pools...) {}
+
+template <typename... TComponents>
+View<TComponents...>::View(Entity::GenerationTable const& generations, StorageType<TComponents>&... pools) noexcept
+    : m_pools(&pools...), m_generations(&generations) {}
+
+template <typename... TComponents>
+View<TComponents...>::View(Entity::GenerationTable const& generations, Version version,
+                           StorageType<TComponents>&... pools) noexcept
+    : m_pools(&pools...), m_generations(&generations), m_version(version) {}
+
+template <typename... TComponents> typename View<TComponents...>::Iterator View<TComponents...>::begin() const {
+    const auto k_lead = lead();
+    return Iterator(this, k_lead.candidates, 0, k_lead.end);
+}
+
+template <typename... TComponents> typename View<TComponents...>::Iterator View<TComponents...>::end() const {
+    const auto k_lead = lead();
+    return Iterator(this, k_lead.candidates, k_lead.end, k_lead.end);
+}
+
+template <typename... TComponents> bool View<TComponents...>::contains(SizeType idx) const noexcept {
+    return std::apply([idx](auto const*... pools) { return (pools->contains(idx) && ...); }, m_pools);
+}
+
+template <typename... TComponents> typename View<TComponents...>::SizeType View<TComponents...>::size_hint() const noexcept {
+    return lead().end;
+}
+
+template <typename... TComponents>
+template <typename TFunction>
+void View<TComponents...>::par_each(ThreadPool& pool, TFunction&& fn, SizeType threshold) const {
+    const auto k_lead = lead();
+    auto walk = [this, &k_lead, &fn](SizeType begin, SizeType end) {
+        for (SizeType pos = begin; pos < end; pos++) {
+            const SizeType k_idx = k_lead.candidates ? (*k_lead.candidates)[pos] : pos;
+            if (contains(k_idx))
+                std::apply(fn, get(k_idx));
+        }
+    };
+
+    if (k_lead.end < threshold) {
+        walk(0, k_lead.end);
+        return;
+    }
+    const SizeType k_element_size = std::max({sizeof(std::optional<std::remove_const_t<TComponents>>)...});
+    pool.parallel_for(k_lead.end, pool.chunk_size(k_lead.end, k_element_size), walk);
+}
+
+template <typename... TComponents>
+typename View<TComponents...>::ValueType View<TComponents...>::get(SizeType idx) const {
+    if (m_version != 0) {
+        auto stamp = [this, idx](auto* pool) {
+            if constexpr (!std::is_const_v<std::remove_pointer_t<decltype(pool)>>)
+                pool->stamp(idx, m_version);
+        };
+        std::apply([&stamp](auto*... pools) { (stamp(pools), ...); }, m_pools);
+    }
+    return std::apply([this, idx](auto*... pools) { return ValueType(Entity::at(m_generations, idx), (*pools)[idx].value()...); },
+                      m_pools);
+}
+
+template <typename... TComponents> typename View<TComponents...>::Lead View<TComponents...>::lead() const noexcept {
+    Lead best{nullptr, static_cast<SizeType>(-1)};
+
+    auto consider = [&best](auto const* pool) {
+        if constexpr (requires { pool->indices(); }) {
+            if (pool->count() < best.end)
+                best = Lead{&pool->indices(), pool->count()};
+        } else {
+            if (pool->size() < best.end)
+                best = Lead{nullptr, pool->size()};
+        }
+    };
+    std::apply([&consider](auto const*... pools) { (consider(pools), ...); }, m_pools);
+    return best;
+}
+
+} // namespace ecs
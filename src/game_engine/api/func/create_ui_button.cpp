@@ -29,7 +29,7 @@ constexpr unsigned char k_color_darker_gray = 60;
 constexpr float k_button_border_radius = 5.0f;
 constexpr float k_button_border_width = 2.0f;
 
-void lua::create_ui_button(EngineContext& ctx, std::string name) {
+void lua::create_ui_button(EngineContext& ctx, ecs::Atom name) {
     const ecs::Entity k_e = ctx.registry.spawn_entity();
 
     ecs::TagRegistry::TagId id = ctx.registry.get_tag_registry().create_and_bind_tag(name, k_e);
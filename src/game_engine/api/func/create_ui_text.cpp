@@ -36,7 +36,7 @@ static auto read_text(sol::table table) {
     return text;
 }
 
-void lua::create_ui_text(EngineContext& ctx, std::string name, sol::table t) {
+void lua::create_ui_text(EngineContext& ctx, ecs::Atom name, sol::table t) {
     const ecs::Entity k_e = ctx.registry.spawn_entity();
 
     ecs::TagRegistry::TagId id = ctx.registry.get_tag_registry().create_and_bind_tag(name, k_e);
@@ -27,7 +27,7 @@ static auto read_navigation(const ecs::TagRegistry& tags, sol::table table) {
     return navigation;
 }
 
-void lua::set_ui_navigation(EngineContext& ctx, std::string tag, sol::table t) {
+void lua::set_ui_navigation(EngineContext& ctx, ecs::Atom tag, sol::table t) {
     auto entity = ctx.registry.get_tag_registry().get_entity(tag);
 
     if (!entity.has_value()) {
@@ -20,7 +20,7 @@ static auto read_color(sol::table table) {
     return color;
 }
 
-void lua::set_ui_style(EngineContext& ctx, std::string tag, sol::table t) {
+void lua::set_ui_style(EngineContext& ctx, ecs::Atom tag, sol::table t) {
     auto entity = ctx.registry.get_tag_registry().get_entity(tag);
 
     if (!entity.has_value()) {
@@ -18,7 +18,7 @@ static auto read_text(sol::table table) {
     return text;
 }
 
-void lua::set_ui_text(EngineContext& ctx, std::string tag, sol::table t) {
+void lua::set_ui_text(EngineContext& ctx, ecs::Atom tag, sol::table t) {
     auto entity = ctx.registry.get_tag_registry().get_entity(tag);
 
     if (!entity.has_value()) {
@@ -13,13 +13,13 @@ void load_lua_scripts_from_folder_recurse(sol::state& lua, const std::string& sc
 
 extern const std::vector<std::unique_ptr<LuaApiEntryBase>> k_api_functions;
 
-void create_ui_button(EngineContext& ctx, std::string name);
-void create_ui_text(EngineContext& ctx, std::string name, sol::table t);
-void create_ui_input_field(EngineContext& ctx, std::string name, std::string default_value);
-void set_ui_transform(EngineContext& ctx, std::string name, sol::table t);
-void set_ui_style(EngineContext& ctx, std::string name, sol::table t);
-void set_ui_text(EngineContext& ctx, std::string name, sol::table t);
-void set_ui_navigation(EngineContext& ctx, std::string name, sol::table t);
+void create_ui_button(EngineContext& ctx, ecs::Atom name);
+void create_ui_text(EngineContext& ctx, ecs::Atom name, sol::table t);
+void create_ui_input_field(EngineContext& ctx, ecs::Atom name, std::string default_value);
+void set_ui_transform(EngineContext& ctx, ecs::Atom name, sol::table t);
+void set_ui_style(EngineContext& ctx, ecs::Atom name, sol::table t);
+void set_ui_text(EngineContext& ctx, ecs::Atom name, sol::table t);
+void set_ui_navigation(EngineContext& ctx, ecs::Atom name, sol::table t);
 
 } // namespace lua
 
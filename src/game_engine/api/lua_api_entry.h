@@ -3,6 +3,7 @@
 #include <functional>
 #include <string>
 
+#include "ecs/atom.h"
 #include "sol/sol.hpp"
 
 namespace engn {
@@ -22,6 +23,15 @@ class LuaApiEntryBase {
     virtual void expose(sol::state&, EngineContext&) const = 0;
 };
 
+// Type an argument is received as from Lua. Names reach the engine as atoms: the strings
+// are interned once, when they cross the boundary.
+template <typename TArg> struct LuaArg {
+    using Type = TArg;
+};
+template <> struct LuaArg<ecs::Atom> {
+    using Type = std::string;
+};
+
 template <typename... TArgs> class LuaApiEntry : public LuaApiEntryBase {
   public:
     LuaApiEntry(std::string name, std::function<void(EngineContext&, TArgs...)> func);
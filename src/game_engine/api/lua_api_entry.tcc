@@ -16,7 +16,9 @@ LuaApiEntry<TArgs...>::LuaApiEntry(std::string name, std::function<void(EngineCo
 
 template <typename... TArgs> void LuaApiEntry<TArgs...>::expose(sol::state& lua, EngineContext& ctx) const {
     auto& f = this->m_func;
-    lua.set_function(m_name, [&f, &ctx](TArgs... args) { return f(ctx, std::move(args)...); });
+    lua.set_function(m_name, [&f, &ctx](typename LuaArg<TArgs>::Type... args) {
+        return f(ctx, TArgs(std::move(args))...);
+    });
 }
 
 } // namespace engn::lua
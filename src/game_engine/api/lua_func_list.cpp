@@ -8,19 +8,19 @@ namespace engn::lua {
 
 const std::vector<std::unique_ptr<LuaApiEntryBase>> k_api_functions = []() {
     std::vector<std::unique_ptr<LuaApiEntryBase>> temp;
-    temp.emplace_back(std::make_unique<LuaApiEntry<std::string>>("Create_ui_button", create_ui_button));
+    temp.emplace_back(std::make_unique<LuaApiEntry<ecs::Atom>>("Create_ui_button", create_ui_button));
     temp.emplace_back(
-        std::make_unique<LuaApiEntry<std::string, sol::table>>("Create_ui_text", create_ui_text));
-    temp.emplace_back(std::make_unique<LuaApiEntry<std::string, std::string>>("Create_ui_input_field",
+        std::make_unique<LuaApiEntry<ecs::Atom, sol::table>>("Create_ui_text", create_ui_text));
+    temp.emplace_back(std::make_unique<LuaApiEntry<ecs::Atom, std::string>>("Create_ui_input_field",
                                                                                              create_ui_input_field));
     temp.emplace_back(
-        std::make_unique<LuaApiEntry<std::string, sol::table>>("Set_ui_style", set_ui_style));
+        std::make_unique<LuaApiEntry<ecs::Atom, sol::table>>("Set_ui_style", set_ui_style));
     temp.emplace_back(
-        std::make_unique<LuaApiEntry<std::string, sol::table>>("Set_ui_transform", set_ui_transform));
+        std::make_unique<LuaApiEntry<ecs::Atom, sol::table>>("Set_ui_transform", set_ui_transform));
     temp.emplace_back(
-        std::make_unique<LuaApiEntry<std::string, sol::table>>("Set_ui_text", set_ui_text));
+        std::make_unique<LuaApiEntry<ecs::Atom, sol::table>>("Set_ui_text", set_ui_text));
     temp.emplace_back(
-        std::make_unique<LuaApiEntry<std::string, sol::table>>("Set_ui_navigation", set_ui_navigation));
+        std::make_unique<LuaApiEntry<ecs::Atom, sol::table>>("Set_ui_navigation", set_ui_navigation));
     return temp;
 }();
 
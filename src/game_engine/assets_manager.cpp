@@ -5,7 +5,7 @@
 
 using namespace engn;
 
-bool AssetsManager::load_music(const std::string& asset_id, const std::string& file_path) {
+bool AssetsManager::load_music(Asset asset_id, const std::string& file_path) {
     Music music = LoadMusicStream(file_path.c_str());
     if (music.stream.buffer == nullptr) {
         LOG_ERROR("Failed to load Music asset '{}' from '{}'", asset_id, file_path);
@@ -15,7 +15,7 @@ bool AssetsManager::load_music(const std::string& asset_id, const std::string& f
     return true;
 }
 
-bool AssetsManager::load_sound(const std::string& asset_id, const std::string& file_path) {
+bool AssetsManager::load_sound(Asset asset_id, const std::string& file_path) {
     Sound sound = LoadSound(file_path.c_str());
     if (sound.stream.buffer == nullptr) {
         LOG_ERROR("Failed to load Sound asset '{}' from '{}'", asset_id, file_path);
@@ -25,7 +25,7 @@ bool AssetsManager::load_sound(const std::string& asset_id, const std::string& f
     return true;
 }
 
-bool AssetsManager::load_texture(const std::string& asset_id, const std::string& file_path) {
+bool AssetsManager::load_texture(Asset asset_id, const std::string& file_path) {
     Texture2D texture = LoadTexture(file_path.c_str());
     if (texture.id == 0) {
         LOG_ERROR("Failed to load Texture asset '{}' from '{}'", asset_id, file_path);
@@ -38,7 +38,7 @@ bool AssetsManager::load_texture(const std::string& asset_id, const std::string&
     return true;
 }
 
-void AssetsManager::unload_asset(const std::string& asset_id) {
+void AssetsManager::unload_asset(Asset asset_id) {
     auto it = m_assets.find(asset_id);
     if (it != m_assets.end()) {
         m_assets.erase(it);
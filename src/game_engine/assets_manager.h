@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ecs/atom.h"
+
 #include <any>
 #include <memory>
 #include <optional>
@@ -10,7 +12,8 @@ namespace engn {
 
 class AssetsManager {
   public:
-    using Asset = std::string;
+    // Assets are named by atoms: looking one up hashes an integer, not a string
+    using Asset = ecs::Atom;
 
     AssetsManager() = default;
     ~AssetsManager() = default;
@@ -20,17 +23,17 @@ class AssetsManager {
     AssetsManager& operator=(AssetsManager&&) = delete;
 
     // Specific load functions for each asset type
-    bool load_music(const std::string& asset_id, const std::string& file_path);
-    bool load_sound(const std::string& asset_id, const std::string& file_path);
-    bool load_texture(const std::string& asset_id, const std::string& file_path);
+    bool load_music(Asset asset_id, const std::string& file_path);
+    bool load_sound(Asset asset_id, const std::string& file_path);
+    bool load_texture(Asset asset_id, const std::string& file_path);
 
-    void unload_asset(const std::string& asset_id);
+    void unload_asset(Asset asset_id);
 
     // Generic get function
-    template <typename TAsset> std::optional<TAsset> get_asset(const std::string& asset_id);
+    template <typename TAsset> std::optional<TAsset> get_asset(Asset asset_id);
 
   private:
-    std::unordered_map<std::string, std::unique_ptr<std::any>> m_assets;
+    std::unordered_map<Asset, std::unique_ptr<std::any>> m_assets;
 };
 
 } // namespace engn
@@ -9,7 +9,7 @@
 
 namespace engn {
 
-template <typename TAsset> std::optional<TAsset> AssetsManager::get_asset(const std::string& asset_id) {
+template <typename TAsset> std::optional<TAsset> AssetsManager::get_asset(Asset asset_id) {
     auto it = m_assets.find(asset_id);
     if (it == m_assets.end()) {
         // LOG_ERROR("Asset with id '{}' not found", asset_id);
@@ -1,11 +1,11 @@
 #pragma once
 
-#include "components/i_sync_component.h"
+#include "components/sync_traits.h"
 #include "raylib.h"
 
 namespace engn::cpnt {
 
-struct Boss : ISyncComponent {
+struct Boss {
     // Tag component for enemies
 
     float timer{};
@@ -27,8 +27,13 @@ struct Boss : ISyncComponent {
          float waveRadius = 0.0f,
          float waveSpeed = 2000.0f);
 
-    engn::SerializedComponent serialize() const override;
-    void deserialize(const std::vector<std::byte>& data) override;
+    static constexpr engn::ComponentType k_sync_type = engn::ComponentType::boss;
+    static constexpr auto sync_fields() noexcept {
+        return std::tuple{
+            &Boss::timer, &Boss::cooldown_1, &Boss::cooldown_2, &Boss::time_to_roar, &Boss::roar_active,
+            &Boss::waveCenter, &Boss::waveRadius, &Boss::waveSpeed
+        };
+    }
 };
 
 } // namespace engn::cpnt
@@ -2,11 +2,11 @@
 
 #include <cstdint>
 
-#include "components/i_sync_component.h"
+#include "components/sync_traits.h"
 
 namespace engn::cpnt {
 
-struct BossHitbox : ISyncComponent {
+struct BossHitbox {
     float width_1{}, height_1{};
     float offset_x_1{}, offset_y_1{};
 
@@ -22,8 +22,14 @@ struct BossHitbox : ISyncComponent {
                float width_2 = 0.0f, float height_2 = 0.0f, float offset_x_2 = 0.0f, float offset_y_2 = 0.0f,
                float width_3 = 0.0f, float height_3 = 0.0f, float offset_x_3 = 0.0f, float offset_y_3 = 0.0f);
 
-    engn::SerializedComponent serialize() const override;
-    void deserialize(const std::vector<std::byte>& data) override;
+    static constexpr engn::ComponentType k_sync_type = engn::ComponentType::boss_hitbox;
+    static constexpr auto sync_fields() noexcept {
+        return std::tuple{
+            &BossHitbox::width_1, &BossHitbox::height_1, &BossHitbox::offset_x_1, &BossHitbox::offset_y_1,
+            &BossHitbox::width_2, &BossHitbox::height_2, &BossHitbox::offset_x_2, &BossHitbox::offset_y_2,
+            &BossHitbox::width_3, &BossHitbox::height_3, &BossHitbox::offset_x_3, &BossHitbox::offset_y_3
+        };
+    }
 };
 
 } // namespace engn::cpnt
@@ -1,16 +1,21 @@
 #pragma once
 
-#include "components/i_sync_component.h"
+#include "components/sync_traits.h"
+#include "ecs/sparse_array.h"
 
 namespace engn::cpnt {
 
-struct Bullet : ISyncComponent {
+struct Bullet {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+
     // Tag component for bullets
 
     Bullet() = default;
 
-    engn::SerializedComponent serialize() const override;
-    void deserialize(const std::vector<std::byte>& data) override;
+    static constexpr engn::ComponentType k_sync_type = engn::ComponentType::bullet;
+    static constexpr auto sync_fields() noexcept {
+        return std::tuple{};
+    }
 };
 
 } // namespace engn::cpnt
@@ -1,16 +1,18 @@
 #pragma once
 
-#include "components/i_sync_component.h"
+#include "components/sync_traits.h"
 
 namespace engn::cpnt {
 
-struct BulletShooter : ISyncComponent {
+struct BulletShooter {
     // Tag component for BulletShooters
 
     BulletShooter() = default;
 
-    engn::SerializedComponent serialize() const override;
-    void deserialize(const std::vector<std::byte>& data) override;
+    static constexpr engn::ComponentType k_sync_type = engn::ComponentType::bullet_shooter;
+    static constexpr auto sync_fields() noexcept {
+        return std::tuple{};
+    }
 };
 
 } // namespace engn::cpnt
@@ -1,17 +1,19 @@
 #pragma once
 
-#include "components/i_sync_component.h"
+#include "components/sync_traits.h"
 
 namespace engn::cpnt {
 
-struct Controllable : ISyncComponent {
+struct Controllable {
     float speed{};
 
     Controllable() = default;
     Controllable(float speed);
 
-    engn::SerializedComponent serialize() const override;
-    void deserialize(const std::vector<std::byte>& data) override;
+    static constexpr engn::ComponentType k_sync_type = engn::ComponentType::controllable;
+    static constexpr auto sync_fields() noexcept {
+        return std::tuple{&Controllable::speed};
+    }
 };
 
 } // namespace engn::cpnt
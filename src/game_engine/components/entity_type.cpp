@@ -1,45 +1,40 @@
 #include "components/entity_type.h"
+#include <cstdint>
 #include <cstring>
+#include <string_view>
 
 using namespace engn::cpnt;
 
-EntityType::EntityType(const std::string& type_name) : type_name(type_name) {}
+EntityType::EntityType(ecs::Atom type_name) : type_name(type_name) {}
 
-EntityType::EntityType(std::string&& type_name) : type_name(std::move(type_name)) {}
-
-engn::SerializedComponent EntityType::serialize() const {
-    engn::SerializedComponent serialized;
-    serialized.type = engn::ComponentType::entity_type;
+std::size_t SyncTraits<EntityType>::size(EntityType const& component) noexcept {
+    return sizeof(std::uint32_t) + component.type_name.str().size();
+}
 
-    // Serialize string length + string data
-    std::uint32_t str_length = static_cast<std::uint32_t>(type_name.size());
-    std::uint32_t size = sizeof(str_length) + str_length;
-    serialized.data.resize(size);
+void SyncTraits<EntityType>::write(EntityType const& component, std::byte* out) noexcept {
+    const std::string_view k_name = component.type_name.str();
+    std::uint32_t str_length = static_cast<std::uint32_t>(k_name.size());
 
     // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    std::size_t offset = 0;
-    std::memcpy(serialized.data.data() + offset, &str_length, sizeof(str_length));
-    offset += sizeof(str_length);
-    std::memcpy(serialized.data.data() + offset, type_name.data(), str_length);
+    std::memcpy(out, &str_length, sizeof(str_length));
+    std::memcpy(out + sizeof(str_length), k_name.data(), str_length);
     // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-
-    return serialized;
 }
 
-void EntityType::deserialize(const std::vector<std::byte>& data) {
-    if (data.size() < sizeof(std::uint32_t)) {
-        return;
-    }
-
-    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-    std::size_t offset = 0;
+bool SyncTraits<EntityType>::read(EntityType& component, std::span<std::byte const> in) {
     std::uint32_t str_length = 0;
-    std::memcpy(&str_length, data.data() + offset, sizeof(str_length));
-    offset += sizeof(str_length);
 
-    if (data.size() >= offset + str_length) {
-        type_name.resize(str_length);
-        std::memcpy(type_name.data(), data.data() + offset, str_length);
+    if (in.size() < sizeof(str_length)) {
+        return false;
     }
-    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::memcpy(&str_length, in.data(), sizeof(str_length));
+    if (in.size() - sizeof(str_length) < str_length) {
+        return false;
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    component.type_name =
+        ecs::Atom{std::string_view{reinterpret_cast<char const*>(in.data() + sizeof(str_length)), str_length}};
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return true;
 }
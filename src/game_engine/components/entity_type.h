@@ -1,19 +1,26 @@
 #pragma once
 
-#include "components/i_sync_component.h"
-#include <string>
+#include "components/sync_traits.h"
+#include "ecs/atom.h"
 
 namespace engn::cpnt {
 
-struct EntityType : ISyncComponent {
-    std::string type_name;
+struct EntityType {
+    ecs::Atom type_name;
 
     EntityType() = default;
-    explicit EntityType(const std::string& type_name);
-    explicit EntityType(std::string&& type_name);
+    explicit EntityType(ecs::Atom type_name);
+};
+
+// Atoms are local to a process, so the type name is sent as a string: its length (std::uint32_t)
+// followed by its characters, interned again on reception
+template <>
+struct SyncTraits<EntityType> {
+    static constexpr ComponentType k_type = ComponentType::entity_type;
 
-    engn::SerializedComponent serialize() const override;
-    void deserialize(const std::vector<std::byte>& data) override;
+    static std::size_t size(EntityType const& component) noexcept;
+    static void write(EntityType const& component, std::byte* out) noexcept;
+    static bool read(EntityType& component, std::span<std::byte const> in);
 };
 
 } // namespace engn::cpnt
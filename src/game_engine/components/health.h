@@ -3,11 +3,11 @@
 #include <array>
 #include <cstddef>
 
-#include "components/i_sync_component.h"
+#include "components/sync_traits.h"
 
 namespace engn::cpnt {
 
-struct Health : ISyncComponent {
+struct Health {
     int hp{};
     int max_hp{};
     int changes{};
@@ -15,8 +15,10 @@ struct Health : ISyncComponent {
     Health() = default;
     Health(int hp, int max_hp, int changes = 0);
 
-    engn::SerializedComponent serialize() const override;
-    void deserialize(const std::vector<std::byte>& data) override;
+    static constexpr engn::ComponentType k_sync_type = engn::ComponentType::health;
+    static constexpr auto sync_fields() noexcept {
+        return std::tuple{&Health::hp, &Health::max_hp, &Health::changes};
+    }
 };
 
 } // namespace engn::cpnt
@@ -2,19 +2,21 @@
 
 #include <cstdint>
 
-#include "components/i_sync_component.h"
+#include "components/sync_traits.h"
 
 namespace engn::cpnt {
 
-struct Hitbox : ISyncComponent {
+struct Hitbox {
     float width{}, height{};
     float offset_x{}, offset_y{};
 
     Hitbox() = default;
     Hitbox(float width, float height, float offset_x = 0.0f, float offset_y = 0.0f);
 
-    engn::SerializedComponent serialize() const override;
-    void deserialize(const std::vector<std::byte>& data) override;
+    static constexpr engn::ComponentType k_sync_type = engn::ComponentType::hitbox;
+    static constexpr auto sync_fields() noexcept {
+        return std::tuple{&Hitbox::width, &Hitbox::height, &Hitbox::offset_x, &Hitbox::offset_y};
+    }
 };
 
 } // namespace engn::cpnt
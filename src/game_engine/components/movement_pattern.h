@@ -1,10 +1,13 @@
 #pragma once
 
-#include "components/i_sync_component.h"
+#include "components/sync_traits.h"
+#include "ecs/sparse_array.h"
 
 namespace engn::cpnt {
 
-struct MovementPattern : ISyncComponent {
+struct MovementPattern {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+
     enum class PatternType { Straight, Sine, ZigZag, Dive };
 
     PatternType type{};
@@ -18,8 +21,13 @@ struct MovementPattern : ISyncComponent {
     MovementPattern(PatternType type, float speed, float amplitude = 0.0f, 
                    float frequency = 0.0f, float timer = 0.0f, float base_y = 0.0f);
 
-    engn::SerializedComponent serialize() const override;
-    void deserialize(const std::vector<std::byte>& data) override;
+    static constexpr engn::ComponentType k_sync_type = engn::ComponentType::movement_pattern;
+    static constexpr auto sync_fields() noexcept {
+        return std::tuple{
+            &MovementPattern::type, &MovementPattern::speed, &MovementPattern::amplitude, &MovementPattern::frequency,
+            &MovementPattern::timer, &MovementPattern::base_y
+        };
+    }
 };
 
 } // namespace engn::cpnt
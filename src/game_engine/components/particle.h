@@ -1,8 +1,12 @@
 #pragma once
 
+#include "ecs/sparse_array.h"
+
 namespace engn::cpnt {
 
 struct Particle {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+
     float lifetime{};
     float max_lifetime{};
     unsigned char red{};
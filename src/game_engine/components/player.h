@@ -1,20 +1,22 @@
 #pragma once
 
-#include "components/i_sync_component.h"
+#include "components/sync_traits.h"
 
 #include <cstring>
 
 namespace engn::cpnt {
 
-struct Player : ISyncComponent {
+struct Player {
     std::uint8_t id{0};
     float shoot_cooldown{0.2f};
 
     Player() = default;
     Player(std::uint8_t player_id);
 
-    engn::SerializedComponent serialize() const override;
-    void deserialize(const std::vector<std::byte>& data) override;
+    static constexpr engn::ComponentType k_sync_type = engn::ComponentType::player;
+    static constexpr auto sync_fields() noexcept {
+        return std::tuple{&Player::id, &Player::shoot_cooldown};
+    }
 };
 
 } // namespace engn::cpnt
\ No newline at end of file
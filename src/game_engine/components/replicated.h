@@ -2,21 +2,25 @@
 
 #include <string>
 
-#include "components/i_sync_component.h"
+#include "components/sync_traits.h"
 
 namespace engn::cpnt {
 
 // Component that marks an entity as replicated over the network.
-struct Replicated : ISyncComponent {
+// `tag` and `generation` are the index and generation of the entity on the server.
+struct Replicated {
     std::uint32_t tag;
+    std::uint32_t generation = 0;
 
     size_t last_update_tick = 0;
 
     Replicated() = default;
-    Replicated(std::uint32_t tag, size_t last_update_tick = 0);
+    Replicated(std::uint32_t tag, std::uint32_t generation = 0, size_t last_update_tick = 0);
 
-    engn::SerializedComponent serialize() const override;
-    void deserialize(const std::vector<std::byte>& data) override;
+    static constexpr engn::ComponentType k_sync_type = engn::ComponentType::replicated;
+    static constexpr auto sync_fields() noexcept {
+        return std::tuple{&Replicated::tag, &Replicated::generation, &Replicated::last_update_tick};
+    }
 };
 
 } // namespace engn::cpnt
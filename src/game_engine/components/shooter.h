@@ -1,10 +1,10 @@
 #pragma once
 
-#include "components/i_sync_component.h"
+#include "components/sync_traits.h"
 
 namespace engn::cpnt {
 
-struct Shooter : ISyncComponent {
+struct Shooter {
     // Tag component for enemies
 
     float timer{};
@@ -12,8 +12,10 @@ struct Shooter : ISyncComponent {
     Shooter() = default;
     Shooter(float time);
 
-    engn::SerializedComponent serialize() const override;
-    void deserialize(const std::vector<std::byte>& data) override;
+    static constexpr engn::ComponentType k_sync_type = engn::ComponentType::shooter;
+    static constexpr auto sync_fields() noexcept {
+        return std::tuple{&Shooter::timer};
+    }
 };
 
 } // namespace engn::cpnt
@@ -1,8 +1,12 @@
 #pragma once
 
+#include "ecs/sparse_array.h"
+
 namespace engn::cpnt {
 
 struct Star {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+
     float z; // depth for parallax
 };
 
@@ -1,10 +1,10 @@
 #pragma once
 
-#include "components/i_sync_component.h"
+#include "components/sync_traits.h"
 
 namespace engn::cpnt {
 
-struct Stats : ISyncComponent {
+struct Stats {
     int score{};
     int dmg{};
     int kills{};
@@ -15,8 +15,12 @@ struct Stats : ISyncComponent {
     Stats() = default;
     Stats(int score, int dmg, int kills, int level = 1, int point_to_next_level = 2500, bool boss_active = false);
 
-    engn::SerializedComponent serialize() const override;
-    void deserialize(const std::vector<std::byte>& data) override;
+    static constexpr engn::ComponentType k_sync_type = engn::ComponentType::stats;
+    static constexpr auto sync_fields() noexcept {
+        return std::tuple{
+            &Stats::score, &Stats::dmg, &Stats::kills, &Stats::level, &Stats::point_to_next_level, &Stats::boss_active
+        };
+    }
 };
 
 } // namespace engn::cpnt
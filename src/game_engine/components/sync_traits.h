@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "snapshots.h"
+
+namespace engn::cpnt {
+
+// Wire description of the components synchronized over the network (e.g., networked multiplayer).
+//
+// A component opts in by declaring its wire type and the fields it sends, in wire order:
+//     static constexpr engn::ComponentType k_sync_type = engn::ComponentType::...;
+//     static constexpr auto sync_fields() noexcept { return std::tuple{&Component::a, &Component::b}; }
+// Each field is copied as raw bytes, back to back without padding, so the component must stay
+// a trivially copyable, standard-layout struct. Components holding variable-sized data
+// (e.g., strings) specialize SyncTraits instead.
+template <typename TComponent>
+struct SyncTraits {
+    static_assert(std::is_trivially_copyable_v<TComponent> && std::is_standard_layout_v<TComponent>,
+        "Sync components described by sync_fields() must be trivially copyable and standard-layout");
+
+    static constexpr ComponentType k_type = TComponent::k_sync_type;
+
+    // Number of bytes written by write()
+    static constexpr std::size_t size(TComponent const& /*component*/) noexcept { return k_size; }
+
+    // Write the fields to `out`, which must hold size() bytes
+    static void write(TComponent const& component, std::byte* out) noexcept
+    {
+        std::apply([&component, &out](auto... fields) {
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            ((std::memcpy(out, &(component.*fields), sizeof(component.*fields)), out += sizeof(component.*fields)), ...);
+            // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }, TComponent::sync_fields());
+    }
+
+    // Read the fields back, leaving the component untouched if `in` is too short
+    static bool read(TComponent& component, std::span<std::byte const> in) noexcept
+    {
+        if (in.size() < k_size) return false;
+
+        const std::byte *ptr = in.data();
+        std::apply([&component, &ptr](auto... fields) {
+            // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            ((std::memcpy(&(component.*fields), ptr, sizeof(component.*fields)), ptr += sizeof(component.*fields)), ...);
+            // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }, TComponent::sync_fields());
+        return true;
+    }
+
+  private:
+    static constexpr std::size_t k_size = std::apply([](auto... fields) {
+        return (std::size_t{0} + ... + sizeof(std::declval<TComponent const&>().*fields));
+    }, TComponent::sync_fields());
+};
+
+// Serialized size of a component
+template <typename TComponent>
+std::size_t sync_size(TComponent const& component) noexcept
+{
+    return SyncTraits<TComponent>::size(component);
+}
+
+// Serialize a component into a caller-provided buffer.
+// Returns the number of bytes written, or 0 if `out` is too small (nothing is written then).
+template <typename TComponent>
+std::size_t serialize_into(TComponent const& component, std::span<std::byte> out) noexcept
+{
+    const std::size_t k_size = SyncTraits<TComponent>::size(component);
+
+    if (out.size() < k_size) return 0;
+    SyncTraits<TComponent>::write(component, out.data());
+    return k_size;
+}
+
+// Serialize a component into a SerializedComponent tagged with its wire type
+template <typename TComponent>
+engn::SerializedComponent serialize(TComponent const& component)
+{
+    engn::SerializedComponent serialized;
+    serialized.type = SyncTraits<TComponent>::k_type;
+    serialized.data.resize(SyncTraits<TComponent>::size(component));
+    SyncTraits<TComponent>::write(component, serialized.data.data());
+    return serialized;
+}
+
+// Deserialize a component. Returns false, leaving it untouched, if `data` is too short.
+template <typename TComponent>
+bool deserialize(TComponent& component, std::span<std::byte const> data)
+{
+    return SyncTraits<TComponent>::read(component, data);
+}
+
+} // namespace engn::cpnt
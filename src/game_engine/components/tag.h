@@ -1,18 +1,20 @@
 #pragma once
 
 #include "ecs/tag_registry.h"
-#include "components/i_sync_component.h"
+#include "components/sync_traits.h"
 
 namespace engn::cpnt {
 
-struct Tag : ISyncComponent {
+struct Tag {
     ecs::TagRegistry::TagId id = ecs::TagRegistry::k_invalid_tag_id;
 
     Tag() = default;
     Tag(ecs::TagRegistry::TagId id);
 
-    engn::SerializedComponent serialize() const override;
-    void deserialize(const std::vector<std::byte>& data) override;
+    static constexpr engn::ComponentType k_sync_type = engn::ComponentType::tag;
+    static constexpr auto sync_fields() noexcept {
+        return std::tuple{&Tag::id};
+    }
 };
 
 } // namespace engn::cpnt
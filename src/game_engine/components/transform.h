@@ -1,10 +1,13 @@
 #pragma once
 
-#include "components/i_sync_component.h"
+#include "components/sync_traits.h"
+#include "ecs/sparse_array.h"
 
 namespace engn::cpnt {
 
-struct Transform : ISyncComponent {
+struct Transform {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+
     float x{};
     float y{};
     float z{};
@@ -26,8 +29,13 @@ struct Transform : ISyncComponent {
               float rx = 0.0f, float ry = 0.0f, float rz = 0.0f,
               float sx = 1.0f, float sy = 1.0f, float sz = 1.0f);
 
-    engn::SerializedComponent serialize() const override;
-    void deserialize(const std::vector<std::byte>& data) override;
+    static constexpr engn::ComponentType k_sync_type = engn::ComponentType::transform;
+    static constexpr auto sync_fields() noexcept {
+        return std::tuple{
+            &Transform::x, &Transform::y, &Transform::z, &Transform::origin_x, &Transform::origin_y, &Transform::rx,
+            &Transform::ry, &Transform::rz, &Transform::sx, &Transform::sy, &Transform::sz
+        };
+    }
 };
 
 } // namespace engn::cpnt
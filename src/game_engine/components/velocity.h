@@ -1,10 +1,13 @@
 #pragma once
 
-#include "components/i_sync_component.h"
+#include "components/sync_traits.h"
+#include "ecs/sparse_array.h"
 
 namespace engn::cpnt {
 
-struct Velocity : ISyncComponent{
+struct Velocity {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+
     float vx{};
     float vy{};
     float vz{};
@@ -17,8 +20,10 @@ struct Velocity : ISyncComponent{
     Velocity(float vx, float vy, float vz = 0.0f,
              float vrx = 0.0f, float vry = 0.0f, float vrz = 0.0f);
 
-    engn::SerializedComponent serialize() const override;
-    void deserialize(const std::vector<std::byte>& data) override;
+    static constexpr engn::ComponentType k_sync_type = engn::ComponentType::velocity;
+    static constexpr auto sync_fields() noexcept {
+        return std::tuple{&Velocity::vx, &Velocity::vy, &Velocity::vz, &Velocity::vrx, &Velocity::vry, &Velocity::vrz};
+    }
 };
 
 } // namespace engn::cpnt
\ No newline at end of file
@@ -4,7 +4,9 @@
 #include "components/components.h"
 #include "utils/logger.h"
 
+#include <algorithm>
 #include <filesystem>
+#include <utility>
 
 using namespace engn;
 
@@ -14,7 +16,7 @@ constexpr unsigned char k_max_scene_id = 255;
 
 static void expose_cpp_api(sol::state& lua, EngineContext& ctx);
 
-EngineContext::EngineContext() : server_port(0), m_current_scene("") {
+EngineContext::EngineContext() : registry(&scene_arena), server_port(0), m_current_scene("") {
     m_snapshots_history.reserve(4); // Reserve for 4 players
     for (auto &snapshot: m_snapshots_history)
         snapshot.second.reserve(SNAPSHOT_HISTORY_SIZE); // Make sure enough space for snapshots hystory
@@ -26,15 +28,28 @@ EngineContext::EngineContext() : server_port(0), m_current_scene("") {
 void EngineContext::run_systems() {
     input_event_queue.clear();
     ui_event_queue.clear();
-    auto curr_scene_buff = m_current_scene;
-    for (auto& sys : m_systems) {
-        if (curr_scene_buff != m_current_scene) {
+    m_running_systems = true;
+    try {
+        m_scheduler.run([this] {
+            if (!m_pending_scene.has_value())
+                return false;
             LOG_DEBUG("Scene changed during system execution, stopping further system execution");
-            break;
-        }
-        if (sys)
-            sys(*this);
+            return true;
+        });
+    } catch (...) {
+        m_running_systems = false;
+        m_pending_scene.reset();
+        throw;
     }
+    m_running_systems = false;
+    // `run` only returns once the systems still in flight are done with the old registry
+    if (auto pending = std::exchange(m_pending_scene, std::nullopt))
+        load_scene(*pending);
+    apply_commands();
+    // Sync point of the component observers: systems and commands of the frame are done
+    registry.dispatch_observers();
+    if (m_compaction_requested.exchange(false))
+        compact_registry();
     m_current_tick++;
     registry.set_current_version(m_current_tick);
 }
@@ -77,6 +92,14 @@ void EngineContext::add_scene_loader(const std::string &scene_name, std::functio
 }
 
 void EngineContext::set_scene(const std::string &scene_name) {
+    if (m_running_systems) {
+        m_pending_scene = scene_name;
+        return;
+    }
+    load_scene(scene_name);
+}
+
+void EngineContext::load_scene(const std::string &scene_name) {
     if (scene_name == m_current_scene) {
         LOG_INFO("Reloading scene {}", scene_name);
     } else if (m_scenes_loaders[scene_name] == nullptr) {
@@ -92,10 +115,21 @@ void EngineContext::set_scene(const std::string &scene_name) {
         network_client.reset();
     }
 
+    if (!m_current_scene.empty()) {
+        auto &footprint = m_scene_footprints[m_current_scene];
+        footprint.arena_bytes = std::max(footprint.arena_bytes, scene_arena.used());
+        footprint.hints.merge(registry.capacity_hints());
+    }
+
     LOG_DEBUG("Clearing registry...");
+    m_scheduler.clear();
+    m_commands.clear();
     registry.~Registry();
-    new (&registry) ecs::Registry();
-    m_systems.clear();
+    // The whole storage of the previous scene goes at once, sized for what this one used last time
+    auto const &footprint = m_scene_footprints[scene_name];
+    scene_arena.reset(footprint.arena_bytes);
+    new (&registry) ecs::Registry(&scene_arena);
+    registry.reserve(footprint.hints);
     LOG_DEBUG("Spawning initial entity {}",
               static_cast<std::size_t>(registry.spawn_entity())); // ensure entity 0 is reserved
     LOG_DEBUG("Loading scene {}...", scene_name);
@@ -116,6 +150,30 @@ std::size_t EngineContext::get_current_tick() const {
     return m_current_tick;
 }
 
+ecs::ThreadPool& EngineContext::thread_pool() noexcept {
+    return m_scheduler.pool();
+}
+
+ecs::CommandBuffer& EngineContext::commands() {
+    return m_commands.local();
+}
+
+void EngineContext::apply_commands() {
+    m_commands.apply(registry);
+}
+
+void EngineContext::request_registry_compaction() noexcept {
+    m_compaction_requested = true;
+}
+
+void EngineContext::compact_registry() {
+    auto report = registry.compact();
+
+    focused_entity = report.remap.apply(focused_entity);
+    LOG_INFO("Registry compacted: {} entities, {} renumbered, {} -> {} bytes", report.entities,
+             report.remap.moves().size(), report.bytes_before, report.bytes_after);
+}
+
 SnapshotRecord& EngineContext::get_latest_snapshot(asio::ip::udp::endpoint endpoint) {
     std::lock_guard<std::mutex> lock(snapshots_history_mutex);
     static SnapshotRecord s_empty_record; // Need to be static to return reference
@@ -2,14 +2,18 @@
 
 #include "assets_manager.h"
 #include "controls.h"
+#include "ecs/arena.h"
+#include "ecs/command_buffer.h"
 #include "ecs/registry.h"
 #include "events/event_queue.h"
 #include "events/events.h"
 #include "events/ui_events.h"
 #include "lua_context.h"
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 #include <mutex>
@@ -28,6 +32,7 @@
 #include "lua_context.h"
 #include "snapshots.h"
 #include "network_client.h"
+#include "system_access.h"
 
 #define SNAPSHOT_HISTORY_SIZE 96 // 3 secs at 32 tps
 
@@ -46,6 +51,8 @@ class EngineContext {
     float delta_time = 0.0f;
     bool should_quit = false;
 
+    // Backs the storage of the registry, declared first so that it outlives it
+    ecs::Arena scene_arena;
     ecs::Registry registry;
     ecs::Entity focused_entity;
 
@@ -138,31 +145,75 @@ class EngineContext {
     // NOLINTEND(cppcoreguidelines-non-private-member-variables-in-classes)
 
     void add_scene_loader(const std::string &scene_name, std::function<void(EngineContext&)> loader);
+    /// Tear down the registry and load a scene. Called from a system, the switch is deferred
+    /// until every system of the tick is done, so that none still uses the old registry.
+    /// @param scene_name Name the loader was registered under.
     void set_scene(const std::string &scene_name);
     const std::string &get_current_scene() const;
 
     std::size_t get_current_tick() const;
 
+    /// Thread pool shared by the system scheduler and the `par_each` loops of the systems.
+    ecs::ThreadPool& thread_pool() noexcept;
+
+    /// Command buffer of the calling thread. Structural changes recorded there are applied
+    /// at the next sync point: around each exclusive system and at the end of the tick.
+    ecs::CommandBuffer& commands();
+
     // System registration / execution
-    /// Register a system that accepts const views to the requested
-    /// component storages. The callable should accept `(Registry&, const
-    /// SparseArray<...>&...)` for the listed component types.
-    /// @tparam TComponents Component types the system requires.
+    /// Register a system with the component accesses it declares.
+    /// Each entry of `TAccesses` is `Read<T>` (or a bare `T`), received as
+    /// `SparseArray<T> const&`, or `Write<T>`, received as `SparseArray<T>&`.
+    /// The callable should accept `(EngineContext&, <pools>...)`.
+    /// Systems are exclusive by default; a system that only touches its declared
+    /// pools can be registered as `Parallel` (or `MainThread` if it calls raylib).
+    /// @tparam TAccesses Access declarations of the system.
     /// @tparam TFunction Callable type.
     /// @param f The function object to register.
-    template <class... TComponents, typename TFunction> void add_system(TFunction&& f);
+    /// @param policy How the scheduler may run the system.
+    template <class... TAccesses, typename TFunction>
+    void add_system(TFunction&& f, ecs::SystemPolicy policy = ecs::SystemPolicy::Exclusive);
 
     /// Register a const-qualified callable system.
-    template <class... TComponents, typename TFunction> void add_system(TFunction const& f);
+    template <class... TAccesses, typename TFunction>
+    void add_system(TFunction const& f, ecs::SystemPolicy policy = ecs::SystemPolicy::Exclusive);
 
-    /// Execute all registered systems in order they have been added.
+    /// Execute all registered systems, with the same outcome as running them in the
+    /// order they have been added. Systems that do not conflict run concurrently.
     void run_systems();
 
+    /// Compact the registry at the end of the current tick, once the systems and commands
+    /// are done, e.g. after a burst of bullets and explosions. Safe to call from a system.
+    /// See `ecs::Registry::compact`.
+    void request_registry_compaction() noexcept;
+
   private:
+    // Peak storage of the previous loads of a scene, reserved up front when it is loaded again
+    struct SceneFootprint {
+        std::size_t arena_bytes = 0;
+        ecs::CapacityHints hints;
+    };
+
     std::string m_current_scene;
+    // Scene requested by a system, loaded once the scheduler has joined every running system
+    std::optional<std::string> m_pending_scene;
+    bool m_running_systems = false;
     std::unordered_map<std::string, std::function<void(EngineContext&)>> m_scenes_loaders;
+    std::unordered_map<std::string, SceneFootprint> m_scene_footprints;
+
+    ecs::Scheduler m_scheduler;
+    ecs::ThreadCommandBuffers m_commands;
+
+    /// Replace the registry with a fresh one and run the loader of `scene_name`.
+    void load_scene(const std::string &scene_name);
+
+    /// Apply the commands recorded by every thread.
+    void apply_commands();
+
+    std::atomic<bool> m_compaction_requested{false};
 
-    std::vector<std::function<void(EngineContext&)>> m_systems;
+    /// Renumber the entities of the registry and log the memory it gave back.
+    void compact_registry();
 
     std::size_t m_current_tick = 1; // 0 is reserved for error values
 
@@ -5,25 +5,40 @@
 namespace engn {
 
 /// Register a system that will be executed later via `run_systems`.
-/// The callable is wrapped to fetch const references to the requested
-/// component storages and forward them to the provided function.
-template <class... TComponents, typename TFunction> void EngineContext::add_system(TFunction&& f) {
-    (void)std::initializer_list<int>{(registry.register_component<TComponents>(), 0)...};
-
-    auto wrapper = [fn = std::forward<TFunction>(f)](EngineContext& reg) mutable {
-        fn(reg, std::as_const(reg.registry.get_components<TComponents>())...);
+/// The callable is wrapped to fetch the declared component storages once per
+/// tick (const unless `Write<T>` was declared) and forward them to the provided function.
+/// Exclusive systems are sync points: pending commands are applied before and after them.
+template <class... TAccesses, typename TFunction>
+void EngineContext::add_system(TFunction&& f, ecs::SystemPolicy policy) {
+    (void)std::initializer_list<int>{
+        (registry.register_component<typename AccessTraits<TAccesses>::ComponentType>(), 0)...};
+
+    auto wrapper = [this, policy, fn = std::forward<TFunction>(f)]() mutable {
+        if (policy == ecs::SystemPolicy::Exclusive)
+            apply_commands();
+        fn(*this, access_pool<TAccesses>(registry)...);
+        if (policy == ecs::SystemPolicy::Exclusive)
+            apply_commands();
     };
 
-    m_systems.emplace_back(std::move(wrapper));
+    m_scheduler.add(std::move(wrapper), make_system_access<TAccesses...>(policy));
 }
 
 /// Same as the rvalue overload but accepts a const-qualified callable.
-template <class... TComponents, typename TFunction> void EngineContext::add_system(TFunction const& f) {
-    (void)std::initializer_list<int>{(registry.register_component<TComponents>(), 0)...};
-
-    auto wrapper = [&f](EngineContext& reg) { f(reg, std::as_const(reg.registry.get_components<TComponents>())...); };
+template <class... TAccesses, typename TFunction>
+void EngineContext::add_system(TFunction const& f, ecs::SystemPolicy policy) {
+    (void)std::initializer_list<int>{
+        (registry.register_component<typename AccessTraits<TAccesses>::ComponentType>(), 0)...};
+
+    auto wrapper = [this, policy, &f]() {
+        if (policy == ecs::SystemPolicy::Exclusive)
+            apply_commands();
+        f(*this, access_pool<TAccesses>(registry)...);
+        if (policy == ecs::SystemPolicy::Exclusive)
+            apply_commands();
+    };
 
-    m_systems.emplace_back(wrapper);
+    m_scheduler.add(wrapper, make_system_access<TAccesses...>(policy));
 }
 
 } // namespace engn
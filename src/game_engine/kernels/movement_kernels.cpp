@@ -0,0 +1,256 @@
+#include "kernels/movement_kernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ENGN_SIMD_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define ENGN_TARGET_AVX2
+    #else
+        #define ENGN_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+using namespace engn::simd;
+
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace {
+
+constexpr float k_two_pi = 2.0f * std::numbers::pi_v<float>;
+
+// Taylor coefficients of sin(x), accurate to the float epsilon on [-pi/2, pi/2]
+constexpr float k_sin_c3 = -1.0f / 6.0f;
+constexpr float k_sin_c5 = 1.0f / 120.0f;
+constexpr float k_sin_c7 = -1.0f / 5040.0f;
+constexpr float k_sin_c9 = 1.0f / 362880.0f;
+constexpr float k_sin_c11 = -1.0f / 39916800.0f;
+
+// Every float from 2^23 on is an integer: a whole number of turns
+constexpr float k_integral_turns = 8388608.0f;
+// Every float from 2^24 on is an even integer: a whole number of square wave periods
+constexpr float k_integral_periods = 16777216.0f;
+
+constexpr float k_square_period = 2.0f;
+
+// Sine of a phase given in turns: the reduction to [-0.5, 0.5] turn is exact, the quarter
+// turns on each side are folded back onto [-0.25, 0.25] where the polynomial is accurate.
+float sin_turns(float turns) noexcept {
+    float r = turns - std::rint(turns);
+
+    if (r > 0.25f)
+        r = 0.5f - r;
+    else if (r < -0.25f)
+        r = -0.5f - r;
+
+    const float k_x = r * k_two_pi;
+    const float k_x2 = k_x * k_x;
+    return k_x * (1.0f + k_x2 * (k_sin_c3 + k_x2 * (k_sin_c5 + k_x2 * (k_sin_c7 + k_x2 * (k_sin_c9 + k_x2 * k_sin_c11)))));
+}
+
+void integrate_scalar(float* pos, float const* vel, float dt, std::size_t count) noexcept {
+    for (std::size_t i = 0; i < count; i++)
+        pos[i] += vel[i] * dt;
+}
+
+void sine_wave_scalar(float* out, float const* turns, float const* amplitude, std::size_t count) noexcept {
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = sin_turns(turns[i]) * amplitude[i];
+}
+
+void square_wave_scalar(float* out, float const* phase, float const* amplitude, std::size_t count) noexcept {
+    for (std::size_t i = 0; i < count; i++)
+        out[i] = (std::fmod(phase[i], k_square_period) < 1.0f) ? amplitude[i] : -amplitude[i];
+}
+
+#ifdef ENGN_SIMD_X86
+
+__m128 sin_turns_sse2(__m128 turns) noexcept {
+    const __m128 k_sign = _mm_set1_ps(-0.0f);
+    const __m128 k_abs = _mm_andnot_ps(k_sign, turns);
+
+    // cvtps rounds to nearest even like std::rint, but overflows past 2^31: those are whole turns
+    __m128 r = _mm_sub_ps(turns, _mm_cvtepi32_ps(_mm_cvtps_epi32(turns)));
+    r = _mm_and_ps(r, _mm_cmplt_ps(k_abs, _mm_set1_ps(k_integral_turns)));
+
+    // |r| > 0.25: r = copysign(0.5, r) - r
+    const __m128 k_half = _mm_or_ps(_mm_and_ps(r, k_sign), _mm_set1_ps(0.5f));
+    const __m128 k_fold = _mm_cmpgt_ps(_mm_andnot_ps(k_sign, r), _mm_set1_ps(0.25f));
+    r = _mm_or_ps(_mm_and_ps(k_fold, _mm_sub_ps(k_half, r)), _mm_andnot_ps(k_fold, r));
+
+    const __m128 k_x = _mm_mul_ps(r, _mm_set1_ps(k_two_pi));
+    const __m128 k_x2 = _mm_mul_ps(k_x, k_x);
+    __m128 poly = _mm_add_ps(_mm_set1_ps(k_sin_c9), _mm_mul_ps(k_x2, _mm_set1_ps(k_sin_c11)));
+    poly = _mm_add_ps(_mm_set1_ps(k_sin_c7), _mm_mul_ps(k_x2, poly));
+    poly = _mm_add_ps(_mm_set1_ps(k_sin_c5), _mm_mul_ps(k_x2, poly));
+    poly = _mm_add_ps(_mm_set1_ps(k_sin_c3), _mm_mul_ps(k_x2, poly));
+    poly = _mm_add_ps(_mm_set1_ps(1.0f), _mm_mul_ps(k_x2, poly));
+    return _mm_mul_ps(k_x, poly);
+}
+
+void integrate_sse2(float* pos, float const* vel, float dt, std::size_t count) noexcept {
+    const __m128 k_dt = _mm_set1_ps(dt);
+    std::size_t i = 0;
+
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(pos + i, _mm_add_ps(_mm_loadu_ps(pos + i), _mm_mul_ps(_mm_loadu_ps(vel + i), k_dt)));
+    integrate_scalar(pos + i, vel + i, dt, count - i);
+}
+
+void sine_wave_sse2(float* out, float const* turns, float const* amplitude, std::size_t count) noexcept {
+    std::size_t i = 0;
+
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(out + i, _mm_mul_ps(sin_turns_sse2(_mm_loadu_ps(turns + i)), _mm_loadu_ps(amplitude + i)));
+    sine_wave_scalar(out + i, turns + i, amplitude + i, count - i);
+}
+
+void square_wave_sse2(float* out, float const* phase, float const* amplitude, std::size_t count) noexcept {
+    const __m128 k_sign = _mm_set1_ps(-0.0f);
+    std::size_t i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        const __m128 k_phase = _mm_loadu_ps(phase + i);
+        const __m128 k_periods = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_mul_ps(k_phase, _mm_set1_ps(0.5f))));
+
+        // Same result as std::fmod: truncated quotient, exact subtraction, sign of the phase
+        __m128 rem = _mm_sub_ps(k_phase, _mm_mul_ps(k_periods, _mm_set1_ps(k_square_period)));
+        rem = _mm_and_ps(rem, _mm_cmplt_ps(_mm_andnot_ps(k_sign, k_phase), _mm_set1_ps(k_integral_periods)));
+
+        const __m128 k_negate = _mm_andnot_ps(_mm_cmplt_ps(rem, _mm_set1_ps(1.0f)), k_sign);
+        _mm_storeu_ps(out + i, _mm_xor_ps(_mm_loadu_ps(amplitude + i), k_negate));
+    }
+    square_wave_scalar(out + i, phase + i, amplitude + i, count - i);
+}
+
+ENGN_TARGET_AVX2 __m256 sin_turns_avx2(__m256 turns) noexcept {
+    const __m256 k_sign = _mm256_set1_ps(-0.0f);
+
+    // Exact for every magnitude: past 2^23 the turns are whole and r is 0
+    __m256 r = _mm256_sub_ps(turns, _mm256_round_ps(turns, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+
+    const __m256 k_half = _mm256_or_ps(_mm256_and_ps(r, k_sign), _mm256_set1_ps(0.5f));
+    const __m256 k_fold = _mm256_cmp_ps(_mm256_andnot_ps(k_sign, r), _mm256_set1_ps(0.25f), _CMP_GT_OQ);
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(k_half, r), k_fold);
+
+    const __m256 k_x = _mm256_mul_ps(r, _mm256_set1_ps(k_two_pi));
+    const __m256 k_x2 = _mm256_mul_ps(k_x, k_x);
+    __m256 poly = _mm256_add_ps(_mm256_set1_ps(k_sin_c9), _mm256_mul_ps(k_x2, _mm256_set1_ps(k_sin_c11)));
+    poly = _mm256_add_ps(_mm256_set1_ps(k_sin_c7), _mm256_mul_ps(k_x2, poly));
+    poly = _mm256_add_ps(_mm256_set1_ps(k_sin_c5), _mm256_mul_ps(k_x2, poly));
+    poly = _mm256_add_ps(_mm256_set1_ps(k_sin_c3), _mm256_mul_ps(k_x2, poly));
+    poly = _mm256_add_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(k_x2, poly));
+    return _mm256_mul_ps(k_x, poly);
+}
+
+ENGN_TARGET_AVX2 void integrate_avx2(float* pos, float const* vel, float dt, std::size_t count) noexcept {
+    const __m256 k_dt = _mm256_set1_ps(dt);
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(pos + i, _mm256_add_ps(_mm256_loadu_ps(pos + i), _mm256_mul_ps(_mm256_loadu_ps(vel + i), k_dt)));
+    integrate_scalar(pos + i, vel + i, dt, count - i);
+}
+
+ENGN_TARGET_AVX2 void sine_wave_avx2(float* out, float const* turns, float const* amplitude, std::size_t count) noexcept {
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(sin_turns_avx2(_mm256_loadu_ps(turns + i)), _mm256_loadu_ps(amplitude + i)));
+    sine_wave_scalar(out + i, turns + i, amplitude + i, count - i);
+}
+
+ENGN_TARGET_AVX2 void square_wave_avx2(float* out, float const* phase, float const* amplitude, std::size_t count) noexcept {
+    const __m256 k_sign = _mm256_set1_ps(-0.0f);
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8) {
+        const __m256 k_phase = _mm256_loadu_ps(phase + i);
+        const __m256 k_periods = _mm256_round_ps(_mm256_mul_ps(k_phase, _mm256_set1_ps(0.5f)),
+                                                 _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        const __m256 k_rem = _mm256_sub_ps(k_phase, _mm256_mul_ps(k_periods, _mm256_set1_ps(k_square_period)));
+
+        const __m256 k_negate = _mm256_andnot_ps(_mm256_cmp_ps(k_rem, _mm256_set1_ps(1.0f), _CMP_LT_OQ), k_sign);
+        _mm256_storeu_ps(out + i, _mm256_xor_ps(_mm256_loadu_ps(amplitude + i), k_negate));
+    }
+    square_wave_scalar(out + i, phase + i, amplitude + i, count - i);
+}
+
+#endif // ENGN_SIMD_X86
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+constexpr MovementKernels k_kernels[] = {
+    {Isa::scalar, integrate_scalar, sine_wave_scalar, square_wave_scalar},
+#ifdef ENGN_SIMD_X86
+    {Isa::sse2, integrate_sse2, sine_wave_sse2, square_wave_sse2},
+    {Isa::avx2, integrate_avx2, sine_wave_avx2, square_wave_avx2},
+#endif
+};
+
+bool cpu_has_avx2() noexcept {
+#if !defined(ENGN_SIMD_X86)
+    return false;
+#elif defined(_MSC_VER) && !defined(__clang__)
+    std::array<int, 4> info{};
+    __cpuid(info.data(), 0);
+    if (info[0] < 7)
+        return false;
+    __cpuid(info.data(), 1);
+    const bool k_os_saves_ymm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+    __cpuidex(info.data(), 7, 0);
+    return k_os_saves_ymm && (info[1] & (1 << 5)) != 0;
+#else
+    // Also checks that the OS saves the AVX registers
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+} // namespace
+
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+Isa engn::simd::detected_isa() noexcept {
+    static const Isa k_isa = [] {
+#ifdef ENGN_SIMD_X86
+        return cpu_has_avx2() ? Isa::avx2 : Isa::sse2;
+#else
+        return Isa::scalar;
+#endif
+    }();
+    return k_isa;
+}
+
+std::string_view engn::simd::isa_name(Isa isa) noexcept {
+    switch (isa) {
+        case Isa::scalar: return "scalar";
+        case Isa::sse2: return "sse2";
+        case Isa::avx2: return "avx2";
+    }
+    return "unknown";
+}
+
+MovementKernels const& engn::simd::movement_kernels() noexcept {
+    return movement_kernels(detected_isa());
+}
+
+MovementKernels const& engn::simd::movement_kernels(Isa isa) noexcept {
+    const auto k_index = static_cast<std::size_t>(std::min(isa, detected_isa()));
+    return k_kernels[k_index]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+}
+
+void PatternBatch::flush(MovementKernels const& kernels) noexcept {
+    kernels.sine_wave(m_sine.vy.data(), m_sine.phase.data(), m_sine.amplitude.data(), m_sine.size);
+    kernels.square_wave(m_zigzag.vy.data(), m_zigzag.phase.data(), m_zigzag.amplitude.data(), m_zigzag.size);
+
+    for (Bin* bin : {&m_sine, &m_zigzag}) {
+        for (std::size_t i = 0; i < bin->size; i++)
+            bin->velocities[i]->vy = bin->vy[i];
+        bin->size = 0;
+    }
+    m_size = 0;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "components/movement_pattern.h"
+#include "components/velocity.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace engn::simd {
+
+/// Instruction sets the movement kernels are built for, from the slowest to the fastest.
+enum class Isa : std::uint8_t { scalar, sse2, avx2 };
+
+/// Largest absolute difference between sine_wave (for a unit amplitude) and the exact sine,
+/// whatever the instruction set. integrate and square_wave give the same bits on every one.
+inline constexpr float k_sine_tolerance = 2e-6f;
+
+/// Batched kernels working on structure-of-arrays buffers of `count` floats.
+struct MovementKernels {
+    /// Instruction set the kernels were built for.
+    Isa isa;
+
+    /// `pos[i] += vel[i] * dt`
+    /// @param pos Positions, updated in place.
+    /// @param vel Velocities.
+    /// @param dt Time step.
+    /// @param count Number of entries in each buffer.
+    void (*integrate)(float* pos, float const* vel, float dt, std::size_t count) noexcept;
+
+    /// `out[i] = sin(2 * pi * turns[i]) * amplitude[i]`
+    /// @param out Results.
+    /// @param turns Angles, in turns.
+    /// @param amplitude Amplitude of each wave.
+    /// @param count Number of entries in each buffer.
+    void (*sine_wave)(float* out, float const* turns, float const* amplitude, std::size_t count) noexcept;
+
+    /// `out[i] = (fmod(phase[i], 2) < 1) ? amplitude[i] : -amplitude[i]`
+    /// @param out Results.
+    /// @param phase Phases, a period being 2.
+    /// @param amplitude Amplitude of each wave.
+    /// @param count Number of entries in each buffer.
+    void (*square_wave)(float* out, float const* phase, float const* amplitude, std::size_t count) noexcept;
+};
+
+/// Fastest instruction set supported by the running CPU, checked once.
+/// @return The detected instruction set.
+Isa detected_isa() noexcept;
+
+/// Name of an instruction set, for logs and benchmarks.
+/// @param isa The instruction set.
+/// @return Its lowercase name.
+std::string_view isa_name(Isa isa) noexcept;
+
+/// Kernels for the running CPU.
+/// @return Kernels built for `detected_isa()`.
+MovementKernels const& movement_kernels() noexcept;
+
+/// Kernels for a given instruction set, or the fastest supported one below it.
+/// @param isa Requested instruction set.
+/// @return Kernels for `isa`, or for the fastest supported instruction set below it.
+MovementKernels const& movement_kernels(Isa isa) noexcept;
+
+/// Number of entities gathered by a batch before its kernels run.
+inline constexpr std::size_t k_batch_size = 256;
+
+/// Vertical velocity of a block of enemies following a MovementPattern.
+/// Entities are binned by pattern type into SoA copies of their pattern, so that each
+/// type is evaluated by one kernel call. The pattern timer must be advanced beforehand.
+class PatternBatch {
+  public:
+    /// Queue an entity, the batch must not be full. Inline: called once per enemy.
+    /// @param pattern Movement pattern of the entity.
+    /// @param velocity Velocity receiving the vy on `flush`; must outlive the batch.
+    void add(cpnt::MovementPattern const& pattern, cpnt::Velocity& velocity) noexcept {
+        Bin* bin = nullptr;
+        float amplitude = pattern.amplitude;
+
+        switch (pattern.type) {
+            case cpnt::MovementPattern::PatternType::Sine: bin = &m_sine; break;
+            case cpnt::MovementPattern::PatternType::Dive:
+                bin = &m_sine;
+                amplitude *= k_dive_amplitude_multiplier;
+                break;
+            case cpnt::MovementPattern::PatternType::ZigZag: bin = &m_zigzag; break;
+            case cpnt::MovementPattern::PatternType::Straight: break;
+        }
+        m_size++;
+        if (bin == nullptr)
+            return;
+
+        bin->phase[bin->size] = pattern.timer * pattern.frequency;
+        bin->amplitude[bin->size] = amplitude;
+        bin->velocities[bin->size] = &velocity;
+        bin->size++;
+    }
+
+    /// @return `true` once `k_batch_size` entities are queued.
+    bool full() const noexcept { return m_size == k_batch_size; }
+
+    /// Write the vy of every queued entity and empty the batch.
+    /// @param kernels Kernels evaluating the patterns.
+    void flush(MovementKernels const& kernels) noexcept;
+
+  private:
+    static constexpr float k_dive_amplitude_multiplier = 2.0f;
+
+    struct Bin {
+        std::array<float, k_batch_size> phase;
+        std::array<float, k_batch_size> amplitude;
+        std::array<float, k_batch_size> vy;
+        std::array<cpnt::Velocity*, k_batch_size> velocities;
+        std::size_t size{0};
+    };
+
+    Bin m_sine;   // Sine and Dive
+    Bin m_zigzag;
+    std::size_t m_size{0};
+};
+
+} // namespace engn::simd
@@ -42,18 +42,16 @@ void NetworkClient::connect(const std::string& host, std::uint16_t port, const s
         m_session->start(
             // onReliable
             [this, session = m_session](const net::Packet& pkt, const asio::ip::udp::endpoint&) {
-                // Parse login response
-                if (auto res = net::handshake::parse_res_login(pkt)) {
+                // Parse login response, applying the negotiated settings to the session
+                if (auto res = net::handshake::handle_client_handshake(pkt, session, m_server_endpoint)) {
                     m_player_id = res->m_player_id;
                     m_connected = res->m_success;
 
                     if (res->m_success) {
                         std::cout << "Login successful! Player ID: " << res->m_player_id << std::endl;
-
-                        // Set fragment size
-                        if (res->m_effective_fragment_size > 0) {
-                            session->set_fragment_payload_size(res->m_effective_fragment_size);
-                        }
+                    } else if (res->m_version != net::handshake::k_protocol_version) {
+                        std::cerr << "Login failed: server speaks protocol v" << res->m_version << ", expected v"
+                                  << net::handshake::k_protocol_version << std::endl;
                     } else {
                         std::cerr << "Login failed" << std::endl;
                     }
@@ -97,7 +95,8 @@ void NetworkClient::connect(const std::string& host, std::uint16_t port, const s
         net::handshake::ReqLogin req{
             .m_username = username,
             .m_version = net::handshake::k_protocol_version,
-            .m_preferred_fragment_size = 0 // Use default
+            .m_preferred_fragment_size = 0, // Use default
+            .m_checksums = net::checksum::supported_algorithms()
         };
         m_session->send(net::handshake::make_req_login(req), true);
 
@@ -68,6 +68,7 @@ std::uint32_t SerializedComponent::get_serialized_size() const
  * for i in 1..entry_count:
  *     [ op : uint8 ]
  *     [ entity_id : uint32 ]
+ *     [ entity_generation : uint32 ]
  *     if op == EntityAdd:
  *         // no data
  *     if op == EntityRemove:
@@ -106,6 +107,10 @@ std::uint32_t SerializedComponent::get_serialized_size() const
         std::memcpy(ptr, &entry.entity_id, sizeof(std::uint32_t));
         ptr += sizeof(std::uint32_t);
 
+        // entity_generation
+        std::memcpy(ptr, &entry.entity_generation, sizeof(std::uint32_t));
+        ptr += sizeof(std::uint32_t);
+
         switch (entry.operation) {
             case DeltaOperation::entity_add: break;
             case DeltaOperation::entity_remove: break;
@@ -159,6 +164,10 @@ WorldDelta engn::WorldDelta::deserialize(const std::byte *data_ptr) {
         std::memcpy(&entry.entity_id, ptr, sizeof(std::uint32_t));
         ptr += sizeof(std::uint32_t);
 
+        // entity_generation
+        std::memcpy(&entry.entity_generation, ptr, sizeof(std::uint32_t));
+        ptr += sizeof(std::uint32_t);
+
         switch (entry.operation) {
             case DeltaOperation::entity_add: break;
             case DeltaOperation::entity_remove: break;
@@ -190,6 +199,7 @@ std::uint32_t engn::WorldDelta::get_serialized_size() const {
     for (const auto &entry : entries) {
         total_size += sizeof(std::uint8_t); // operation
         total_size += sizeof(std::uint32_t); // entity_id
+        total_size += sizeof(std::uint32_t); // entity_generation
 
         switch (entry.operation) {
             case DeltaOperation::entity_add: break;
@@ -201,7 +211,7 @@ std::uint32_t engn::WorldDelta::get_serialized_size() const {
             }
 
             case DeltaOperation::component_remove: {
-                total_size += entry.component->get_serialized_size();
+                total_size += sizeof(ComponentType);
                 break;
             }
         }
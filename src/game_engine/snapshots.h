@@ -70,6 +70,7 @@ enum class DeltaOperation : std::uint8_t {
 struct DeltaEntry {
     DeltaOperation operation;
     std::uint32_t entity_id;
+    std::uint32_t entity_generation = 0; // Lets clients drop entries about a previous user of entity_id
 
     ComponentType component_type; // Only used for component remove
     std::optional<SerializedComponent> component; // Only used for component add or update
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "ecs/component_pool.h"
+#include "ecs/registry.h"
+#include "ecs/scheduler.h"
+#include "ecs/sparse_array.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace engn {
+
+/// Declares that a system only reads the pool of `TComponent`: it receives `SparseArray<TComponent> const&`.
+/// Listing a bare component type in `add_system` is equivalent to `Read<TComponent>`.
+template <typename TComponent> struct Read {};
+
+/// Declares that a system mutates the pool of `TComponent`: it receives `SparseArray<TComponent>&`.
+template <typename TComponent> struct Write {};
+
+/// Resolve an access declaration to its component type and access mode.
+template <typename TAccess> struct AccessTraits {
+    using ComponentType = TAccess;
+    static constexpr bool k_write = false;
+};
+
+template <typename TComponent> struct AccessTraits<Read<TComponent>> {
+    using ComponentType = TComponent;
+    static constexpr bool k_write = false;
+};
+
+template <typename TComponent> struct AccessTraits<Write<TComponent>> {
+    using ComponentType = TComponent;
+    static constexpr bool k_write = true;
+};
+
+/// Pool reference a system receives for an access declaration.
+template <typename TAccess>
+using AccessParam = std::conditional_t<AccessTraits<TAccess>::k_write,
+                                       ecs::SparseArray<typename AccessTraits<TAccess>::ComponentType>&,
+                                       ecs::SparseArray<typename AccessTraits<TAccess>::ComponentType> const&>;
+
+/// Fetch the pool matching an access declaration.
+/// @tparam TAccess `Read<T>`, `Write<T>` or a bare component type.
+/// @param registry Registry holding the pool.
+/// @return The pool, const unless write access was declared.
+template <typename TAccess> AccessParam<TAccess> access_pool(ecs::Registry& registry) {
+    using ComponentType = typename AccessTraits<TAccess>::ComponentType;
+
+    if constexpr (AccessTraits<TAccess>::k_write)
+        return registry.get_components<ComponentType>();
+    else
+        return std::as_const(registry).get_components<ComponentType>();
+}
+
+namespace detail {
+
+template <typename TAccess> void add_access(ecs::SystemAccess& access) {
+    auto id = ecs::component_id<typename AccessTraits<TAccess>::ComponentType>();
+    if constexpr (AccessTraits<TAccess>::k_write)
+        access.writes.push_back(id);
+    else
+        access.reads.push_back(id);
+}
+
+} // namespace detail
+
+/// Build the scheduling description of a system from its access declarations.
+/// @tparam TAccesses `Read<T>`, `Write<T>` or bare component types.
+/// @param policy How the system may be scheduled.
+/// @return The component ids read and written by the system.
+template <typename... TAccesses> ecs::SystemAccess make_system_access(ecs::SystemPolicy policy) {
+    ecs::SystemAccess access;
+    access.policy = policy;
+    (detail::add_access<TAccesses>(access), ...);
+    return access;
+}
+
+} // namespace engn
@@ -29,15 +29,38 @@ namespace {
     constexpr float k_bullet_height = 8.0f;
     constexpr float k_bullet_scale = 1.0f;
     constexpr float k_bullet_speed = 300.0f;
+
+    void spawn_large_explosion(ecs::CommandBuffer& commands, float x, float y) {
+        commands.spawn(cpnt::Transform{x, y, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f},
+                       cpnt::Sprite{{0.0f, k_large_explosion_y, k_large_explosion_w, k_large_explosion_h},
+                                    k_large_explosion_scale,
+                                    0,
+                                    "explosion"},
+                       cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+                       cpnt::Explosion{cpnt::Explosion::ExplosionType::Large, 0.0f, k_explosion_frame_duration, 0,
+                                       k_explosion_frames});
+    }
+
+    void spawn_small_explosion(ecs::CommandBuffer& commands, float x, float y) {
+        commands.spawn(cpnt::Transform{x, y, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f},
+                       cpnt::Sprite{{k_explosion_sprite_x, k_explosion_sprite_y, k_explosion_sprite_w,
+                                     k_explosion_sprite_h},
+                                    k_explosion_scale,
+                                    0,
+                                    "bulletExplosion"},
+                       cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+                       cpnt::Explosion{cpnt::Explosion::ExplosionType::Small, 0.0f, k_explosion_frame_duration, 0,
+                                       k_explosion_frames});
+    }
 } // namespace
 
 void sys::boss_system(EngineContext& ctx, ecs::SparseArray<cpnt::Boss> const& boss, ecs::SparseArray<cpnt::Transform> const& positions,
                     ecs::SparseArray<cpnt::Stats> const& stats, ecs::SparseArray<cpnt::BossHitbox> const& boss_hitboxes,
-                    ecs::SparseArray<cpnt::Enemy> const& enemies, ecs::SparseArray<cpnt::Shooter> const& shooters,
-                    ecs::SparseArray<cpnt::BulletShooter> const& bullets_shooter, ecs::SparseArray<cpnt::Bullet> const& bullets,
+                    ecs::SparseArray<cpnt::Enemy> const& /*enemies*/, ecs::SparseArray<cpnt::Shooter> const& /*shooters*/,
+                    ecs::SparseArray<cpnt::BulletShooter> const& /*bullets_shooter*/, ecs::SparseArray<cpnt::Bullet> const& /*bullets*/,
                     ecs::SparseArray<cpnt::Health> const& healths) {
-    std::vector<ecs::Entity> entity_to_kill;
     auto& reg = ctx.registry;
+    auto& commands = ctx.commands();
     // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access)
     const int k_width = static_cast<int>(ctx.window_size.x);
     const int k_height = static_cast<int>(ctx.window_size.y);
@@ -83,160 +106,56 @@ void sys::boss_system(EngineContext& ctx, ecs::SparseArray<cpnt::Boss> const& bo
                 });
             }
 
-            for (auto [boss_idx, boss_opt] : ecs::indexed_zipper(boss)) {
-                if (boss_opt) {
-                    auto& boss_comp = reg.get_components<cpnt::Boss>()[boss_idx];
-                    
-                    if (boss_comp->time_to_roar || boss_comp->roar_active) {
-                        boss_comp->time_to_roar = false;
-                        if (!boss_comp->roar_active) {
-                            boss_comp->roar_active = true;
-                            boss_comp->waveRadius = 0.0f;
-                        }
+            for (auto [boss_entity, boss_comp] : reg.view<cpnt::Boss>()) {
+                if (boss_comp.time_to_roar || boss_comp.roar_active) {
+                    boss_comp.time_to_roar = false;
+                    if (!boss_comp.roar_active) {
+                        boss_comp.roar_active = true;
+                        boss_comp.waveRadius = 0.0f;
+                    }
 
-                        // UPDATE wave radius
-                        if (boss_comp->roar_active) {
-                            boss_comp->waveRadius += boss_comp->waveSpeed * GetFrameTime();
+                    // UPDATE wave radius
+                    if (boss_comp.roar_active) {
+                        boss_comp.waveRadius += boss_comp.waveSpeed * GetFrameTime();
 
-                            if (boss_comp->waveRadius > k_max_dist) {
-                                boss_comp->roar_active = false;
-                            }
+                        if (boss_comp.waveRadius > k_max_dist) {
+                            boss_comp.roar_active = false;
                         }
+                    }
 
-                        // Destroy enemies and bullets in wave radius
-                        for (auto [pos_idx, pos_opt, charg_opt, shot_opt, bul_shot_opt, bul_opt] : ecs::indexed_zipper(positions, enemies, shooters, bullets_shooter, bullets)) {
-                            if (pos_opt && (charg_opt || shot_opt || bul_shot_opt || bul_opt)) {
-                                auto& pos = reg.get_components<cpnt::Transform>()[pos_idx];
-
-                                float dist_x = pos->x - boss_comp->waveCenter.x;
-                                float dist_y = pos->y - boss_comp->waveCenter.y;
-                                float distance = sqrtf(dist_x * dist_x + dist_y * dist_y);
+                    // Destroy enemies and bullets in wave radius
+                    auto in_wave = [&boss_comp](cpnt::Transform const& pos) {
+                        float dist_x = pos.x - boss_comp.waveCenter.x;
+                        float dist_y = pos.y - boss_comp.waveCenter.y;
+                        float distance = sqrtf(dist_x * dist_x + dist_y * dist_y);
 
-                                if (distance >= boss_comp->waveRadius - k_roar_thickness && 
-                                    distance <= boss_comp->waveRadius) {
-                                    entity_to_kill.push_back(reg.entity_from_index(pos_idx));
-                                    
-                                    // Spawn explosion if charger or shooter
-                                    if (charg_opt || shot_opt) {
-                                        auto explosion = reg.spawn_entity();
-                                        reg.add_component(explosion,
-                                                          cpnt::Transform{pos->x, pos->y, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
-                                        reg.add_component(explosion, cpnt::Sprite{{0.0f, k_large_explosion_y, k_large_explosion_w,
-                                                                                   k_large_explosion_h},
-                                                                                  k_large_explosion_scale,
-                                                                                  0,
-                                                                                  "explosion"});
-                                        reg.add_component(explosion, cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
-                                        reg.add_component(explosion,
-                                                          cpnt::Explosion{cpnt::Explosion::ExplosionType::Large, 0.0f,
-                                                                          k_explosion_frame_duration, 0, k_explosion_frames});
-                                    }
+                        return distance >= boss_comp.waveRadius - k_roar_thickness && distance <= boss_comp.waveRadius;
+                    };
+                    // Cleanup once the wave left the screen: kill any remaining enemies/bullets that survived
+                    const bool k_cleanup = boss_comp.waveRadius > k_max_dist;
 
-                                    if (bul_shot_opt || bul_opt) {
-                                        auto explosion = reg.spawn_entity();
-                                        reg.add_component(explosion, cpnt::Transform{pos_opt->x, pos_opt->y, 0.0f, 0.0f,
-                                                                                     0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
-                                        reg.add_component(explosion, cpnt::Sprite{{k_explosion_sprite_x, k_explosion_sprite_y,
-                                                                                   k_explosion_sprite_w, k_explosion_sprite_h},
-                                                                                  k_explosion_scale,
-                                                                                  0,
-                                                                                  "bulletExplosion"});
-                                        reg.add_component(explosion, cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
-                                        reg.add_component(explosion,
-                                                          cpnt::Explosion{cpnt::Explosion::ExplosionType::Small, 0.0f,
-                                                                          k_explosion_frame_duration, 0, k_explosion_frames});
-                                    }
-                                }
-                            }
+                    for (auto [e, pos, enemy] : reg.view<cpnt::Transform const, cpnt::Enemy const>()) {
+                        if (k_cleanup || in_wave(pos)) {
+                            commands.kill(e);
+                            spawn_large_explosion(commands, pos.x, pos.y);
                         }
-                        
-                        for (auto [pos_idx, pos_opt] : ecs::indexed_zipper(positions)) {
-                            if (boss_comp->waveRadius > k_max_dist) {
-                                boss_comp->roar_active = false;
-
-                                // Cleanup: kill any remaining enemies/bullets that survived
-                                auto& positions_cleanup = reg.get_components<cpnt::Transform>();
-                                auto& enemies_cleanup = reg.get_components<cpnt::Enemy>();
-                                auto& shooters_cleanup = reg.get_components<cpnt::Shooter>();
-                                auto& bullets_cleanup = reg.get_components<cpnt::Bullet>();
-                                auto& bullets_shooter_cleanup = reg.get_components<cpnt::BulletShooter>();
-
-                                // Kill all chargers
-                                for (auto [idx, pos_opt, enemy_opt] : ecs::indexed_zipper(positions_cleanup, enemies_cleanup)) {
-                                    if (pos_opt && enemy_opt) {
-                                        entity_to_kill.push_back(reg.entity_from_index(idx));
-                                        auto explosion = reg.spawn_entity();
-                                        reg.add_component(explosion,
-                                                          cpnt::Transform{pos_opt->x, pos_opt->y, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
-                                        reg.add_component(explosion, cpnt::Sprite{{0.0f, k_large_explosion_y, k_large_explosion_w,
-                                                                                   k_large_explosion_h},
-                                                                                  k_large_explosion_scale,
-                                                                                  0,
-                                                                                  "explosion"});
-                                        reg.add_component(explosion, cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
-                                        reg.add_component(explosion,
-                                                          cpnt::Explosion{cpnt::Explosion::ExplosionType::Large, 0.0f,
-                                                                          k_explosion_frame_duration, 0, k_explosion_frames});
-                                    }
-                                }
-
-                                // Kill all shooters
-                                for (auto [idx, pos_opt, shooter_opt] : ecs::indexed_zipper(positions_cleanup, shooters_cleanup)) {
-                                    if (pos_opt && shooter_opt) {
-                                        entity_to_kill.push_back(reg.entity_from_index(idx));
-                                        auto explosion = reg.spawn_entity();
-                                        reg.add_component(explosion,
-                                                          cpnt::Transform{pos_opt->x, pos_opt->y, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
-                                        reg.add_component(explosion, cpnt::Sprite{{0.0f, k_large_explosion_y, k_large_explosion_w,
-                                                                                   k_large_explosion_h},
-                                                                                  k_large_explosion_scale,
-                                                                                  0,
-                                                                                  "explosion"});
-                                        reg.add_component(explosion, cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
-                                        reg.add_component(explosion,
-                                                          cpnt::Explosion{cpnt::Explosion::ExplosionType::Large, 0.0f,
-                                                                          k_explosion_frame_duration, 0, k_explosion_frames});
-                                    }
-                                }
-
-                                // Kill all bullets
-                                for (auto [idx, pos_opt, bullet_opt] : ecs::indexed_zipper(positions_cleanup, bullets_cleanup)) {
-                                    if (pos_opt && bullet_opt) {
-                                        entity_to_kill.push_back(reg.entity_from_index(idx));
-                                        auto explosion = reg.spawn_entity();
-                                        reg.add_component(explosion, cpnt::Transform{pos_opt->x, pos_opt->y, 0.0f, 0.0f,
-                                                                                     0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
-                                        reg.add_component(explosion, cpnt::Sprite{{k_explosion_sprite_x, k_explosion_sprite_y,
-                                                                                   k_explosion_sprite_w, k_explosion_sprite_h},
-                                                                                  k_explosion_scale,
-                                                                                  0,
-                                                                                  "bulletExplosion"});
-                                        reg.add_component(explosion, cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
-                                        reg.add_component(explosion,
-                                                          cpnt::Explosion{cpnt::Explosion::ExplosionType::Small, 0.0f,
-                                                                          k_explosion_frame_duration, 0, k_explosion_frames});
-                                    }
-                                }
-
-                                // Kill all shooter bullets
-                                for (auto [idx, pos_opt, bul_shot_opt] : ecs::indexed_zipper(positions_cleanup, bullets_shooter_cleanup)) {
-                                    if (pos_opt && bul_shot_opt) {
-                                        entity_to_kill.push_back(reg.entity_from_index(idx));
-                                        auto explosion = reg.spawn_entity();
-                                        reg.add_component(explosion, cpnt::Transform{pos_opt->x, pos_opt->y, 0.0f, 0.0f,
-                                                                                     0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
-                                        reg.add_component(explosion, cpnt::Sprite{{k_explosion_sprite_x, k_explosion_sprite_y,
-                                                                                   k_explosion_sprite_w, k_explosion_sprite_h},
-                                                                                  k_explosion_scale,
-                                                                                  0,
-                                                                                  "bulletExplosion"});
-                                        reg.add_component(explosion, cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
-                                        reg.add_component(explosion,
-                                                          cpnt::Explosion{cpnt::Explosion::ExplosionType::Small, 0.0f,
-                                                                          k_explosion_frame_duration, 0, k_explosion_frames});
-                                    }
-                                }
-                            }
+                    }
+                    for (auto [e, pos, shooter] : reg.view<cpnt::Transform const, cpnt::Shooter const>()) {
+                        if (k_cleanup || in_wave(pos)) {
+                            commands.kill(e);
+                            spawn_large_explosion(commands, pos.x, pos.y);
+                        }
+                    }
+                    for (auto [e, pos, bullet] : reg.view<cpnt::Transform const, cpnt::Bullet const>()) {
+                        if (k_cleanup || in_wave(pos)) {
+                            commands.kill(e);
+                            spawn_small_explosion(commands, pos.x, pos.y);
+                        }
+                    }
+                    for (auto [e, pos, bullet_shooter] : reg.view<cpnt::Transform const, cpnt::BulletShooter const>()) {
+                        if (k_cleanup || in_wave(pos)) {
+                            commands.kill(e);
+                            spawn_small_explosion(commands, pos.x, pos.y);
                         }
                     }
                 }
@@ -249,15 +168,13 @@ void sys::boss_system(EngineContext& ctx, ecs::SparseArray<cpnt::Boss> const& bo
     for (auto [boss_idx, boss_tag_opt, health_opt] : ecs::indexed_zipper(boss, healths)) {
         if (boss_tag_opt && health_opt) {
             if (health_opt->hp <= 0) {
-                entity_to_kill.push_back(reg.entity_from_index(boss_idx));
+                commands.kill(reg.entity_from_index(boss_idx));
+                // End of the boss wave: its bullets left the pools sized for their peak
+                ctx.request_registry_compaction();
             }
         }
     }
 
-    for (auto e : entity_to_kill) {
-        reg.kill_entity(e);
-    }
-
     for (auto [boss_idx, boss_opt, pos_opt] : ecs::indexed_zipper(boss, positions)) {
         if (boss_opt && pos_opt && !boss_opt->roar_active) {
             auto& boss = reg.get_components<cpnt::Boss>()[boss_idx];
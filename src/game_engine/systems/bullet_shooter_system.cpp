@@ -5,17 +5,17 @@
 
 using namespace engn;
 
-void sys::BulletShooter_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
+void sys::BulletShooter_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform>& positions,
                         ecs::SparseArray<cpnt::Velocity> const& velocities,
                         ecs::SparseArray<cpnt::BulletShooter> const& bullets_shooter) {
-    std::vector<ecs::Entity> to_kill;
     auto& reg = ctx.registry;
+    auto& commands = ctx.commands();
     float dt = ctx.delta_time;
 
     for (auto [idx, pos_opt, vel_opt, bullet_opt] : ecs::indexed_zipper(positions, velocities, bullets_shooter)) {
         if (pos_opt && vel_opt && bullet_opt) {
             auto entity = reg.entity_from_index(idx);
-            auto& pos = reg.get_components<cpnt::Transform>()[idx];
+            auto& pos = pos_opt;
 
             if (pos && vel_opt) {
                 pos->x += vel_opt->vx * dt;
@@ -23,14 +23,10 @@ void sys::BulletShooter_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transf
 
                 // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access)
                 if (pos->x > ctx.window_size.x || pos->x < 0 || pos->y > ctx.window_size.y || pos->y < 0) {
-                    to_kill.push_back(entity);
+                    commands.kill(entity);
                 }
                 // NOLINTEND(cppcoreguidelines-pro-type-union-access)
             }
         }
     }
-
-    for (auto e : to_kill) {
-        reg.kill_entity(e);
-    }
 }
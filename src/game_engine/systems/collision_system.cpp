@@ -1,5 +1,4 @@
 #include "components/components.h"
-#include "ecs/zipper.h"
 #include "engine.h"
 #include "raylib.h"
 #include "systems/systems.h"
@@ -17,16 +16,27 @@ constexpr float k_explosion_frame_duration = 0.08f;
 constexpr int k_explosion_total_frames = 5;
 constexpr int k_collision_damage = 25;
 constexpr float k_bullet_damage = 10;
+
+void spawn_bullet_explosion(ecs::CommandBuffer& commands, float x, float y) {
+    commands.spawn(cpnt::Transform{x, y, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f},
+                   cpnt::Sprite{{k_explosion_sprite_x, k_explosion_sprite_y, k_explosion_sprite_w, k_explosion_sprite_h},
+                                k_explosion_scale,
+                                0,
+                                "bulletExplosion"},
+                   cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+                   cpnt::Explosion{cpnt::Explosion::ExplosionType::Small, 0.0f, k_explosion_frame_duration, 0,
+                                   k_explosion_total_frames});
+}
 } // namespace
 
-void sys::collision_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
-                           ecs::SparseArray<cpnt::Bullet> const& bullets, ecs::SparseArray<cpnt::Enemy> const& enemies,
-                           ecs::SparseArray<cpnt::Health> const& healths, ecs::SparseArray<cpnt::Player> const& players,
-                           ecs::SparseArray<cpnt::Hitbox> const& hitboxes, ecs::SparseArray<cpnt::BulletShooter> const& bullets_shooter,
-                           ecs::SparseArray<cpnt::Shooter> const& shooters, ecs::SparseArray<cpnt::Stats> const& stats,
-                           ecs::SparseArray<cpnt::BossHitbox> const& boss_hitboxes) {
-    std::vector<ecs::Entity> bullets_to_kill;
+void sys::collision_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& /*positions*/,
+                           ecs::SparseArray<cpnt::Bullet> const& /*bullets*/, ecs::SparseArray<cpnt::Enemy> const& /*enemies*/,
+                           ecs::SparseArray<cpnt::Health>& /*healths*/, ecs::SparseArray<cpnt::Player> const& /*players*/,
+                           ecs::SparseArray<cpnt::Hitbox> const& /*hitboxes*/, ecs::SparseArray<cpnt::BulletShooter> const& /*bullets_shooter*/,
+                           ecs::SparseArray<cpnt::Shooter> const& /*shooters*/, ecs::SparseArray<cpnt::Stats>& /*stats*/,
+                           ecs::SparseArray<cpnt::BossHitbox> const& /*boss_hitboxes*/) {
     auto& reg = ctx.registry;
+    auto& commands = ctx.commands();
 
     int points_gained = 0;
     int enemies_killed = 0;
@@ -59,255 +69,148 @@ void sys::collision_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform>
     //    }
     //}
 
-    // Get bullet entities
-    for (auto [bullet_idx, bullet_pos_opt, bullet_tag_opt] : ecs::indexed_zipper(positions, bullets)) {
-        if (bullet_pos_opt && bullet_tag_opt) {
-            // Check against all enemies
-            for (auto [enemy_idx, enemy_pos_opt, enemy_tag_opt, health_opt, hitbox_opt] :
-                 ecs::indexed_zipper(positions, enemies, healths, hitboxes)) {
-                if (enemy_pos_opt && enemy_tag_opt && health_opt && health_opt->hp > 0 && hitbox_opt) {
-                    Rectangle enemy_rect = {enemy_pos_opt->x + hitbox_opt->offset_x,
-                                            enemy_pos_opt->y + hitbox_opt->offset_y, hitbox_opt->width,
-                                            hitbox_opt->height};
-                    Vector2 bullet_pos = {bullet_pos_opt->x, bullet_pos_opt->y};
-
-                    if (CheckCollisionCircleRec(bullet_pos, k_bullet_radius, enemy_rect)) {
-                        bullets_to_kill.push_back(reg.entity_from_index(bullet_idx));
-
-                        auto explosion = reg.spawn_entity();
-                        reg.add_component(explosion, cpnt::Transform{bullet_pos_opt->x, bullet_pos_opt->y, 0.0f, 0.0f,
-                                                                     0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
-                        reg.add_component(explosion, cpnt::Sprite{{k_explosion_sprite_x, k_explosion_sprite_y,
-                                                                   k_explosion_sprite_w, k_explosion_sprite_h},
-                                                                  k_explosion_scale,
-                                                                  0,
-                                                                  "bulletExplosion"});
-                        reg.add_component(explosion, cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
-                        reg.add_component(explosion,
-                                          cpnt::Explosion{cpnt::Explosion::ExplosionType::Small, 0.0f,
-                                                          k_explosion_frame_duration, 0, k_explosion_total_frames});
+    auto bullet_view = reg.view<cpnt::Transform const, cpnt::Bullet const>();
+    auto shooter_bullet_view = reg.view<cpnt::Transform const, cpnt::BulletShooter const>();
+    auto player_view = reg.view<cpnt::Transform const, cpnt::Player const, cpnt::Hitbox const, cpnt::Health>();
+    auto enemy_view = reg.view<cpnt::Transform const, cpnt::Enemy const, cpnt::Health, cpnt::Hitbox const>();
+    auto shooter_view = reg.view<cpnt::Transform const, cpnt::Shooter const, cpnt::Health, cpnt::Hitbox const>();
+    auto boss_view = reg.view<cpnt::Transform const, cpnt::Health, cpnt::BossHitbox const>();
 
-                        auto& health = reg.get_components<cpnt::Health>()[enemy_idx];
-                        if (health) {
-                            health->hp--;
-                            if (health->hp <= 0) {
-                                points_gained += 100;
-                                enemies_killed += 1;
-                                health->hp = 0;
-                            }
-                        }
-                        break;
-                    }
+    // Get bullet entities
+    for (auto [bullet, bullet_pos, bullet_tag] : bullet_view) {
+        // Check against all enemies
+        for (auto [enemy, enemy_pos, enemy_tag, health, hitbox] : enemy_view) {
+            if (health.hp <= 0)
+                continue;
+            Rectangle enemy_rect = {enemy_pos.x + hitbox.offset_x, enemy_pos.y + hitbox.offset_y, hitbox.width,
+                                    hitbox.height};
+
+            if (CheckCollisionCircleRec({bullet_pos.x, bullet_pos.y}, k_bullet_radius, enemy_rect)) {
+                commands.kill(bullet);
+
+                spawn_bullet_explosion(commands, bullet_pos.x, bullet_pos.y);
+
+                health.hp--;
+                if (health.hp <= 0) {
+                    points_gained += 100;
+                    enemies_killed += 1;
+                    health.hp = 0;
                 }
+                break;
             }
         }
     }
 
     // Player - Enemy collision
-    for (auto [player_idx, player_pos_opt, player_tag_opt, player_hitbox_opt] :
-         ecs::indexed_zipper(positions, players, hitboxes)) {
-        if (player_pos_opt && player_tag_opt && player_hitbox_opt) {
-            for (auto [enemy_idx, enemy_pos_opt, enemy_tag_opt, health_opt, enemy_hitbox_opt] :
-                 ecs::indexed_zipper(positions, enemies, healths, hitboxes)) {
-                if (enemy_pos_opt && enemy_tag_opt && health_opt && health_opt->hp > 0 && enemy_hitbox_opt) {
-                    Rectangle enemy_rect = {enemy_pos_opt->x + enemy_hitbox_opt->offset_x,
-                                            enemy_pos_opt->y + enemy_hitbox_opt->offset_y, enemy_hitbox_opt->width,
-                                            enemy_hitbox_opt->height};
-                    Rectangle player_rect = {player_pos_opt->x + player_hitbox_opt->offset_x,
-                                             player_pos_opt->y + player_hitbox_opt->offset_y, player_hitbox_opt->width,
-                                             player_hitbox_opt->height};
-
-                    if (CheckCollisionRecs(player_rect, enemy_rect)) {
-                        // Handle player hit logic here
-                        // For simplicity, just reduce enemy health
-                        auto& health = reg.get_components<cpnt::Health>()[enemy_idx];
-                        if (health) {
-                            health->hp = 0;
-                        }
-
-                        auto& health_player = reg.get_components<cpnt::Health>()[player_idx];
-                        if (health_player) {
-                            health_player->hp -= k_collision_damage; // Reduce player health
-                        }
-                    }
-                }
+    for (auto [player, player_pos, player_tag, player_hitbox, health_player] : player_view) {
+        Rectangle player_rect = {player_pos.x + player_hitbox.offset_x, player_pos.y + player_hitbox.offset_y,
+                                 player_hitbox.width, player_hitbox.height};
+        for (auto [enemy, enemy_pos, enemy_tag, health, enemy_hitbox] : enemy_view) {
+            if (health.hp <= 0)
+                continue;
+            Rectangle enemy_rect = {enemy_pos.x + enemy_hitbox.offset_x, enemy_pos.y + enemy_hitbox.offset_y,
+                                    enemy_hitbox.width, enemy_hitbox.height};
+
+            if (CheckCollisionRecs(player_rect, enemy_rect)) {
+                // Handle player hit logic here
+                // For simplicity, just reduce enemy health
+                health.hp = 0;
+                health_player.hp -= k_collision_damage; // Reduce player health
             }
         }
     }
 
     // Shooter bullet - Player collision
-    for (auto [bullet_idx, bullet_pos_opt, bullet_shot_tag_opt] : ecs::indexed_zipper(positions, bullets_shooter)) {
-        if (!bullet_shot_tag_opt)
-            continue;
-        if (bullet_pos_opt && bullet_shot_tag_opt) {
-            for (auto [player_idx, player_pos_opt, player_tag_opt, player_hitbox_opt] :
-                 ecs::indexed_zipper(positions, players, hitboxes)) {
-                if (player_pos_opt && player_tag_opt && player_hitbox_opt) {
-                    Rectangle player_rect = {player_pos_opt->x + player_hitbox_opt->offset_x,
-                                             player_pos_opt->y + player_hitbox_opt->offset_y, player_hitbox_opt->width,
-                                             player_hitbox_opt->height};
-                    Vector2 bullet_pos = {bullet_pos_opt->x, bullet_pos_opt->y};
+    for (auto [bullet, bullet_pos, bullet_shot_tag] : shooter_bullet_view) {
+        for (auto [player, player_pos, player_tag, player_hitbox, health_player] : player_view) {
+            Rectangle player_rect = {player_pos.x + player_hitbox.offset_x, player_pos.y + player_hitbox.offset_y,
+                                     player_hitbox.width, player_hitbox.height};
 
-                    if (CheckCollisionCircleRec(bullet_pos, k_bullet_radius, player_rect)) {
-                        bullets_to_kill.push_back(reg.entity_from_index(bullet_idx));
+            if (CheckCollisionCircleRec({bullet_pos.x, bullet_pos.y}, k_bullet_radius, player_rect)) {
+                commands.kill(bullet);
 
-                        auto explosion = reg.spawn_entity();
-                        reg.add_component(explosion, cpnt::Transform{bullet_pos_opt->x, bullet_pos_opt->y, 0.0f, 0.0f,
-                                                                     0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
-                        reg.add_component(explosion, cpnt::Sprite{{k_explosion_sprite_x, k_explosion_sprite_y,
-                                                                   k_explosion_sprite_w, k_explosion_sprite_h},
-                                                                  k_explosion_scale,
-                                                                  0,
-                                                                  "bulletExplosion"});
-                        reg.add_component(explosion, cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
-                        reg.add_component(explosion,
-                                          cpnt::Explosion{cpnt::Explosion::ExplosionType::Small, 0.0f,
-                                                          k_explosion_frame_duration, 0, k_explosion_total_frames});
+                spawn_bullet_explosion(commands, bullet_pos.x, bullet_pos.y);
 
-                        auto& health_player = reg.get_components<cpnt::Health>()[player_idx];
-                        if (health_player) {
-                            health_player->hp -= k_bullet_damage; // Reduce player health
-                        }
-                        break;
-                    }
-                }
+                health_player.hp -= k_bullet_damage; // Reduce player health
+                break;
             }
         }
     }
 
     // Bullet - Shooter collision
-    for (auto [bullet_idx, bullet_pos_opt, bullet_tag_opt] : ecs::indexed_zipper(positions, bullets)) {
-        if (bullet_pos_opt && bullet_tag_opt) {
-            for (auto [shooter_idx, shooter_pos_opt, shooter_tag_opt, health_opt, shooter_hitbox_opt] :
-                 ecs::indexed_zipper(positions, shooters, healths, hitboxes)) {
-                if (shooter_pos_opt && shooter_tag_opt && health_opt && health_opt->hp > 0 && shooter_hitbox_opt) {
-                    Rectangle shooter_rect = {shooter_pos_opt->x + shooter_hitbox_opt->offset_x,
-                                             shooter_pos_opt->y + shooter_hitbox_opt->offset_y, shooter_hitbox_opt->width,
-                                             shooter_hitbox_opt->height};
-                    Vector2 bullet_pos = {bullet_pos_opt->x, bullet_pos_opt->y};
-
-                    if (CheckCollisionCircleRec(bullet_pos, k_bullet_radius, shooter_rect)) {
-                        bullets_to_kill.push_back(reg.entity_from_index(bullet_idx));
-
-                        auto explosion = reg.spawn_entity();
-                        reg.add_component(explosion, cpnt::Transform{bullet_pos_opt->x, bullet_pos_opt->y, 0.0f, 0.0f,
-                                                                     0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
-                        reg.add_component(explosion, cpnt::Sprite{{k_explosion_sprite_x, k_explosion_sprite_y,
-                                                                   k_explosion_sprite_w, k_explosion_sprite_h},
-                                                                  k_explosion_scale,
-                                                                  0,
-                                                                  "bulletExplosion"});
-                        reg.add_component(explosion, cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
-                        reg.add_component(explosion,
-                                          cpnt::Explosion{cpnt::Explosion::ExplosionType::Small, 0.0f,
-                                                          k_explosion_frame_duration, 0, k_explosion_total_frames});
-
-                        auto& health_shooter = reg.get_components<cpnt::Health>()[shooter_idx];
-                        if (health_shooter) {
-                            health_shooter->hp -= 1;
-                            if (health_shooter->hp <= 0) {
-                                points_gained += 150;
-                                enemies_killed += 1;
-                            }
-                        }
-                        break;
-                    }
+    for (auto [bullet, bullet_pos, bullet_tag] : bullet_view) {
+        for (auto [shooter, shooter_pos, shooter_tag, health_shooter, shooter_hitbox] : shooter_view) {
+            if (health_shooter.hp <= 0)
+                continue;
+            Rectangle shooter_rect = {shooter_pos.x + shooter_hitbox.offset_x, shooter_pos.y + shooter_hitbox.offset_y,
+                                      shooter_hitbox.width, shooter_hitbox.height};
+
+            if (CheckCollisionCircleRec({bullet_pos.x, bullet_pos.y}, k_bullet_radius, shooter_rect)) {
+                commands.kill(bullet);
+
+                spawn_bullet_explosion(commands, bullet_pos.x, bullet_pos.y);
+
+                health_shooter.hp -= 1;
+                if (health_shooter.hp <= 0) {
+                    points_gained += 150;
+                    enemies_killed += 1;
                 }
+                break;
             }
         }
     }
 
     // Player - Shooter collision
-    for (auto [player_idx, player_pos_opt, player_tag_opt, player_hitbox_opt] :
-         ecs::indexed_zipper(positions, players, hitboxes)) {
-        if (player_pos_opt && player_tag_opt && player_hitbox_opt) {
-            for (auto [enemy_idx, enemy_pos_opt, enemy_tag_opt, health_opt, enemy_hitbox_opt] :
-                 ecs::indexed_zipper(positions, enemies, healths, hitboxes)) {
-                if (enemy_pos_opt && enemy_tag_opt && health_opt && health_opt->hp > 0 && enemy_hitbox_opt) {
-                    Rectangle enemy_rect = {enemy_pos_opt->x + enemy_hitbox_opt->offset_x,
-                                            enemy_pos_opt->y + enemy_hitbox_opt->offset_y, enemy_hitbox_opt->width,
-                                            enemy_hitbox_opt->height};
-                    Rectangle player_rect = {player_pos_opt->x + player_hitbox_opt->offset_x,
-                                             player_pos_opt->y + player_hitbox_opt->offset_y, player_hitbox_opt->width,
-                                             player_hitbox_opt->height};
-
-                    if (CheckCollisionRecs(player_rect, enemy_rect)) {
-                        auto& health = reg.get_components<cpnt::Health>()[enemy_idx];
-                        if (health) {
-                            health->hp = 0;
-                        }
-
-                        auto& health_player = reg.get_components<cpnt::Health>()[player_idx];
-                        if (health_player) {
-                            health_player->hp -= k_collision_damage; // Reduce player health
-                        }
-                    }
-                }
+    for (auto [player, player_pos, player_tag, player_hitbox, health_player] : player_view) {
+        Rectangle player_rect = {player_pos.x + player_hitbox.offset_x, player_pos.y + player_hitbox.offset_y,
+                                 player_hitbox.width, player_hitbox.height};
+        for (auto [enemy, enemy_pos, enemy_tag, health, enemy_hitbox] : enemy_view) {
+            if (health.hp <= 0)
+                continue;
+            Rectangle enemy_rect = {enemy_pos.x + enemy_hitbox.offset_x, enemy_pos.y + enemy_hitbox.offset_y,
+                                    enemy_hitbox.width, enemy_hitbox.height};
+
+            if (CheckCollisionRecs(player_rect, enemy_rect)) {
+                health.hp = 0;
+                health_player.hp -= k_collision_damage; // Reduce player health
             }
         }
     }
 
     // BUllet - Boss collision
 
-    for (auto [bullet_idx, bullet_pos_opt, bullet_tag_opt] : ecs::indexed_zipper(positions, bullets)) {
-        if (bullet_pos_opt && bullet_tag_opt) {
-            for (auto [boss_idx, boss_pos_opt, health_opt, boss_hitbox_opt] :
-                 ecs::indexed_zipper(positions, healths, boss_hitboxes)) {
-                if (boss_pos_opt && health_opt && health_opt->hp > 0 && boss_hitbox_opt) {
-                    Rectangle rect_1 = {boss_pos_opt->x + boss_hitbox_opt->offset_x_1,
-                                        boss_pos_opt->y + boss_hitbox_opt->offset_y_1,
-                                        boss_hitbox_opt->width_1, boss_hitbox_opt->height_1};
-                    Rectangle rect_2 = {boss_pos_opt->x + boss_hitbox_opt->offset_x_2,
-                                        boss_pos_opt->y + boss_hitbox_opt->offset_y_2,
-                                        boss_hitbox_opt->width_2, boss_hitbox_opt->height_2};
-                    Rectangle rect_3 = {boss_pos_opt->x + boss_hitbox_opt->offset_x_3,
-                                        boss_pos_opt->y + boss_hitbox_opt->offset_y_3,
-                                        boss_hitbox_opt->width_3, boss_hitbox_opt->height_3};
-                    Vector2 bullet_pos = {bullet_pos_opt->x, bullet_pos_opt->y};
-
-                    if (CheckCollisionCircleRec(bullet_pos, k_bullet_radius, rect_1) ||
-                        CheckCollisionCircleRec(bullet_pos, k_bullet_radius, rect_2) ||
-                        CheckCollisionCircleRec(bullet_pos, k_bullet_radius, rect_3)) {
-                        bullets_to_kill.push_back(reg.entity_from_index(bullet_idx));
-                        auto explosion = reg.spawn_entity();
-                        reg.add_component(explosion, cpnt::Transform{bullet_pos_opt->x, bullet_pos_opt->y, 0.0f, 0.0f,
-                                                                     0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
-                        reg.add_component(explosion, cpnt::Sprite{{k_explosion_sprite_x, k_explosion_sprite_y,
-                                                                   k_explosion_sprite_w, k_explosion_sprite_h},
-                                                                  k_explosion_scale,
-                                                                  0,
-                                                                  "bulletExplosion"});
-                        reg.add_component(explosion, cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
-                        reg.add_component(explosion,
-                                          cpnt::Explosion{cpnt::Explosion::ExplosionType::Small, 0.0f,
-                                                          k_explosion_frame_duration, 0, k_explosion_total_frames});
-
-                        auto& health_boss = reg.get_components<cpnt::Health>()[boss_idx];
-                        if (health_boss) {
-                            health_boss->hp -= 1;
-                            if (health_boss->hp <= 0) {
-                                points_gained += 500;
-                                enemies_killed += 1;
-                            }
-                        }
-                        break;
-                    }
+    for (auto [bullet, bullet_pos, bullet_tag] : bullet_view) {
+        for (auto [boss, boss_pos, health_boss, boss_hitbox] : boss_view) {
+            if (health_boss.hp <= 0)
+                continue;
+            Rectangle rect_1 = {boss_pos.x + boss_hitbox.offset_x_1, boss_pos.y + boss_hitbox.offset_y_1,
+                                boss_hitbox.width_1, boss_hitbox.height_1};
+            Rectangle rect_2 = {boss_pos.x + boss_hitbox.offset_x_2, boss_pos.y + boss_hitbox.offset_y_2,
+                                boss_hitbox.width_2, boss_hitbox.height_2};
+            Rectangle rect_3 = {boss_pos.x + boss_hitbox.offset_x_3, boss_pos.y + boss_hitbox.offset_y_3,
+                                boss_hitbox.width_3, boss_hitbox.height_3};
+            Vector2 bullet_center = {bullet_pos.x, bullet_pos.y};
+
+            if (CheckCollisionCircleRec(bullet_center, k_bullet_radius, rect_1) ||
+                CheckCollisionCircleRec(bullet_center, k_bullet_radius, rect_2) ||
+                CheckCollisionCircleRec(bullet_center, k_bullet_radius, rect_3)) {
+                commands.kill(bullet);
+                spawn_bullet_explosion(commands, bullet_pos.x, bullet_pos.y);
+
+                health_boss.hp -= 1;
+                if (health_boss.hp <= 0) {
+                    points_gained += 500;
+                    enemies_killed += 1;
                 }
+                break;
             }
         }
     }
 
-    for (auto e : bullets_to_kill) {
-        reg.kill_entity(e);
-    }
-
     // Update stats
-    for (auto [stats_idx, stats_opt] : ecs::indexed_zipper(stats)) {
-        if (stats_opt) {
-            auto& stat = reg.get_components<cpnt::Stats>()[stats_idx];
-            stat->score += points_gained;
-            stat->kills += enemies_killed;
-        }
+    for (auto [stats_entity, stat] : reg.view<cpnt::Stats>()) {
+        stat.score += points_gained;
+        stat.kills += enemies_killed;
     }
     // NOLINTEND(cppcoreguidelines-avoid-magic-numbers,-warnings-as-errors)
 }
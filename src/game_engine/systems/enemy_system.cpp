@@ -4,6 +4,9 @@
 #include "raylib.h"
 #include "systems/systems.h"
 
+#include <utility>
+#include <vector>
+
 using namespace engn;
 
 namespace {
@@ -24,38 +27,27 @@ constexpr float k_sprite_up_anim = 104.0f;
 constexpr float k_sprite_up_right = 137.0f;
 } // namespace
 
-void sys::enemy_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
+void sys::enemy_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform>& positions,
                        ecs::SparseArray<cpnt::Velocity> const& velocities, ecs::SparseArray<cpnt::Enemy> const& enemies,
-                       ecs::SparseArray<cpnt::Health> const& healths, ecs::SparseArray<cpnt::Sprite> const& sprites) {
+                       ecs::SparseArray<cpnt::Health>& healths, ecs::SparseArray<cpnt::Sprite>& sprites) {
     auto& reg = ctx.registry;
+    // Spawned after the loop: adding components may relocate the storage referenced below
+    std::vector<std::pair<float, float>> explosions;
 
     for (auto [idx, pos_opt, vel_opt, enemy_opt, health_opt] :
          ecs::indexed_zipper(positions, velocities, enemies, healths)) {
         if (pos_opt && vel_opt && enemy_opt && health_opt) {
-            auto& pos = reg.get_components<cpnt::Transform>()[idx];
-            auto& health = reg.get_components<cpnt::Health>()[idx];
-            auto& sprite = reg.get_components<cpnt::Sprite>()[idx];
-            auto& vel = reg.get_components<cpnt::Velocity>()[idx];
+            auto& pos = pos_opt;
+            auto& health = health_opt;
+            auto& sprite = sprites[idx];
 
             if (pos && vel_opt) {
                 pos->x += vel_opt->vx;
                 pos->y += vel_opt->vy;
                 //Respawn if off screen or dead
                 if (pos->x < k_offscreen_left || (health && health->hp <= 0)) {
-                    if (pos->x > k_offscreen_left) {
-                        auto explosion = reg.spawn_entity();
-                        reg.add_component(explosion,
-                                          cpnt::Transform{pos->x, pos->y, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
-                        reg.add_component(explosion, cpnt::Sprite{{0.0f, k_large_explosion_y, k_large_explosion_w,
-                                                                   k_large_explosion_h},
-                                                                  k_large_explosion_scale,
-                                                                  0,
-                                                                  "explosion"});
-                        reg.add_component(explosion, cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
-                        reg.add_component(explosion,
-                                          cpnt::Explosion{cpnt::Explosion::ExplosionType::Large, 0.0f,
-                                                          k_explosion_frame_duration, 0, k_explosion_frames});
-                    }
+                    if (pos->x > k_offscreen_left)
+                        explosions.emplace_back(pos->x, pos->y);
 
                     // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access)
                     pos->x =
@@ -105,4 +97,19 @@ void sys::enemy_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> con
             }
         }
     }
+
+    for (auto [x, y] : explosions) {
+        auto explosion = reg.spawn_entity();
+        reg.add_component(explosion,
+                          cpnt::Transform{x, y, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
+        reg.add_component(explosion, cpnt::Sprite{{0.0f, k_large_explosion_y, k_large_explosion_w,
+                                                   k_large_explosion_h},
+                                                  k_large_explosion_scale,
+                                                  0,
+                                                  "explosion"});
+        reg.add_component(explosion, cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
+        reg.add_component(explosion,
+                          cpnt::Explosion{cpnt::Explosion::ExplosionType::Large, 0.0f,
+                                          k_explosion_frame_duration, 0, k_explosion_frames});
+    }
 }
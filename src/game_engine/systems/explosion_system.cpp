@@ -7,17 +7,16 @@
 using namespace engn;
 
 void sys::explosion_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
-                           ecs::SparseArray<cpnt::Explosion> const& explosions,
-                           ecs::SparseArray<cpnt::Sprite> const& sprites) {
-    std::vector<ecs::Entity> to_remove;
+                           ecs::SparseArray<cpnt::Explosion>& explosions, ecs::SparseArray<cpnt::Sprite>& sprites) {
     auto& reg = ctx.registry;
+    auto& commands = ctx.commands();
 
     for (auto [idx, pos_opt, exp_opt] : ecs::indexed_zipper(positions, explosions)) {
         if (!pos_opt || !exp_opt)
             continue;
 
-        auto& exp = reg.get_components<cpnt::Explosion>()[idx].value();
-        auto& spr = reg.get_components<cpnt::Sprite>()[idx].value();
+        auto& exp = exp_opt.value();
+        auto& spr = sprites[idx].value();
 
         exp.timer += GetFrameTime();
         if (exp.timer < exp.frame_duration)
@@ -33,12 +32,9 @@ void sys::explosion_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform>
 
         // Stop when next frame would be outside the explosion strip
         if (exp.current_frame >= exp.total_frames) {
-            to_remove.push_back(reg.entity_from_index(idx));
+            commands.kill(reg.entity_from_index(idx));
         } else {
             spr.source_rect.x = next_x;
         }
     }
-
-    for (auto e : to_remove)
-        reg.kill_entity(e);
 }
@@ -43,72 +43,72 @@ static std::unordered_map<ComponentType, ComponentAdder> build_component_adders(
     return {
         {ComponentType::bullet, [](ecs::Registry& reg, ecs::Entity e, const SerializedComponent& sc) {
             cpnt::Bullet component;
-            component.deserialize(sc.data);
+            cpnt::deserialize(component, sc.data);
             reg.add_component(e, std::move(component));
         }},
         {ComponentType::enemy, [](ecs::Registry& reg, ecs::Entity e, const SerializedComponent& sc) {
             cpnt::Enemy component;
-            component.deserialize(sc.data);
+            cpnt::deserialize(component, sc.data);
             reg.add_component(e, std::move(component));
         }},
         {ComponentType::entity_type, [](ecs::Registry& reg, ecs::Entity e, const SerializedComponent& sc) {
             cpnt::EntityType component;
-            component.deserialize(sc.data);
+            cpnt::deserialize(component, sc.data);
             reg.add_component(e, std::move(component));
         }},
         {ComponentType::health, [](ecs::Registry& reg, ecs::Entity e, const SerializedComponent& sc) {
             cpnt::Health component;
-            component.deserialize(sc.data);
+            cpnt::deserialize(component, sc.data);
             reg.add_component(e, std::move(component));
         }},
         {ComponentType::hitbox, [](ecs::Registry& reg, ecs::Entity e, const SerializedComponent& sc) {
             cpnt::Hitbox component;
-            component.deserialize(sc.data);
+            cpnt::deserialize(component, sc.data);
             reg.add_component(e, std::move(component));
         }},
         {ComponentType::movement_pattern, [](ecs::Registry& reg, ecs::Entity e, const SerializedComponent& sc) {
             cpnt::MovementPattern component;
-            component.deserialize(sc.data);
+            cpnt::deserialize(component, sc.data);
             reg.add_component(e, std::move(component));
         }},
         {ComponentType::player, [](ecs::Registry& reg, ecs::Entity e, const SerializedComponent& sc) {
             cpnt::Player component;
-            component.deserialize(sc.data);
+            cpnt::deserialize(component, sc.data);
             reg.add_component(e, std::move(component));
         }},
         {ComponentType::replicated, [](ecs::Registry& reg, ecs::Entity e, const SerializedComponent& sc) {
             cpnt::Replicated component;
-            component.deserialize(sc.data);
+            cpnt::deserialize(component, sc.data);
             reg.add_component(e, std::move(component));
         }},
         {ComponentType::stats, [](ecs::Registry& reg, ecs::Entity e, const SerializedComponent& sc) {
             cpnt::Stats component;
-            component.deserialize(sc.data);
+            cpnt::deserialize(component, sc.data);
             reg.add_component(e, std::move(component));
         }},
         {ComponentType::tag, [](ecs::Registry& reg, ecs::Entity e, const SerializedComponent& sc) {
             cpnt::Tag component;
-            component.deserialize(sc.data);
+            cpnt::deserialize(component, sc.data);
             reg.add_component(e, std::move(component));
         }},
         {ComponentType::transform, [](ecs::Registry& reg, ecs::Entity e, const SerializedComponent& sc) {
             cpnt::Transform component;
-            component.deserialize(sc.data);
+            cpnt::deserialize(component, sc.data);
             reg.add_component(e, std::move(component));
         }},
         {ComponentType::velocity, [](ecs::Registry& reg, ecs::Entity e, const SerializedComponent& sc) {
             cpnt::Velocity component;
-            component.deserialize(sc.data);
+            cpnt::deserialize(component, sc.data);
             reg.add_component(e, std::move(component));
         }},
         {ComponentType::shooter, [](ecs::Registry& reg, ecs::Entity e, const SerializedComponent& sc) {
             cpnt::Shooter component;
-            component.deserialize(sc.data);
+            cpnt::deserialize(component, sc.data);
             reg.add_component(e, std::move(component));
         }},
         {ComponentType::bullet_shooter, [](ecs::Registry& reg, ecs::Entity e, const SerializedComponent& sc) {
             cpnt::BulletShooter component;
-            component.deserialize(sc.data);
+            cpnt::deserialize(component, sc.data);
             reg.add_component(e, std::move(component));
         }},
     };
@@ -134,50 +134,78 @@ void sys::handle_snapshots_deltas_system(EngineContext& ctx)
     });
 }
 
+// Local entity mirroring the server entity `entry.entity_id`, whatever its generation
+static std::optional<std::pair<ecs::Entity, std::uint32_t>> find_mirror(ecs::Registry &registry, const DeltaEntry &entry)
+{
+    for (const auto &[entity_id, replicated] : ecs::indexed_zipper(registry.get_components<cpnt::Replicated>())) {
+        if (replicated != std::nullopt && replicated->tag == entry.entity_id)
+            return std::make_pair(registry.entity_from_index(entity_id), replicated->generation);
+    }
+    return std::nullopt;
+}
+
+// Local mirror of the entry's entity, or nothing if the entry is about another generation of it
+static std::optional<ecs::Entity> find_replica(ecs::Registry &registry, const DeltaEntry &entry)
+{
+    auto mirror = find_mirror(registry, entry);
+
+    if (!mirror.has_value())
+        return std::nullopt;
+    if (mirror->second != entry.entity_generation) {
+        LOG_DEBUG("Dropping stale entry for net entity #{} (generation {}, local {})",
+            entry.entity_id, entry.entity_generation, mirror->second);
+        return std::nullopt;
+    }
+    return mirror->first;
+}
+
 static void add_entity(ecs::Registry &registry, const DeltaEntry &entry)
 {
+    auto mirror = find_mirror(registry, entry);
+
+    if (mirror.has_value()) {
+        if (mirror->second == entry.entity_generation)
+            return;
+        // The server reused the index: the previous entity is gone even if its removal was not received
+        registry.kill_entity(mirror->first);
+    }
+
     auto id = registry.spawn_entity();
 
     // All entity created over the network will have the replicated tag
     // It helps make a relation between server entities ids & local ones
-    registry.add_component(id, cpnt::Replicated{entry.entity_id});
+    registry.add_component(id, cpnt::Replicated{entry.entity_id, entry.entity_generation});
     LOG_INFO("New net entity #{}", entry.entity_id);
 }
 
 static void remove_entity(ecs::Registry &registry, const DeltaEntry &entry)
 {
-    auto replicated_id = entry.entity_id;
+    auto local_entity = find_replica(registry, entry);
 
-    for (const auto &[entity_id, replicated] : ecs::indexed_zipper(registry.get_components<cpnt::Replicated>())) {
-        if (replicated != std::nullopt && replicated->tag == replicated_id) {
-            registry.kill_entity(registry.entity_from_index(entity_id));
-            LOG_DEBUG("Kill entity id:{}  repl_id:{}", entity_id, replicated_id);
-            return;
-        }
+    if (local_entity.has_value()) {
+        registry.kill_entity(local_entity.value());
+        LOG_DEBUG("Kill entity id:{}  repl_id:{}", local_entity.value(), entry.entity_id);
     }
 }
 
 static void remove_component(ecs::Registry &registry, const DeltaEntry &entry)
 {
     ComponentType type = entry.component_type;
-    auto replicated_id = entry.entity_id;
 
     // Find the local entity that has this replicated id
-    for (const auto &[entity_id, replicated] : ecs::indexed_zipper(registry.get_components<cpnt::Replicated>())) {
-        if (replicated != std::nullopt && replicated->tag == replicated_id) {
-            auto local_entity = registry.entity_from_index(entity_id);
-
-            auto it = k_component_removers.find(type);
-            if (it != k_component_removers.end()) {
-                it->second(registry, local_entity);
-            } else {
-                LOG_WARNING("Unknown component type {} for removal",
-                    static_cast<std::uint8_t>(type));
-            }
-            return;
-        }
+    auto local_entity = find_replica(registry, entry);
+    if (!local_entity.has_value()) {
+        // LOG_WARNING("Could not find local entity with replicated id {} for component removal", entry.entity_id);
+        return;
+    }
+
+    auto it = k_component_removers.find(type);
+    if (it != k_component_removers.end()) {
+        it->second(registry, local_entity.value());
+    } else {
+        LOG_WARNING("Unknown component type {} for removal",
+            static_cast<std::uint8_t>(type));
     }
-    // LOG_WARNING("Could not find local entity with replicated id {} for component removal", replicated_id);
 }
 
 static void initialize_archetype(ecs::Registry &registry, ecs::Entity entity, const DeltaEntry& entry);
@@ -191,29 +219,26 @@ static void add_component(ecs::Registry &registry, const DeltaEntry &entry)
 
     const SerializedComponent& serialized = entry.component.value();
     ComponentType type = serialized.type;
-    auto replicated_id = entry.entity_id;
 
     // Find the local entity that has this replicated id
-    for (const auto &[entity_id, replicated] : ecs::indexed_zipper(registry.get_components<cpnt::Replicated>())) {
-        if (replicated != std::nullopt && replicated->tag == replicated_id) {
-            auto local_entity = registry.entity_from_index(entity_id);
-
-            auto it = k_component_adders.find(type);
-            if (it != k_component_adders.end()) {
-                it->second(registry, local_entity, serialized);
-
-                // Init graphics component if an EntityType was added
-                if (type == ComponentType::entity_type) {
-                    initialize_archetype(registry, local_entity, entry);
-                }
-            } else {
-                LOG_WARNING("Unknown component type {} for addition",
-                    static_cast<std::uint8_t>(type));
-            }
-            return;
+    auto local_entity = find_replica(registry, entry);
+    if (!local_entity.has_value()) {
+        LOG_WARNING("Could not find local entity with replicated id {} for component addition", entry.entity_id);
+        return;
+    }
+
+    auto it = k_component_adders.find(type);
+    if (it != k_component_adders.end()) {
+        it->second(registry, local_entity.value(), serialized);
+
+        // Init graphics component if an EntityType was added
+        if (type == ComponentType::entity_type) {
+            initialize_archetype(registry, local_entity.value(), entry);
         }
+    } else {
+        LOG_WARNING("Unknown component type {} for addition",
+            static_cast<std::uint8_t>(type));
     }
-    LOG_WARNING("Could not find local entity with replicated id {} for component addition", replicated_id);
 }
 
 #pragma region Archetypes
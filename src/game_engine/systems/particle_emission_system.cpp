@@ -5,6 +5,8 @@
 
 #include <cmath>
 #include <cstdlib>
+#include <utility>
+#include <vector>
 
 using namespace engn;
 
@@ -30,50 +32,47 @@ void sys::particle_emission_system(EngineContext& ctx, ecs::SparseArray<cpnt::Tr
                                    ecs::SparseArray<cpnt::Particle> const& particles,
                                    ecs::SparseArray<cpnt::Bullet> const& bullets,
                                    ecs::SparseArray<cpnt::BulletShooter> const& bullets_shooter) {
-    const auto k_particles = static_cast<int>(ctx.k_particles);
+    const auto k_particles = static_cast<std::size_t>(ctx.k_particles);
     auto& reg = ctx.registry;
 
+    // Gather the emitters first, then spawn every particle of the tick in one batch
+    std::vector<std::pair<cpnt::Transform, cpnt::Particle>> emitters;
     for (auto [idx, pos_opt, bullets_opt] : ecs::indexed_zipper(positions, bullets)) {
-
-        if (pos_opt && bullets_opt) {
-            auto pos = pos_opt.value();
-
-            for (int i = 0; i < k_particles; i++) {
-                auto particle = reg.spawn_entity();
-                float angle = randf() * k_two_pi;
-                float r = randf() * k_particle_radius;
-                float offset_x = std::cos(angle) * r;
-                float offset_y = std::sin(angle) * r;
-                float pos_x = pos.x + offset_x + k_particle_offset_x;
-                float pos_y = pos.y + offset_y + k_particle_offset_y;
-                reg.add_component(particle, cpnt::Transform{pos_x, pos_y, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
-                float speed = randf() * k_particle_speed_multiplier + k_particle_speed_base;
-                reg.add_component(
-                    particle, cpnt::Velocity{std::cos(angle) * speed, std::sin(angle) * speed, 0.0f, 0.0f, 0.0f, 0.0f});
-                reg.add_component(particle, cpnt::Particle{0.0f, k_particle_lifetime, 0, 0, 255}); // NOLINT(cppcoreguidelines-avoid-magic-numbers,-warnings-as-errors)
-            }
-        }
+        if (pos_opt && bullets_opt)
+            emitters.emplace_back(pos_opt.value(), cpnt::Particle{0.0f, k_particle_lifetime, 0, 0, 255}); // NOLINT(cppcoreguidelines-avoid-magic-numbers,-warnings-as-errors)
     }
-
     for (auto [idx, pos_opt, bullets_shot_opt] : ecs::indexed_zipper(positions, bullets_shooter)) {
+        if (pos_opt && bullets_shot_opt)
+            emitters.emplace_back(pos_opt.value(), cpnt::Particle{0.0f, k_particle_lifetime, 255, 0, 0}); // NOLINT(cppcoreguidelines-avoid-magic-numbers,-warnings-as-errors)
+    }
+    if (emitters.empty() || k_particles == 0)
+        return;
 
-        if (pos_opt && bullets_shot_opt) {
-            auto pos = pos_opt.value();
+    auto spawned = reg.spawn_entities(emitters.size() * k_particles);
+    std::vector<cpnt::Transform> transforms;
+    std::vector<cpnt::Velocity> particle_velocities;
+    std::vector<cpnt::Particle> particle_components;
+    transforms.reserve(spawned.size());
+    particle_velocities.reserve(spawned.size());
+    particle_components.reserve(spawned.size());
 
-            for (int i = 0; i < k_particles; i++) {
-                auto particle = reg.spawn_entity();
-                float angle = randf() * k_two_pi;
-                float r = randf() * k_particle_radius;
-                float offset_x = std::cos(angle) * r;
-                float offset_y = std::sin(angle) * r;
-                float pos_x = pos.x + offset_x + k_particle_offset_x;
-                float pos_y = pos.y + offset_y + k_particle_offset_y;
-                reg.add_component(particle, cpnt::Transform{pos_x, pos_y, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
-                float speed = randf() * k_particle_speed_multiplier + k_particle_speed_base;
-                reg.add_component(
-                    particle, cpnt::Velocity{std::cos(angle) * speed, std::sin(angle) * speed, 0.0f, 0.0f, 0.0f, 0.0f});
-                reg.add_component(particle, cpnt::Particle{0.0f, k_particle_lifetime, 255, 0, 0}); // NOLINT(cppcoreguidelines-avoid-magic-numbers,-warnings-as-errors)
-            }
+    for (auto const& [pos, particle] : emitters) {
+        for (std::size_t i = 0; i < k_particles; i++) {
+            float angle = randf() * k_two_pi;
+            float r = randf() * k_particle_radius;
+            float offset_x = std::cos(angle) * r;
+            float offset_y = std::sin(angle) * r;
+            float pos_x = pos.x + offset_x + k_particle_offset_x;
+            float pos_y = pos.y + offset_y + k_particle_offset_y;
+            transforms.push_back(cpnt::Transform{pos_x, pos_y, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
+            float speed = randf() * k_particle_speed_multiplier + k_particle_speed_base;
+            particle_velocities.push_back(
+                cpnt::Velocity{std::cos(angle) * speed, std::sin(angle) * speed, 0.0f, 0.0f, 0.0f, 0.0f});
+            particle_components.push_back(particle);
         }
     }
+
+    reg.add_components<cpnt::Transform>(spawned, transforms);
+    reg.add_components<cpnt::Velocity>(spawned, particle_velocities);
+    reg.add_components<cpnt::Particle>(spawned, particle_components);
 }
@@ -46,39 +46,40 @@ constexpr float k_bullet_sprite_y = 105.0f;
 constexpr float k_bullet_scale = 2.0f;
 } // namespace
 
-void sys::player_control_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
+void sys::player_control_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform>& positions,
                                 ecs::SparseArray<cpnt::Player> const& players,
-                                ecs::SparseArray<cpnt::Sprite> const& sprites,
-                                ecs::SparseArray<cpnt::Velocity> const& velocities,
+                                ecs::SparseArray<cpnt::Sprite>& sprites,
+                                ecs::SparseArray<cpnt::Velocity>& velocities,
                                 ecs::SparseArray<cpnt::Health> const& healths) {
-    std::vector<ecs::Entity> to_remove;
     auto& reg = ctx.registry;
+    auto& commands = ctx.commands();
     float dt = ctx.delta_time;
 
     for (auto [idx, pos_opt, player_opt, vel_opt, hp_opt] :
          ecs::indexed_zipper(positions, players, velocities, healths)) {
         // Handle player health
         auto& hp = reg.get_components<cpnt::Health>()[idx];
-        auto& pos = reg.get_components<cpnt::Transform>()[idx];
+        // The zipper walks ids without a Transform too: look it up rather than index the packed pool
+        auto* pos = reg.get_components<cpnt::Transform>().find(idx);
 
         if (hp && hp->hp <= 0) {
-            auto explosion = reg.spawn_entity();
-            reg.add_component(explosion, cpnt::Transform{pos->x, pos->y, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
-            reg.add_component(explosion,
-                              cpnt::Sprite{{0.0f, k_explosion_sprite_y, k_explosion_sprite_w, k_explosion_sprite_h},
-                                           k_explosion_scale,
-                                           0,
-                                           "explosion"});
-            reg.add_component(explosion, cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
-            reg.add_component(explosion, cpnt::Explosion{cpnt::Explosion::ExplosionType::Large, 0.0f,
-                                                         k_explosion_frame_duration, 0, k_explosion_frames});
-            to_remove.push_back(reg.entity_from_index(idx));
+            if (pos) {
+                commands.spawn(cpnt::Transform{pos->x, pos->y, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f},
+                               cpnt::Sprite{{0.0f, k_explosion_sprite_y, k_explosion_sprite_w, k_explosion_sprite_h},
+                                            k_explosion_scale,
+                                            0,
+                                            "explosion"},
+                               cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+                               cpnt::Explosion{cpnt::Explosion::ExplosionType::Large, 0.0f,
+                                               k_explosion_frame_duration, 0, k_explosion_frames});
+            }
+            commands.kill(reg.entity_from_index(idx));
             continue;
         }
 
         if (pos_opt && player_opt) {
             auto& sprite = reg.get_components<cpnt::Sprite>()[idx];
-            auto& vel = reg.get_components<cpnt::Velocity>()[idx];
+            auto* vel = reg.get_components<cpnt::Velocity>().find(idx);
 
             if (pos) {
                 const auto& input = ctx.input_state;
@@ -160,13 +161,12 @@ void sys::player_control_system(EngineContext& ctx, ecs::SparseArray<cpnt::Trans
 
                 // Shoot
                 if (input.shoot_pressed) {
-                    auto bullet = reg.spawn_entity();
-                    reg.add_component(bullet, cpnt::Transform{pos->x + k_bullet_offset_x, pos->y + k_bullet_offset_y,
-                                                              0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
-                    reg.add_component(bullet, cpnt::Velocity{k_bullet_speed, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
-                    reg.add_component(bullet, cpnt::Bullet{});
-                    reg.add_component(bullet, cpnt::Hitbox{20.0f, 20.0f, k_bullet_width, k_bullet_height}); // NOLINT(cppcoreguidelines-avoid-magic-numbers,-warnings-as-errors)
-                    reg.add_component(
+                    auto bullet = commands.spawn(cpnt::Transform{pos->x + k_bullet_offset_x, pos->y + k_bullet_offset_y,
+                                                                 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f},
+                                                 cpnt::Velocity{k_bullet_speed, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+                                                 cpnt::Bullet{});
+                    commands.add(bullet, cpnt::Hitbox{20.0f, 20.0f, k_bullet_width, k_bullet_height}); // NOLINT(cppcoreguidelines-avoid-magic-numbers,-warnings-as-errors)
+                    commands.add(
                         bullet, cpnt::Sprite{{k_bullet_sprite_x, k_bullet_sprite_y, k_bullet_width, k_bullet_height},
                                              k_bullet_scale,
                                              0,
@@ -178,8 +178,4 @@ void sys::player_control_system(EngineContext& ctx, ecs::SparseArray<cpnt::Trans
             }
         }
     }
-
-    for (auto e : to_remove) {
-        reg.kill_entity(e);
-    }
 }
@@ -15,7 +15,7 @@ constexpr int k_alpha_max = 255;
 
 void sys::render_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
                         ecs::SparseArray<cpnt::Sprite> const& sprites, ecs::SparseArray<cpnt::Star> const& stars,
-                        ecs::SparseArray<cpnt::Velocity> const& velocities, ecs::SparseArray<cpnt::Particle> const& particles,
+                        ecs::SparseArray<cpnt::Velocity> const& velocities, ecs::SparseArray<cpnt::Particle>& particles,
                         ecs::SparseArray<cpnt::Stats> const& stats, ecs::SparseArray<cpnt::Boss> const& bosses) {
 
     auto& reg = ctx.registry;
@@ -65,13 +65,11 @@ void sys::render_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> co
                 (Color){particle_opt->red, particle_opt->green, particle_opt->blue, static_cast<unsigned char>(alpha * k_alpha_max)});
 
             // Update lifetime
-            auto& particles_arr = reg.get_components<cpnt::Particle>();
-            if (idx < particles_arr.size() && particles_arr[idx]) {
-                auto& particle = *particles_arr[idx];
+            if (idx < particles.size() && particles[idx]) {
+                auto& particle = *particles[idx];
                 particle.lifetime += GetFrameTime();
                 if (particle.lifetime >= particle.max_lifetime) {
-                    auto entity = reg.entity_from_index(idx);
-                    reg.kill_entity(entity);
+                    ctx.commands().kill(reg.entity_from_index(idx));
                 }
             }
         }
@@ -1,6 +1,12 @@
 #include "systems/systems.h"
 
+#include <algorithm>
 #include <memory>
+#include <span>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "networking/rtp/networking.h"
 
@@ -9,87 +15,97 @@
 
 using namespace engn;
 
-static std::optional<WorldDelta> compute_delta(WorldSnapshot const& snapshot,
-    ecs::Registry::Version latest_ack_version,
-    const ecs::Registry &registry)
-{
-    WorldDelta delta;
-
-    // New entities
-    for (const auto &[id, version] : registry.get_entity_creation_tombstones()) {
-        if (latest_ack_version >= version) continue;
+namespace {
 
-        DeltaEntry entry;
-        entry.operation = DeltaOperation::entity_add;
-        entry.entity_id = static_cast<std::uint32_t>(id.value());
-        delta.entries.push_back(entry);
+struct ComponentChangeHash {
+    std::size_t operator()(const std::pair<ComponentType, std::uint32_t>& key) const noexcept {
+        return std::hash<std::uint32_t>{}(key.second) ^ (std::hash<std::uint8_t>{}(static_cast<std::uint8_t>(key.first)) << 1);
     }
+};
 
-    // New or modified components
-    for (const auto &[identifier, version] : registry.get_component_metadata()) {
-        if (latest_ack_version >= version) continue;
-
-        ecs::Entity entity = identifier.first;
-        std::type_index type_idx = identifier.second;
+} // namespace
 
-        // Find the entity in the snapshot
-        auto entity_it = std::find_if(snapshot.entities.begin(), snapshot.entities.end(),
-            [entity](const EntitySnapshot& snapshot) {
-                return snapshot.entity_id == entity.value();
+static std::optional<WorldDelta> compute_delta(WorldSnapshot const& snapshot,
+    ecs::Registry::Version latest_ack_version,
+    const ecs::Registry &registry)
+{
+    using Op = ecs::ChangeJournal::Op;
+    using ComponentKey = std::pair<ComponentType, std::uint32_t>;
+
+    std::unordered_map<std::uint32_t, EntitySnapshot const*> snapshot_entities;
+    snapshot_entities.reserve(snapshot.entities.size());
+    for (const auto &entity_snapshot : snapshot.entities)
+        snapshot_entities.emplace(entity_snapshot.entity_id, &entity_snapshot);
+
+    // New or modified components: every component stamped after the acknowledged version
+    std::vector<DeltaEntry> updates;
+    std::unordered_set<ComponentKey, ComponentChangeHash> updated;
+
+    registry.each_changed(latest_ack_version, [&](std::type_index type_idx, std::span<std::size_t const> indices) {
+        auto type_it = k_type_index_to_component_type_map.find(type_idx);
+        if (type_it == k_type_index_to_component_type_map.end()) return; // Not replicated
+
+        for (auto idx : indices) {
+            // Entities without the Replicated component are not in the snapshot
+            auto entity_it = snapshot_entities.find(static_cast<std::uint32_t>(idx));
+            if (entity_it == snapshot_entities.end()) continue;
+
+            // Find the component in the entity
+            const auto &components = entity_it->second->components;
+            auto comp_it = std::find_if(components.begin(), components.end(),
+                [type_it](const SerializedComponent& comp) {
+                    return comp.type == type_it->second;
+                }
+            );
+
+            // Ensure the component exists in the entity
+            if (comp_it == components.end()) {
+                LOG_ERROR("Component of type {} for entity {} not found in current snapshot while computing delta",
+                    type_idx.name(), idx);
+                continue;
             }
-        );
 
-        // Ensure the entity exists in the snapshot
-        if (entity_it == snapshot.entities.end()) {
-            LOG_ERROR("Entity {} not found in current snapshot while computing delta", entity.value());
-            continue;
+            ecs::Entity entity = registry.entity_from_index(idx);
+            DeltaEntry entry;
+            entry.operation = DeltaOperation::component_add_or_update;
+            entry.entity_id = static_cast<std::uint32_t>(idx);
+            entry.entity_generation = entity.generation();
+            entry.component = *comp_it;
+            updates.push_back(entry);
+            updated.emplace(type_it->second, entry.entity_id);
         }
+    });
 
-        // Find the component in the entity
-        auto comp_it = std::find_if(entity_it->components.begin(), entity_it->components.end(),
-            [type_idx](const SerializedComponent& comp) {
-                return comp.type == k_type_index_to_component_type_map.at(type_idx);
-            }
-        );
-
-        // Ensure the component exists in the entity
-        if (comp_it == entity_it->components.end()) {
-            LOG_ERROR("Component of type {} for entity {} not found in current snapshot while computing delta",
-                type_idx.name(), entity.value());
-            continue;
-        }
+    // Created and destroyed entities, removed components, in the order they happened
+    WorldDelta delta;
+    std::unordered_set<ComponentKey, ComponentChangeHash> removed;
 
+    for (const auto &change : registry.get_change_journal().since(latest_ack_version)) {
         DeltaEntry entry;
-        entry.operation = DeltaOperation::component_add_or_update;
-        entry.entity_id = static_cast<std::uint32_t>(entity.value());
-        entry.component = *comp_it;
-        delta.entries.push_back(entry);
-    }
+        entry.entity_id = static_cast<std::uint32_t>(change.entity.value());
+        entry.entity_generation = change.entity.generation();
 
-    // Deleted components
-    for (const auto &[id, comp_and_version] : registry.get_component_destruction_tombstones()) {
-        for (const auto &[component, version] : comp_and_version) {
-            if (latest_ack_version >= version) continue;
+        if (change.op == Op::component_removed) {
+            // Leftover of a killed entity: its index may already belong to another one
+            if (!registry.alive(change.entity)) continue;
 
-            DeltaEntry entry;
-            entry.operation = DeltaOperation::component_remove;
-            entry.entity_id = static_cast<std::uint32_t>(id.value());
-            entry.component_type = k_type_index_to_component_type_map.at(component);
-            delta.entries.push_back(entry);
-        }
-    }
+            auto type_it = k_type_index_to_component_type_map.find(registry.component_type(change.component));
+            if (type_it == k_type_index_to_component_type_map.end()) continue; // Not replicated
 
-    // Deleted entities
-    for (const auto &[id, version] : registry.get_entity_destruction_tombstones()) {
-        if (latest_ack_version >= version) continue;
+            // Added back since: the update below carries the current value
+            const ComponentKey k_key{type_it->second, entry.entity_id};
+            if (updated.contains(k_key) || !removed.insert(k_key).second) continue;
 
-        DeltaEntry entry;
-        entry.operation = DeltaOperation::entity_remove;
-        entry.entity_id = static_cast<std::uint32_t>(id.value());
+            entry.operation = DeltaOperation::component_remove;
+            entry.component_type = type_it->second;
+        } else {
+            entry.operation = change.op == Op::entity_created ? DeltaOperation::entity_add : DeltaOperation::entity_remove;
+        }
         delta.entries.push_back(entry);
     }
 
-    if (delta.entries.size() == 0) return std::nullopt;
+    delta.entries.insert(delta.entries.end(), updates.begin(), updates.end());
+    if (delta.entries.empty()) return std::nullopt;
 
     return delta;
 }
@@ -99,7 +115,10 @@ void sys::send_snapshot_to_client_system(EngineContext& ctx,
 {
     // LOG_DEBUG("Running send_snapshot_to_client_system");
     const auto k_clients = ctx.get_clients();
+    if (k_clients.empty()) return;
 
+    // Every delta of this tick leaves in one batch once the loop is done
+    const net::CorkGuard k_cork(*ctx.network_session);
     for (const auto &endpoint : k_clients) {
         const auto &ack_snapshot = ctx.get_latest_acknowledged_snapshot(endpoint);
         auto &latest_snapshot = ctx.get_latest_snapshot(endpoint);
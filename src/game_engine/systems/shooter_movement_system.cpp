@@ -15,26 +15,22 @@ constexpr float k_dive_amplitude_multiplier = 2.0f;
 } // namespace
 
 void sys::shooter_movement_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
-                                ecs::SparseArray<cpnt::MovementPattern> const& patterns,
-                                ecs::SparseArray<cpnt::Velocity> const& velocity,
+                                ecs::SparseArray<cpnt::MovementPattern>& patterns,
+                                ecs::SparseArray<cpnt::Velocity>& velocity,
                                 ecs::SparseArray<cpnt::Shooter> const& shooters,
                                 ecs::SparseArray<cpnt::Player> const& player) {
-    auto& reg = ctx.registry;
     float dt = ctx.delta_time;
 
-    for (auto [idx, posplay_opt, play_opt] : ecs::indexed_zipper(positions, player)) {
-        if (!posplay_opt || !play_opt)
-            continue;
-        auto& posplay = reg.get_components<cpnt::Transform>()[idx].value();
-    }
-
     for (auto [idx, pos_opt, pat_opt, shot_opt] : ecs::indexed_zipper(positions, patterns, shooters)) {
         if (!pos_opt || !pat_opt || !shot_opt)
             continue;
 
-        auto& pos = reg.get_components<cpnt::Transform>()[idx].value();
-        auto& pat = reg.get_components<cpnt::MovementPattern>()[idx].value();
-        auto& vel = reg.get_components<cpnt::Velocity>()[idx].value();
+        if (!velocity.contains(idx))
+            continue;
+
+        auto const& pos = pos_opt.value();
+        auto& pat = pat_opt.value();
+        auto& vel = velocity[idx].value();
 
         pat.timer += dt;
 
@@ -46,9 +42,8 @@ void sys::shooter_movement_system(EngineContext& ctx, ecs::SparseArray<cpnt::Tra
         for (auto [pidx, ppos_opt, pplay_opt] : ecs::indexed_zipper(positions, player)) {
             if (!ppos_opt || !pplay_opt)
                 continue;
-            auto& ppos = reg.get_components<cpnt::Transform>()[pidx].value();
-            delta_x = ppos.x - pos.x;
-            delta_y = ppos.y - pos.y;
+            delta_x = ppos_opt->x - pos.x;
+            delta_y = ppos_opt->y - pos.y;
             break; // Assuming only one player
         }
         float angle_to_player = std::atan2(delta_y, delta_x) * (180.0f / k_pi); // NOLINT(cppcoreguidelines-avoid-magic-numbers,-warnings-as-errors)
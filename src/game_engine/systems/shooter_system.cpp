@@ -4,6 +4,9 @@
 #include "raylib.h"
 #include "systems/systems.h"
 
+#include <utility>
+#include <vector>
+
 using namespace engn;
 
 namespace {
@@ -39,6 +42,8 @@ void sys::shooter_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> c
                        ecs::SparseArray<cpnt::Health> const& healths, ecs::SparseArray<cpnt::Sprite> const& sprites,
                        ecs::SparseArray<cpnt::Shooter> const& shooters, ecs::SparseArray<cpnt::Player> const& player) {
     auto& reg = ctx.registry;
+    // Spawned after the loop: adding components may relocate the storage referenced below
+    std::vector<std::pair<float, float>> explosions;
     float dt = ctx.delta_time;
 
     for (auto [idx, pos_opt, vel_opt, shot_opt, health_opt] :
@@ -55,20 +60,8 @@ void sys::shooter_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> c
                 pos->y += vel_opt->vy;
                 // Respawn if off screen or dead
                 if (pos->x < k_offscreen_left || (health && health->hp <= 0)) {
-                    if (pos->x > k_offscreen_left) {
-                        auto explosion = reg.spawn_entity();
-                        reg.add_component(explosion,
-                                          cpnt::Transform{pos->x, pos->y, 0.0f, 55.f, 45.f, 0.0f, 1.0f, 1.0f, 1.0f}); // NOLINT(cppcoreguidelines-avoid-magic-numbers,-warnings-as-errors)
-                        reg.add_component(explosion, cpnt::Sprite{{0.0f, k_large_explosion_y, k_large_explosion_w,
-                                                                   k_large_explosion_h},
-                                                                  k_large_explosion_scale,
-                                                                  0,
-                                                                  "explosion"});
-                        reg.add_component(explosion, cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
-                        reg.add_component(explosion,
-                                          cpnt::Explosion{cpnt::Explosion::ExplosionType::Large, 0.0f,
-                                                          k_explosion_frame_duration, 0, k_explosion_frames});
-                    }
+                    if (pos->x > k_offscreen_left)
+                        explosions.emplace_back(pos->x, pos->y);
 
                     // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access)
                     pos->x =
@@ -121,4 +114,19 @@ void sys::shooter_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> c
             }
         }
     }
+
+    for (auto [x, y] : explosions) {
+        auto explosion = reg.spawn_entity();
+        reg.add_component(explosion,
+                          cpnt::Transform{x, y, 0.0f, 55.f, 45.f, 0.0f, 1.0f, 1.0f, 1.0f}); // NOLINT(cppcoreguidelines-avoid-magic-numbers,-warnings-as-errors)
+        reg.add_component(explosion, cpnt::Sprite{{0.0f, k_large_explosion_y, k_large_explosion_w,
+                                                   k_large_explosion_h},
+                                                  k_large_explosion_scale,
+                                                  0,
+                                                  "explosion"});
+        reg.add_component(explosion, cpnt::Velocity{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
+        reg.add_component(explosion,
+                          cpnt::Explosion{cpnt::Explosion::ExplosionType::Large, 0.0f,
+                                          k_explosion_frame_duration, 0, k_explosion_frames});
+    }
 }
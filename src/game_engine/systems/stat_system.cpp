@@ -4,6 +4,7 @@
 #include "systems/systems.h"
 
 #include <random>
+#include <vector>
 
 using namespace engn;
 
@@ -53,27 +54,24 @@ void sys::stat_system(EngineContext& ctx, ecs::SparseArray<cpnt::Stats> const& s
                 constexpr float k_enemy_hitbox_width = 15.0f;
                 constexpr float k_enemy_hitbox_height = 18.0f;
                 constexpr float k_pattern_base_speed = 201.0f;
-                for (size_t i = 0; i < k_new_charger_enemies * stat->level; i++) {
-                    auto enemy = ctx.registry.spawn_entity();
-
+                auto enemies = reg.spawn_entities(static_cast<std::size_t>(k_new_charger_enemies * stat->level));
+                std::vector<cpnt::Transform> transforms;
+                std::vector<cpnt::Velocity> velocities;
+                std::vector<cpnt::MovementPattern> patterns;
+                transforms.reserve(enemies.size());
+                velocities.reserve(enemies.size());
+                patterns.reserve(enemies.size());
+
+                for (size_t i = 0; i < enemies.size(); i++) {
                     float spawn_y = (float)GetRandomValue(ctx.k_spawn_margin, k_height - ctx.k_spawn_margin);
                     float spawn_x = (float)GetRandomValue(k_width, k_width * 2);
 
                     // Position
-                    ctx.registry.add_component(enemy, engn::cpnt::Transform{spawn_x, spawn_y, 0, 0, 0, 0, 1, 1, 1});
+                    transforms.push_back(engn::cpnt::Transform{spawn_x, spawn_y, 0, 0, 0, 0, 1, 1, 1});
 
                     // Velocity
-                    ctx.registry.add_component(
-                        enemy, cpnt::Velocity{-(ctx.k_enemy_base_speed + randf() * ctx.k_enemy_speed_variance), 0.0f, 0.0f, 0.0f, 0.0f});
-
-                    // Other components
-                    ctx.registry.add_component(enemy, cpnt::Enemy{});
-                    ctx.registry.add_component(
-                        enemy, cpnt::Sprite{{k_enemy_sprite_x, k_enemy_sprite_y, k_enemy_sprite_width, k_enemy_sprite_height},
-                                            k_enemy_scale,
-                                            0,
-                                            "enemy_ship"});
-                    ctx.registry.add_component(enemy, cpnt::Health{ctx.k_enemy_health, ctx.k_enemy_health});
+                    velocities.push_back(
+                        cpnt::Velocity{-(ctx.k_enemy_base_speed + randf() * ctx.k_enemy_speed_variance), 0.0f, 0.0f, 0.0f, 0.0f});
 
                     // Create a **new MovementPattern instance** for this enemy
                     cpnt::MovementPattern pat;
@@ -97,11 +95,22 @@ void sys::stat_system(EngineContext& ctx, ecs::SparseArray<cpnt::Stats> const& s
                             break;
                     }
                     pat.base_y = spawn_y;
-
-                    ctx.registry.add_component(enemy, std::move(pat));
-                    ctx.registry.add_component(enemy, cpnt::Hitbox{k_enemy_hitbox_width * k_enemy_scale, k_enemy_hitbox_height * k_enemy_scale,
-                                                                          k_enemy_sprite_width, k_enemy_sprite_height});
+                    patterns.push_back(std::move(pat));
                 }
+
+                // The whole wave is inserted pool by pool
+                reg.add_components<cpnt::Transform>(enemies, transforms);
+                reg.add_components<cpnt::Velocity>(enemies, velocities);
+                reg.emplace_components<cpnt::Enemy>(enemies);
+                reg.emplace_components<cpnt::Sprite>(
+                    enemies, cpnt::Sprite{{k_enemy_sprite_x, k_enemy_sprite_y, k_enemy_sprite_width, k_enemy_sprite_height},
+                                          k_enemy_scale,
+                                          0,
+                                          "enemy_ship"});
+                reg.emplace_components<cpnt::Health>(enemies, cpnt::Health{ctx.k_enemy_health, ctx.k_enemy_health});
+                reg.add_components<cpnt::MovementPattern>(enemies, patterns);
+                reg.emplace_components<cpnt::Hitbox>(enemies, cpnt::Hitbox{k_enemy_hitbox_width * k_enemy_scale, k_enemy_hitbox_height * k_enemy_scale,
+                                                                           k_enemy_sprite_width, k_enemy_sprite_height});
                 // Create shooters
             
                 constexpr float k_shooter_sprite_x = 87.0f;
@@ -21,33 +21,33 @@ void ui_background_renderer(EngineContext& ctx, const ecs::SparseArray<cpnt::UIT
                             const ecs::SparseArray<cpnt::UIStyle>&, const ecs::SparseArray<cpnt::UIInteractable>&);
 void ui_text_renderer(EngineContext& ctx, const ecs::SparseArray<cpnt::UITransform>&,
                       const ecs::SparseArray<cpnt::UIText>&, const ecs::SparseArray<cpnt::UIStyle>&,
-                      const ecs::SparseArray<cpnt::UIInteractable>&);
+                      const ecs::SparseArray<cpnt::UIInteractable>&, const ecs::SparseArray<cpnt::UIInputField>&);
 void ui_input_field_updater(EngineContext& ctx, const ecs::SparseArray<cpnt::UIInteractable>&);
 
-void bullet_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
+void bullet_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform>& positions,
                    ecs::SparseArray<cpnt::Velocity> const& velocities, ecs::SparseArray<cpnt::Bullet> const& bullets);
 
-void BulletShooter_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
+void BulletShooter_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform>& positions,
                    ecs::SparseArray<cpnt::Velocity> const& velocities, ecs::SparseArray<cpnt::BulletShooter> const& bullets_shooter);
 
 void collision_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
                       ecs::SparseArray<cpnt::Bullet> const& bullets, ecs::SparseArray<cpnt::Enemy> const& enemies,
-                      ecs::SparseArray<cpnt::Health> const& healths, ecs::SparseArray<cpnt::Player> const& players,
+                      ecs::SparseArray<cpnt::Health>& healths, ecs::SparseArray<cpnt::Player> const& players,
                       ecs::SparseArray<cpnt::Hitbox> const& hitboxes, ecs::SparseArray<cpnt::BulletShooter> const& bullets_shooter,
-                      ecs::SparseArray<cpnt::Shooter> const& shooters, ecs::SparseArray<cpnt::Stats> const& stats,
+                      ecs::SparseArray<cpnt::Shooter> const& shooters, ecs::SparseArray<cpnt::Stats>& stats,
                       ecs::SparseArray<cpnt::BossHitbox> const& boss_hitboxes);
 
 void enemy_movement_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
-                           ecs::SparseArray<cpnt::MovementPattern> const& patterns,
-                           ecs::SparseArray<cpnt::Velocity> const& velocity);
+                           ecs::SparseArray<cpnt::MovementPattern>& patterns,
+                           ecs::SparseArray<cpnt::Velocity>& velocity);
 
-void enemy_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
+void enemy_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform>& positions,
                   ecs::SparseArray<cpnt::Velocity> const& velocities, ecs::SparseArray<cpnt::Enemy> const& enemies,
-                  ecs::SparseArray<cpnt::Health> const& healths, ecs::SparseArray<cpnt::Sprite> const& sprites);
+                  ecs::SparseArray<cpnt::Health>& healths, ecs::SparseArray<cpnt::Sprite>& sprites);
 
 void shooter_movement_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
-                           ecs::SparseArray<cpnt::MovementPattern> const& patterns,
-                           ecs::SparseArray<cpnt::Velocity> const& velocity,
+                           ecs::SparseArray<cpnt::MovementPattern>& patterns,
+                           ecs::SparseArray<cpnt::Velocity>& velocity,
                            ecs::SparseArray<cpnt::Shooter> const& shooters,
                            ecs::SparseArray<cpnt::Player> const& player);
 
@@ -57,8 +57,7 @@ void shooter_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const&
                   ecs::SparseArray<cpnt::Shooter> const& shooters, ecs::SparseArray<cpnt::Player> const& player);
 
 void explosion_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
-                      ecs::SparseArray<cpnt::Explosion> const& explosions,
-                      ecs::SparseArray<cpnt::Sprite> const& sprites);
+                      ecs::SparseArray<cpnt::Explosion>& explosions, ecs::SparseArray<cpnt::Sprite>& sprites);
 
 void particle_emission_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
                               ecs::SparseArray<cpnt::Velocity> const& velocities,
@@ -66,14 +65,14 @@ void particle_emission_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transfo
                               ecs::SparseArray<cpnt::Bullet> const& bullets,
                               ecs::SparseArray<cpnt::BulletShooter> const& bullets_shooter);
 
-void player_control_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
-                           ecs::SparseArray<cpnt::Player> const& players, ecs::SparseArray<cpnt::Sprite> const& sprites,
-                           ecs::SparseArray<cpnt::Velocity> const& velocities,
+void player_control_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform>& positions,
+                           ecs::SparseArray<cpnt::Player> const& players, ecs::SparseArray<cpnt::Sprite>& sprites,
+                           ecs::SparseArray<cpnt::Velocity>& velocities,
                            ecs::SparseArray<cpnt::Health> const& healths);
 
 void render_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
                    ecs::SparseArray<cpnt::Sprite> const& sprites, ecs::SparseArray<cpnt::Star> const& stars,
-                   ecs::SparseArray<cpnt::Velocity> const& velocities, ecs::SparseArray<cpnt::Particle> const& particles,
+                   ecs::SparseArray<cpnt::Velocity> const& velocities, ecs::SparseArray<cpnt::Particle>& particles,
                    ecs::SparseArray<cpnt::Stats> const& stats, ecs::SparseArray<cpnt::Boss> const& bosses);
 
 void boss_system(EngineContext& ctx, ecs::SparseArray<cpnt::Boss> const& boss, ecs::SparseArray<cpnt::Transform> const& positions,
@@ -82,7 +81,7 @@ void boss_system(EngineContext& ctx, ecs::SparseArray<cpnt::Boss> const& boss, e
                      ecs::SparseArray<cpnt::BulletShooter> const& bullets_shooter, ecs::SparseArray<cpnt::Bullet> const& bullets, 
                      ecs::SparseArray<cpnt::Health> const& healths);
 
-void star_scroll_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
+void star_scroll_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform>& positions,
                         ecs::SparseArray<cpnt::Star> const& stars);
 
 
@@ -18,9 +18,9 @@ constexpr float k_half = 2.0f;
 
 void sys::ui_text_renderer(EngineContext& ctx, const ecs::SparseArray<cpnt::UITransform>& transforms,
                            const ecs::SparseArray<cpnt::UIText>& texts, const ecs::SparseArray<cpnt::UIStyle>& styles,
-                           const ecs::SparseArray<cpnt::UIInteractable>& interactables) {
+                           const ecs::SparseArray<cpnt::UIInteractable>& interactables,
+                           const ecs::SparseArray<cpnt::UIInputField>& input_fields) {
     const ecs::Registry& reg = ctx.registry;
-    const auto& input_fields = ctx.registry.get_components<cpnt::UIInputField>();
     const float k_width = ctx.window_size.x;  // NOLINT(cppcoreguidelines-pro-type-union-access)
     const float k_height = ctx.window_size.y; // NOLINT(cppcoreguidelines-pro-type-union-access)
 
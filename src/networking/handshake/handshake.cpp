@@ -8,6 +8,7 @@ constexpr std::uint8_t k_byte_mask = 0xFFU;
 constexpr std::uint8_t k_shift8 = 8U;
 constexpr std::uint8_t k_shift16 = 16U;
 constexpr std::uint8_t k_shift24 = 24U;
+constexpr std::uint8_t k_crc16_only = checksum::algorithm_bit(checksum::Algorithm::KCrc16Ccitt);
 
 void append_u32_le(std::vector<std::byte>& out, std::uint32_t value) {
     out.push_back(net::to_byte(value & k_byte_mask));
@@ -46,12 +47,15 @@ Packet make_req_login(const ReqLogin& req) {
             ? static_cast<std::uint16_t>(k_max_payload_size)
             : req.m_preferred_fragment_size;
 
-    packet.payload.reserve(1 + k_name_len + sizeof(req.m_version) + sizeof(k_pref));
+    packet.payload.reserve(1 + k_name_len + sizeof(req.m_version) + sizeof(k_pref) + sizeof(req.m_checksums));
     packet.payload.push_back(static_cast<std::byte>(k_name_len));
     std::ranges::transform(trimmed, std::back_inserter(packet.payload),
                            [](char c) { return static_cast<std::byte>(static_cast<unsigned char>(c)); });
     append_u32_le(packet.payload, req.m_version);
     append_u16_le(packet.payload, k_pref);
+    if (req.m_checksums != k_crc16_only) {
+        packet.payload.push_back(static_cast<std::byte>(req.m_checksums));
+    }
     return packet;
 }
 
@@ -65,10 +69,15 @@ Packet make_res_login(const ResLogin& res) {
             ? static_cast<std::uint16_t>(k_max_payload_size)
             : res.m_effective_fragment_size;
 
-    packet.payload.reserve(1 + sizeof(res.m_player_id) + sizeof(k_effective));
+    packet.payload.reserve(1 + sizeof(res.m_player_id) + sizeof(k_effective) + sizeof(res.m_version) +
+                           sizeof(res.m_checksum));
     packet.payload.push_back(static_cast<std::byte>(res.m_success ? 1 : 0));
     append_u32_le(packet.payload, res.m_player_id);
     append_u16_le(packet.payload, k_effective);
+    append_u32_le(packet.payload, res.m_version);
+    if (res.m_checksum != checksum::Algorithm::KCrc16Ccitt) {
+        packet.payload.push_back(static_cast<std::byte>(res.m_checksum));
+    }
     return packet;
 }
 
@@ -96,6 +105,11 @@ std::optional<ReqLogin> parse_req_login(const Packet& packet) {
     const std::size_t k_pref_offset = k_version_offset + sizeof(std::uint32_t);
     result.m_version = read_u32_le(buf, k_version_offset);
     result.m_preferred_fragment_size = read_u16_le(buf, k_pref_offset);
+    // Optional trailing byte: a client offering only CRC-16 leaves it out
+    const std::size_t k_checksums_offset = k_pref_offset + sizeof(std::uint16_t);
+    if (buf.size() > k_checksums_offset) {
+        result.m_checksums = static_cast<std::uint8_t>(buf[k_checksums_offset]) | k_crc16_only;
+    }
     return result;
 }
 
@@ -112,6 +126,19 @@ std::optional<ResLogin> parse_res_login(const Packet& packet) {
     result.m_success = static_cast<std::uint8_t>(buf[0]) != 0;
     result.m_player_id = read_u32_le(buf, 1);
     result.m_effective_fragment_size = read_u16_le(buf, 1 + sizeof(std::uint32_t));
+    // v1 replies end at the fragment size: report them as such so the client refuses them
+    const std::size_t k_version_offset = 1 + sizeof(std::uint32_t) + sizeof(std::uint16_t);
+    if (buf.size() < k_version_offset + sizeof(std::uint32_t)) {
+        result.m_version = 1;
+        return result;
+    }
+    result.m_version = read_u32_le(buf, k_version_offset);
+    // Optional trailing byte: absent means CRC-16, and unknown algorithms are treated the same way
+    const std::size_t k_checksum_offset = k_version_offset + sizeof(std::uint32_t);
+    if (buf.size() > k_checksum_offset &&
+        static_cast<std::uint8_t>(buf[k_checksum_offset]) == static_cast<std::uint8_t>(checksum::Algorithm::KCrc32c)) {
+        result.m_checksum = checksum::Algorithm::KCrc32c;
+    }
     return result;
 }
 
@@ -145,6 +172,11 @@ bool handle_server_handshake(const Packet& packet, const std::shared_ptr<Session
     if (!k_req.has_value()) {
         return false;
     }
+    if (k_req->m_version != k_protocol_version) {
+        // Snapshots would be misread on both ends: refuse before touching the session settings
+        session->send(make_res_login(ResLogin{.m_success = false}), endpoint, true);
+        return true;
+    }
 
     const std::uint16_t k_requested = k_req->m_preferred_fragment_size;
     const std::uint16_t k_effective =
@@ -152,10 +184,37 @@ bool handle_server_handshake(const Packet& packet, const std::shared_ptr<Session
                            : static_cast<std::uint16_t>(std::min<std::size_t>(k_requested, k_max_payload_size));
 
     session->set_fragment_payload_size(k_effective);
-    ResLogin resp_payload{.m_success = true, .m_player_id = 0, .m_effective_fragment_size = k_effective};
+    const checksum::Algorithm k_checksum = checksum::negotiate(k_req->m_checksums);
+    ResLogin resp_payload{.m_success = true,
+                          .m_player_id = 0,
+                          .m_effective_fragment_size = k_effective,
+                          .m_checksum = k_checksum};
     Packet resp = make_res_login(resp_payload);
+    // The reply itself still uses CRC-16: the client only switches once it has parsed it
     session->send(resp, endpoint, true);
+    session->set_checksum(endpoint, k_checksum);
     return true;
 }
 
+std::optional<ResLogin> handle_client_handshake(const Packet& packet, const std::shared_ptr<Session>& session,
+                                                const asio::ip::udp::endpoint& server) {
+    auto res = parse_res_login(packet);
+    if (!res.has_value()) {
+        return std::nullopt;
+    }
+    if (res->m_version != k_protocol_version) {
+        // Snapshots would be misread: keep the session settings and report a failed login
+        res->m_success = false;
+        return res;
+    }
+    if (res->m_success) {
+        if (res->m_effective_fragment_size > 0) {
+            session->set_fragment_payload_size(res->m_effective_fragment_size);
+        }
+        // Use the checksum the server picked (CRC-16 unless both ends offer more)
+        session->set_checksum(server, res->m_checksum);
+    }
+    return res;
+}
+
 } // namespace net::handshake
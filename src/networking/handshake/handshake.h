@@ -6,29 +6,38 @@
 #include <string>
 
 namespace net::handshake {
-constexpr std::uint32_t k_protocol_version = 1;
+// v2: entity deltas and Replicated carry the entity generation, RES_LOGIN carries the server version
+constexpr std::uint32_t k_protocol_version = 2;
 constexpr std::size_t k_max_username_len = 32;
 
 struct ReqLogin {
     std::string m_username;
     std::uint32_t m_version = k_protocol_version;
     std::uint16_t m_preferred_fragment_size = static_cast<std::uint16_t>(k_max_payload_size);
+    // Checksums the client can compute (checksum::algorithm_bit mask), sent only beyond CRC-16
+    std::uint8_t m_checksums = checksum::algorithm_bit(checksum::Algorithm::KCrc16Ccitt);
 };
 
 struct ResLogin {
     bool m_success = false;
     std::uint32_t m_player_id = 0;
     std::uint16_t m_effective_fragment_size = static_cast<std::uint16_t>(k_max_payload_size);
+    // Protocol version of the server; replies without one come from a server older than v2
+    std::uint32_t m_version = k_protocol_version;
+    // Checksum both sides use from now on, sent only when it is not CRC-16
+    checksum::Algorithm m_checksum = checksum::Algorithm::KCrc16Ccitt;
 };
 
 struct ReqLogout {
     std::uint32_t m_player_id = 0;
 };
 
-// Build a REQ_LOGIN packet containing username, protocol version and preferred fragment size.
+// Build a REQ_LOGIN packet containing username, protocol version and preferred fragment size,
+// followed by the checksum mask when it offers more than CRC-16.
 Packet make_req_login(const ReqLogin& req);
 
-// Build a RES_LOGIN packet containing success, player id and the negotiated fragment size.
+// Build a RES_LOGIN packet containing success, player id, the negotiated fragment size and the
+// server protocol version, followed by the negotiated checksum when it is not CRC-16.
 Packet make_res_login(const ResLogin& res);
 
 // Build a REQ_LOGOUT packet to notify server of disconnect
@@ -45,8 +54,17 @@ std::optional<ReqLogout> parse_req_logout(const Packet& packet);
 
 // Server-side convenience handler: if `packet` is a REQ_LOGIN this function
 // will send a RES_LOGIN reply (currently accepts any username) and return true.
+// A client speaking another protocol version is refused with an unsuccessful reply.
+// The negotiated checksum is applied to the endpoint once the reply is sent.
 // The caller should invoke this from the reliable packet callback.
 bool handle_server_handshake(const Packet& packet, const std::shared_ptr<Session>& session,
                              const asio::ip::udp::endpoint& endpoint);
 
+// Client-side counterpart: if `packet` is a RES_LOGIN this function returns it, after applying
+// the negotiated fragment size and checksum to the session on success.
+// A server speaking another protocol version is refused: the reply is returned as unsuccessful.
+// The caller should invoke this from the reliable packet callback.
+std::optional<ResLogin> handle_client_handshake(const Packet& packet, const std::shared_ptr<Session>& session,
+                                                const asio::ip::udp::endpoint& server);
+
 } // namespace net::handshake
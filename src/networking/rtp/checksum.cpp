@@ -0,0 +1,206 @@
+#include "checksum.h"
+
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define NET_CRC_X86 1
+    #include <nmmintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define NET_TARGET_SSE42
+    #else
+        #define NET_TARGET_SSE42 __attribute__((target("sse4.2")))
+    #endif
+#endif
+
+namespace net::checksum {
+namespace {
+constexpr std::size_t k_table_size = 256;
+constexpr std::size_t k_slices = 8;
+constexpr std::uint32_t k_byte_mask = 0xFFU;
+constexpr std::uint32_t k_shift8 = 8U;
+constexpr std::uint32_t k_shift24 = 24U;
+constexpr std::size_t k_bits_per_byte = 8;
+constexpr std::uint16_t k_crc16_poly = 0x1021U;
+constexpr std::uint16_t k_crc16_high_bit = 0x8000U;
+constexpr std::uint32_t k_crc32c_poly = 0x82F63B78U;
+
+using Crc16Tables = std::array<std::array<std::uint16_t, k_table_size>, k_slices>;
+using Crc32cTables = std::array<std::array<std::uint32_t, k_table_size>, k_slices>;
+
+// tables[0][b] is the CRC of byte b, tables[k][b] the CRC of byte b followed by k zero bytes.
+constexpr Crc16Tables make_crc16_tables() noexcept {
+    Crc16Tables tables{};
+    for (std::size_t byte = 0; byte < k_table_size; ++byte) {
+        auto crc = static_cast<std::uint16_t>(byte << k_shift8);
+        for (std::size_t bit = 0; bit < k_bits_per_byte; ++bit) {
+            crc = static_cast<std::uint16_t>((crc & k_crc16_high_bit) != 0U ? (crc << 1U) ^ k_crc16_poly : crc << 1U);
+        }
+        tables[0][byte] = crc;
+    }
+    for (std::size_t slice = 1; slice < k_slices; ++slice) {
+        for (std::size_t byte = 0; byte < k_table_size; ++byte) {
+            const std::uint16_t k_previous = tables[slice - 1][byte];
+            tables[slice][byte] =
+                static_cast<std::uint16_t>((k_previous << k_shift8) ^ tables[0][k_previous >> k_shift8]);
+        }
+    }
+    return tables;
+}
+
+// Reflected counterpart: zero bytes shift the register to the right.
+constexpr Crc32cTables make_crc32c_tables() noexcept {
+    Crc32cTables tables{};
+    for (std::size_t byte = 0; byte < k_table_size; ++byte) {
+        auto crc = static_cast<std::uint32_t>(byte);
+        for (std::size_t bit = 0; bit < k_bits_per_byte; ++bit) {
+            crc = (crc & 1U) != 0U ? (crc >> 1U) ^ k_crc32c_poly : crc >> 1U;
+        }
+        tables[0][byte] = crc;
+    }
+    for (std::size_t slice = 1; slice < k_slices; ++slice) {
+        for (std::size_t byte = 0; byte < k_table_size; ++byte) {
+            const std::uint32_t k_previous = tables[slice - 1][byte];
+            tables[slice][byte] = (k_previous >> k_shift8) ^ tables[0][k_previous & k_byte_mask];
+        }
+    }
+    return tables;
+}
+
+constexpr Crc16Tables k_crc16_tables = make_crc16_tables();
+constexpr Crc32cTables k_crc32c_tables = make_crc32c_tables();
+
+std::uint32_t load_u32_le(const std::uint8_t* bytes) noexcept {
+    return static_cast<std::uint32_t>(bytes[0]) | (static_cast<std::uint32_t>(bytes[1]) << k_shift8) |
+           (static_cast<std::uint32_t>(bytes[2]) << k_shift16) | (static_cast<std::uint32_t>(bytes[3]) << k_shift24);
+}
+
+#ifdef NET_CRC_X86
+NET_TARGET_SSE42 std::uint32_t crc32c_sse42(std::span<const std::uint8_t> data, std::uint32_t crc) noexcept {
+    const std::uint8_t* bytes = data.data();
+    std::size_t size = data.size();
+    #if defined(__x86_64__) || defined(_M_X64)
+    std::uint64_t wide = crc;
+    for (; size >= sizeof(std::uint64_t); size -= sizeof(std::uint64_t), bytes += sizeof(std::uint64_t)) {
+        std::uint64_t word = 0;
+        std::memcpy(&word, bytes, sizeof(word));
+        wide = _mm_crc32_u64(wide, word);
+    }
+    crc = static_cast<std::uint32_t>(wide);
+    #endif
+    for (; size >= sizeof(std::uint32_t); size -= sizeof(std::uint32_t), bytes += sizeof(std::uint32_t)) {
+        std::uint32_t word = 0;
+        std::memcpy(&word, bytes, sizeof(word));
+        crc = _mm_crc32_u32(crc, word);
+    }
+    for (; size > 0; --size, ++bytes) {
+        crc = _mm_crc32_u8(crc, *bytes);
+    }
+    return crc;
+}
+#endif
+
+bool cpu_has_sse42() noexcept {
+#if !defined(NET_CRC_X86)
+    return false;
+#elif defined(_MSC_VER) && !defined(__clang__)
+    constexpr int k_sse42_bit = 1 << 20;
+    std::array<int, 4> info{};
+    __cpuid(info.data(), 1);
+    return (info[2] & k_sse42_bit) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse4.2") != 0;
+#endif
+}
+} // namespace
+
+std::uint16_t crc16_bitwise(std::span<const std::uint8_t> data, std::uint16_t crc) noexcept {
+    for (std::uint8_t byte : data) {
+        crc ^= static_cast<std::uint16_t>(byte << k_shift8);
+        for (std::size_t i = 0; i < k_bits_per_byte; ++i) {
+            crc = static_cast<std::uint16_t>((crc & k_crc16_high_bit) != 0U ? (crc << 1U) ^ k_crc16_poly : crc << 1U);
+        }
+    }
+    return crc;
+}
+
+std::uint16_t crc16_table(std::span<const std::uint8_t> data, std::uint16_t crc) noexcept {
+    for (std::uint8_t byte : data) {
+        const std::uint32_t k_index = ((crc >> k_shift8) ^ byte) & k_byte_mask;
+        crc = static_cast<std::uint16_t>((crc << k_shift8) ^ k_crc16_tables[0][k_index]);
+    }
+    return crc;
+}
+
+// The register is folded into the first two bytes of each block of eight, then every byte
+// of the block goes through the table accounting for the bytes that follow it.
+std::uint16_t crc16_slice8(std::span<const std::uint8_t> data, std::uint16_t crc) noexcept {
+    const auto& t = k_crc16_tables;
+    std::size_t offset = 0;
+    for (; data.size() - offset >= k_slices; offset += k_slices) {
+        const std::uint8_t* b = data.data() + offset;
+        crc = static_cast<std::uint16_t>(
+            t[7][b[0] ^ (crc >> k_shift8)] ^ t[6][b[1] ^ (crc & k_byte_mask)] ^ t[5][b[2]] ^ t[4][b[3]] ^ t[3][b[4]] ^
+            t[2][b[5]] ^ t[1][b[6]] ^ t[0][b[7]]);
+    }
+    return crc16_table(data.subspan(offset), crc);
+}
+
+std::uint32_t crc32c_update_software(std::span<const std::uint8_t> data, std::uint32_t crc) noexcept {
+    const auto& t = k_crc32c_tables;
+    std::size_t offset = 0;
+    for (; data.size() - offset >= k_slices; offset += k_slices) {
+        const std::uint8_t* b = data.data() + offset;
+        const std::uint32_t k_low = crc ^ load_u32_le(b);
+        const std::uint32_t k_high = load_u32_le(b + sizeof(std::uint32_t));
+        crc = t[7][k_low & k_byte_mask] ^ t[6][(k_low >> k_shift8) & k_byte_mask] ^
+              t[5][(k_low >> k_shift16) & k_byte_mask] ^ t[4][k_low >> k_shift24] ^ t[3][k_high & k_byte_mask] ^
+              t[2][(k_high >> k_shift8) & k_byte_mask] ^ t[1][(k_high >> k_shift16) & k_byte_mask] ^
+              t[0][k_high >> k_shift24];
+    }
+    for (std::uint8_t byte : data.subspan(offset)) {
+        crc = (crc >> k_shift8) ^ t[0][(crc ^ byte) & k_byte_mask];
+    }
+    return crc;
+}
+
+std::uint32_t crc32c_update_hardware(std::span<const std::uint8_t> data, std::uint32_t crc) noexcept {
+#ifdef NET_CRC_X86
+    return crc32c_sse42(data, crc);
+#else
+    return crc32c_update_software(data, crc);
+#endif
+}
+
+std::uint32_t crc32c_update(std::span<const std::uint8_t> data, std::uint32_t crc) noexcept {
+    return has_hardware_crc32c() ? crc32c_update_hardware(data, crc) : crc32c_update_software(data, crc);
+}
+
+bool has_hardware_crc32c() noexcept {
+    static const bool k_supported = cpu_has_sse42();
+    return k_supported;
+}
+
+std::uint8_t supported_algorithms() noexcept {
+    std::uint8_t algorithms = algorithm_bit(Algorithm::KCrc16Ccitt);
+    if (has_hardware_crc32c()) {
+        algorithms |= algorithm_bit(Algorithm::KCrc32c);
+    }
+    return algorithms;
+}
+
+Algorithm negotiate(std::uint8_t peerAlgorithms) noexcept {
+    const std::uint8_t k_common = peerAlgorithms & supported_algorithms();
+    return (k_common & algorithm_bit(Algorithm::KCrc32c)) != 0U ? Algorithm::KCrc32c : Algorithm::KCrc16Ccitt;
+}
+
+std::string_view algorithm_name(Algorithm algorithm) noexcept {
+    switch (algorithm) {
+        case Algorithm::KCrc16Ccitt: return "crc16-ccitt";
+        case Algorithm::KCrc32c: return "crc32c";
+    }
+    return "unknown";
+}
+} // namespace net::checksum
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace net::checksum {
+// Checksums a packet can carry in its 16-bit checksum field.
+enum class Algorithm : std::uint8_t {
+    KCrc16Ccitt = 0, // Protocol version 1, always supported
+    KCrc32c = 1      // CRC-32C folded to 16 bits, only sent to peers that negotiated it
+};
+
+constexpr std::uint16_t k_crc16_init = 0xFFFFU;
+constexpr std::uint32_t k_crc32c_init = 0xFFFFFFFFU;
+constexpr std::uint32_t k_shift16 = 16U;
+constexpr std::uint32_t k_low16_mask = 0xFFFFU;
+
+// Bit of an algorithm in the capability mask exchanged by the handshake.
+constexpr std::uint8_t algorithm_bit(Algorithm algorithm) noexcept {
+    return static_cast<std::uint8_t>(1U << static_cast<std::uint8_t>(algorithm));
+}
+
+// Folds a finished CRC-32C into the 16-bit checksum field.
+constexpr std::uint16_t fold(std::uint32_t crc) noexcept {
+    return static_cast<std::uint16_t>((crc ^ (crc >> k_shift16)) & k_low16_mask);
+}
+
+// CRC-16-CCITT (polynomial 0x1021, MSB first, no final xor), continuing the running `crc`.
+// All three give the same result: bitwise is the reference, slice-by-8 the fastest.
+std::uint16_t crc16_bitwise(std::span<const std::uint8_t> data, std::uint16_t crc = k_crc16_init) noexcept;
+std::uint16_t crc16_table(std::span<const std::uint8_t> data, std::uint16_t crc = k_crc16_init) noexcept;
+std::uint16_t crc16_slice8(std::span<const std::uint8_t> data, std::uint16_t crc = k_crc16_init) noexcept;
+
+// CRC-32C (Castagnoli, reflected polynomial 0x82F63B78) register update: start from k_crc32c_init,
+// and invert the register once the data is fed to finish the CRC.
+std::uint32_t crc32c_update_software(std::span<const std::uint8_t> data, std::uint32_t crc) noexcept;
+// SSE4.2 crc32 instruction, must only be called when has_hardware_crc32c() is true.
+std::uint32_t crc32c_update_hardware(std::span<const std::uint8_t> data, std::uint32_t crc) noexcept;
+// Hardware update when the CPU supports it, slice-by-8 otherwise.
+std::uint32_t crc32c_update(std::span<const std::uint8_t> data, std::uint32_t crc) noexcept;
+
+// True when the running CPU computes CRC-32C in hardware, checked once.
+bool has_hardware_crc32c() noexcept;
+
+// Capability mask this host offers in the handshake: CRC-32C only when the CPU computes it.
+std::uint8_t supported_algorithms() noexcept;
+
+// Algorithm used with a peer offering `peerAlgorithms`: CRC-32C when both sides compute it in hardware.
+Algorithm negotiate(std::uint8_t peerAlgorithms) noexcept;
+
+std::string_view algorithm_name(Algorithm algorithm) noexcept;
+} // namespace net::checksum
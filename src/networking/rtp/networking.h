@@ -1,18 +1,23 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <deque>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <span>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "asio.hpp"
+#include "checksum.h"
 
 namespace net {
 constexpr std::uint16_t k_magic_number = 0xD1CE; // Magic number defined in the RFC
@@ -29,6 +34,13 @@ constexpr std::chrono::milliseconds k_default_max_rto{2000};
 constexpr std::size_t k_default_window_size = 256;
 constexpr std::uint32_t k_byte_mask = 0xFFU;
 constexpr std::chrono::seconds k_client_timeout{30}; // Disconnect clients after 30 seconds of inactivity
+constexpr std::size_t k_default_receive_batch = 32; // Datagrams drained per recvmmsg
+constexpr std::size_t k_default_send_batch = 64;    // Datagrams flushed per sendmmsg
+#ifdef __linux__
+constexpr bool k_batched_io_supported = true;
+#else
+constexpr bool k_batched_io_supported = false;
+#endif
 
 // Command identifiers for different packet types.
 // TODO: Add commands for the game
@@ -58,7 +70,14 @@ enum class CommandId : std::uint8_t {
 };
 
 // Flags used in the packet header to indicate special properties.
-enum class PacketFlag : std::uint8_t { KReliable = 0x01, KFragment = 0x02, KAck = 0x04, KError = 0x08 };
+// KCrc32c marks a checksum field holding a folded CRC-32C instead of the protocol v1 CRC-16-CCITT.
+enum class PacketFlag : std::uint8_t {
+    KReliable = 0x01,
+    KFragment = 0x02,
+    KAck = 0x04,
+    KError = 0x08,
+    KCrc32c = 0x10
+};
 
 // Bitwise OR operator use for combining flags.
 constexpr PacketFlag operator|(PacketFlag lhs, PacketFlag rhs) {
@@ -103,7 +122,15 @@ constexpr std::uint8_t byte_to_u8(std::byte b) noexcept {
 // Hash specialization for asio::ip::udp::endpoint to use in unordered containers
 struct EndpointHash {
     std::size_t operator()(const asio::ip::udp::endpoint& ep) const noexcept {
-        std::size_t h1 = std::hash<std::string>{}(ep.address().to_string());
+        // Hashes the raw address bytes: formatting the address would allocate on every lookup
+        std::size_t h1 = 0;
+        if (ep.address().is_v4()) {
+            h1 = std::hash<std::uint32_t>{}(ep.address().to_v4().to_uint());
+        } else {
+            const auto k_bytes = ep.address().to_v6().to_bytes();
+            h1 = std::hash<std::string_view>{}(
+                std::string_view(reinterpret_cast<const char*>(k_bytes.data()), k_bytes.size()));
+        }
         std::size_t h2 = std::hash<unsigned short>{}(ep.port());
         return h1 ^ (h2 << 1);
     }
@@ -126,6 +153,10 @@ struct PacketHeader {
      * Serializes the header into a packed little-endian byte array.
      */
     [[nodiscard]] std::array<std::uint8_t, k_header_size> serialize() const;
+    /**
+     * Serializes the header in place, into the first bytes of a packet buffer.
+     */
+    void encode(std::span<std::uint8_t, k_header_size> target) const noexcept;
     /**
      * Rebuilds a header from a serialized fixed-size buffer.
      */
@@ -141,10 +172,137 @@ struct Packet {
      * Serializes a packet into a contiguous buffer while computing its checksum.
      */
     [[nodiscard]] std::vector<std::uint8_t> to_buffer() const;
+    /**
+     * Serializes a packet in place, checksum included, and returns the number of bytes written.
+     * The target must hold at least k_header_size + payload.size() bytes.
+     */
+    std::size_t encode(std::span<std::uint8_t> target) const;
     /**
      * Parses a packet from a contiguous buffer, validating size and checksum.
      */
     static Packet from_buffer(std::span<const std::uint8_t> buffer);
+    /**
+     * Parses a packet into an existing one, reusing the capacity of its payload.
+     */
+    static void decode(std::span<const std::uint8_t> buffer, Packet& packet);
+};
+
+// Pool of fixed-size buffers, each large enough for one serialized packet.
+// Free slabs are kept in a lock-free list, so any thread may acquire and release them;
+// the pool only allocates when every slab is in use, one chunk of slabs at a time.
+class PacketBufferPool {
+  public:
+    static constexpr std::size_t k_slab_size = k_max_packet_size;
+    static constexpr std::size_t k_slabs_per_chunk = 64;
+    static constexpr std::size_t k_max_chunks = 256; // 16384 slabs, 16 MiB
+
+    // Slab borrowed from the pool, given back on destruction. Must not outlive its pool.
+    class Buffer {
+      public:
+        Buffer() = default;
+        ~Buffer();
+
+        Buffer(const Buffer&) = delete;
+        Buffer& operator=(const Buffer&) = delete;
+        Buffer(Buffer&& other) noexcept;
+        Buffer& operator=(Buffer&& other) noexcept;
+
+        // Returns the whole slab.
+        [[nodiscard]] std::span<std::uint8_t, k_slab_size> data() const noexcept;
+        // Returns the bytes in use.
+        [[nodiscard]] std::span<const std::uint8_t> bytes() const noexcept;
+        [[nodiscard]] std::size_t size() const noexcept;
+        // Sets the number of bytes in use, bounded by k_slab_size.
+        void resize(std::size_t size);
+        [[nodiscard]] explicit operator bool() const noexcept;
+
+      private:
+        friend class PacketBufferPool;
+        Buffer(PacketBufferPool* pool, std::uint32_t index, std::uint8_t* slab) noexcept;
+
+        PacketBufferPool* m_pool = nullptr;
+        std::uint32_t m_index = 0;
+        std::uint8_t* m_slab = nullptr;
+        std::size_t m_size = 0;
+    };
+
+    /**
+     * Builds a pool holding at least the requested number of slabs.
+     */
+    explicit PacketBufferPool(std::size_t initialSlabs = k_slabs_per_chunk);
+
+    PacketBufferPool(const PacketBufferPool&) = delete;
+    PacketBufferPool& operator=(const PacketBufferPool&) = delete;
+    PacketBufferPool(PacketBufferPool&&) = delete;
+    PacketBufferPool& operator=(PacketBufferPool&&) = delete;
+
+    /**
+     * Borrows a free slab, growing the pool when none is left.
+     * Throws std::runtime_error once k_max_chunks chunks are in use.
+     */
+    [[nodiscard]] Buffer acquire();
+    /**
+     * Returns the number of slabs allocated so far.
+     */
+    [[nodiscard]] std::size_t capacity() const noexcept;
+    /**
+     * Raw memory for small objects, such as the state of an asynchronous operation (see SlabAllocator).
+     * Blocks that do not fit in a slab come from the heap.
+     */
+    [[nodiscard]] void* allocate(std::size_t size, std::size_t alignment);
+    void deallocate(void* block, std::size_t size, std::size_t alignment) noexcept;
+
+  private:
+    struct Chunk {
+        std::array<std::array<std::uint8_t, k_slab_size>, k_slabs_per_chunk> m_slabs;
+        // Free list links: index + 1 of the next free slab, 0 at the end of the list
+        std::array<std::atomic<std::uint32_t>, k_slabs_per_chunk> m_next;
+    };
+
+    // Raw blocks start after the index of their slab, padded to keep the block aligned
+    static constexpr std::size_t k_block_offset = alignof(std::max_align_t);
+
+    [[nodiscard]] std::uint32_t pop_or_grow();
+    void grow();
+    // Requires m_grow_mutex
+    void add_chunk();
+    void release(std::uint32_t index) noexcept;
+    [[nodiscard]] std::optional<std::uint32_t> pop() noexcept;
+    [[nodiscard]] std::atomic<std::uint32_t>& next(std::uint32_t index) const noexcept;
+    [[nodiscard]] std::uint8_t* slab(std::uint32_t index) const noexcept;
+
+    // Chunks are published before their slabs enter the free list, and never removed
+    std::array<std::unique_ptr<Chunk>, k_max_chunks> m_chunks{};
+    std::atomic<std::size_t> m_chunk_count{0};
+    // Head of the free list: ABA tag in the high half, index + 1 of the first free slab in the low half
+    std::atomic<std::uint64_t> m_free_head{0};
+    std::mutex m_grow_mutex;
+};
+
+// Allocator drawing from a PacketBufferPool, to associate with asynchronous handlers: once the pool
+// is warm, the operations in flight on a socket allocate nothing. The pool must outlive the allocator.
+template <typename T> class SlabAllocator {
+  public:
+    using value_type = T;
+
+    explicit SlabAllocator(PacketBufferPool& pool) noexcept : m_pool(&pool) {}
+    template <typename U> SlabAllocator(const SlabAllocator<U>& other) noexcept : m_pool(other.m_pool) {}
+
+    T* allocate(std::size_t count) {
+        return static_cast<T*>(m_pool->allocate(count * sizeof(T), alignof(T)));
+    }
+    void deallocate(T* block, std::size_t count) noexcept {
+        m_pool->deallocate(block, count * sizeof(T), alignof(T));
+    }
+
+    template <typename U> bool operator==(const SlabAllocator<U>& other) const noexcept {
+        return m_pool == other.m_pool;
+    }
+
+  private:
+    template <typename U> friend class SlabAllocator;
+
+    PacketBufferPool* m_pool;
 };
 
 // Configuration parameters for reliability mechanisms.
@@ -157,6 +315,23 @@ struct ReliabilityConfig {
     std::size_t window_size = k_default_window_size;
 };
 
+// Configuration of the batched datagram I/O (recvmmsg/sendmmsg), ignored where unsupported.
+// Batched sends are queued until the transport flushes them: right after the current handler
+// by default, or at the end of the tick when the sender corks the transport.
+struct DatagramBatchConfig {
+    bool enabled = false;
+    std::size_t receive_batch = k_default_receive_batch;
+    std::size_t send_batch = k_default_send_batch;
+};
+
+// Counters of a transport, for the benchmarks and diagnostics.
+struct TransportStats {
+    std::uint64_t send_syscalls = 0;
+    std::uint64_t receive_syscalls = 0;
+    std::uint64_t packets_sent = 0;
+    std::uint64_t packets_received = 0;
+};
+
 // Status of a reliable message delivery.
 enum class DeliveryStatus {
     Pending,      // Message is in queue and within RTO
@@ -235,13 +410,17 @@ class ReliableReceiveWindow {
 // Low level UDP transport abstraction.
 class UdpTransport : public std::enable_shared_from_this<UdpTransport> {
   public:
-    using PacketHandler = std::function<void(const asio::error_code&, Packet, const asio::ip::udp::endpoint&)>;
+    // The packet is reused by the transport for the next datagram: copy it to keep it.
+    using PacketHandler = std::function<void(const asio::error_code&, const Packet&, const asio::ip::udp::endpoint&)>;
     using SendHandler = std::function<void(const asio::error_code&, const Packet&)>;
 
     /**
-     * Constructs a UDP transport bound to the specified local port.
+     * Constructs a UDP transport bound to the specified local port, batching its I/O when requested.
      */
-    explicit UdpTransport(asio::io_context& context, std::uint16_t localPort = 0);
+    explicit UdpTransport(asio::io_context& context, std::uint16_t localPort = 0, DatagramBatchConfig batching = {});
+    ~UdpTransport();
+    UdpTransport(const UdpTransport&) = delete;
+    UdpTransport& operator=(const UdpTransport&) = delete;
 
     /**
      * Stores the default remote endpoint used when no explicit destination is provided.
@@ -264,9 +443,19 @@ class UdpTransport : public std::enable_shared_from_this<UdpTransport> {
      */
     void async_send(const Packet& packet);
     /**
-     * Sends a packet to the specified endpoint.
+     * Sends a packet to the specified endpoint. The packet is serialized into a pooled buffer;
+     * it is only copied when a handler needs it back.
      */
     void async_send(const Packet& packet, const asio::ip::udp::endpoint& endpoint, SendHandler handler = {});
+    /**
+     * Holds the batched sends until flush(), so that a tick goes out in as few syscalls as possible.
+     * A full batch is still flushed. No-op when batching is disabled.
+     */
+    void cork();
+    /**
+     * Releases a cork and flushes the queued sends from the transport's executor. Thread-safe.
+     */
+    void flush();
     /**
      * Closes the underlying socket and stops the receive loop.
      */
@@ -276,16 +465,37 @@ class UdpTransport : public std::enable_shared_from_this<UdpTransport> {
      * Returns the local endpoint the socket is bound to.
      */
     [[nodiscard]] asio::ip::udp::endpoint local_endpoint() const;
+    /**
+     * Returns true when the datagrams go through recvmmsg/sendmmsg.
+     */
+    [[nodiscard]] bool batching() const noexcept;
+    [[nodiscard]] TransportStats stats() const noexcept;
 
   private:
+    // Batched I/O state, defined with the platform code
+    struct BatchState;
+
     void do_receive();
+    void do_receive_batch();
+    void drain_receive_batch();
+    // Requires the batch mutex
+    void schedule_flush();
+    void flush_batch();
 
     asio::ip::udp::socket m_socket;
     std::optional<asio::ip::udp::endpoint> m_default_remote{};
     asio::ip::udp::endpoint m_sender{};
-    std::array<std::uint8_t, k_max_packet_size> m_buffer{};
+    // Declared before the buffers borrowed from it
+    PacketBufferPool m_pool{};
+    PacketBufferPool::Buffer m_receive_buffer{};
+    std::unique_ptr<BatchState> m_batch;
+    Packet m_received{};
     PacketHandler m_handler{};
     bool m_running = false;
+    std::atomic<std::uint64_t> m_send_syscalls{0};
+    std::atomic<std::uint64_t> m_receive_syscalls{0};
+    std::atomic<std::uint64_t> m_packets_sent{0};
+    std::atomic<std::uint64_t> m_packets_received{0};
 };
 
 // High-level session that manages reliable and unreliable packet sending/receiving.
@@ -298,7 +508,7 @@ class Session : public std::enable_shared_from_this<Session> {
      * Constructs a session with its own transport instance and reliability bookkeeping.
      */
     Session(asio::io_context& context, const asio::ip::udp::endpoint& remote, ReliabilityConfig config = {},
-            std::uint16_t localPort = 0);
+            std::uint16_t localPort = 0, DatagramBatchConfig batching = {});
 
     /**
      * Starts the session by registering callbacks and enabling retransmission timers.
@@ -323,6 +533,17 @@ class Session : public std::enable_shared_from_this<Session> {
      */
     void set_fragment_payload_size(std::size_t fragmentPayloadSize);
     [[nodiscard]] std::size_t fragment_payload_size() const noexcept;
+    /**
+     * Selects the checksum of the packets sent to an endpoint, as negotiated by the handshake.
+     * Endpoints default to the protocol v1 CRC-16-CCITT; incoming packets are checked per their flags.
+     */
+    void set_checksum(const asio::ip::udp::endpoint& endpoint, checksum::Algorithm algorithm);
+    [[nodiscard]] checksum::Algorithm checksum_for(const asio::ip::udp::endpoint& endpoint) const;
+    /**
+     * Holds the outgoing datagrams until flush() when the transport batches them (see UdpTransport::cork).
+     */
+    void cork();
+    void flush();
     /**
      * Polls the retransmission queue and reschedules the timer.
      */
@@ -375,7 +596,7 @@ class Session : public std::enable_shared_from_this<Session> {
     /**
      * Handles an incoming packet, updating reliability state and dispatching callbacks.
      */
-    void handle_packet(const asio::error_code& ec, Packet packet, const asio::ip::udp::endpoint& endpoint);
+    void handle_packet(const asio::error_code& ec, const Packet& packet, const asio::ip::udp::endpoint& endpoint);
 
     /**
      * Schedules the next retransmission timer tick.
@@ -395,5 +616,27 @@ class Session : public std::enable_shared_from_this<Session> {
     std::size_t m_fragment_payload_size = k_max_payload_size;
     bool m_started = false;
     std::unordered_set<asio::ip::udp::endpoint, EndpointHash> m_connected_endpoints{};
+    // Written by the io thread on handshake, read by the game thread on every send
+    mutable std::mutex m_checksums_mutex;
+    std::unordered_map<asio::ip::udp::endpoint, checksum::Algorithm, EndpointHash> m_checksums{};
+};
+
+// Corks a session for the lifetime of the guard: the sends of a tick leave together on scope exit,
+// including when the tick throws half-way, so the transport is never left corked.
+class CorkGuard {
+  public:
+    explicit CorkGuard(Session& session) : m_session(session) {
+        m_session.cork();
+    }
+    ~CorkGuard() {
+        m_session.flush();
+    }
+    CorkGuard(const CorkGuard&) = delete;
+    CorkGuard& operator=(const CorkGuard&) = delete;
+    CorkGuard(CorkGuard&&) = delete;
+    CorkGuard& operator=(CorkGuard&&) = delete;
+
+  private:
+    Session& m_session;
 };
 } // namespace net
\ No newline at end of file
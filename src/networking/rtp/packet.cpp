@@ -1,7 +1,7 @@
 #include "networking.h"
+#include "checksum.h"
 
 #include <algorithm>
-#include <cstring>
 #include <stdexcept>
 
 namespace net {
@@ -11,10 +11,6 @@ constexpr std::uint8_t k_byte_mask = 0xFFU;
 constexpr std::uint8_t k_shift8 = 8U;
 constexpr std::uint8_t k_shift16 = 16U;
 constexpr std::uint8_t k_shift24 = 24U;
-constexpr std::uint16_t k_crc_poly = 0x1021U;
-constexpr std::uint16_t k_crc_init = 0xFFFFU;
-constexpr std::uint16_t k_crc_high_bit = 0x8000U;
-constexpr std::size_t k_bits_per_byte = 8;
 
 constexpr std::size_t k_magic_number_offset = 0;
 constexpr std::size_t k_command_offset = 2;
@@ -27,20 +23,20 @@ constexpr std::size_t k_fragment_count_offset = 15;
 constexpr std::size_t k_payload_size_offset = 16;
 constexpr std::size_t k_checksum_offset = 18;
 
-// Computes a CRC-16-CCITT checksum for the provided buffer.
-std::uint16_t crc16_ccitt(std::span<const std::uint8_t> buffer) noexcept {
-    std::uint16_t crc = k_crc_init;
-    for (std::uint8_t byte : buffer) {
-        crc ^= static_cast<std::uint16_t>(byte) << k_shift8;
-        for (std::size_t i = 0; i < k_bits_per_byte; ++i) {
-            if ((crc & k_crc_high_bit) != 0U) {
-                crc = static_cast<std::uint16_t>((crc << 1U) ^ k_crc_poly);
-            } else {
-                crc = static_cast<std::uint16_t>(crc << 1U);
-            }
-        }
+// Computes the checksum of a serialized packet as if its checksum field was zero, without copying it.
+// Packets flagged KCrc32c carry a folded CRC-32C, every other packet the protocol v1 CRC-16-CCITT.
+std::uint16_t packet_checksum(std::span<const std::uint8_t> buffer) noexcept {
+    constexpr std::array<std::uint8_t, sizeof(std::uint16_t)> k_zero_checksum{};
+    const auto k_before = buffer.first(k_checksum_offset);
+    const auto k_after = buffer.subspan(k_checksum_offset + k_zero_checksum.size());
+    if (has_flag(buffer[k_flags_offset], PacketFlag::KCrc32c)) {
+        std::uint32_t crc = checksum::crc32c_update(k_before, checksum::k_crc32c_init);
+        crc = checksum::crc32c_update(k_zero_checksum, crc);
+        return checksum::fold(~checksum::crc32c_update(k_after, crc));
     }
-    return crc;
+    std::uint16_t crc = checksum::crc16_slice8(k_before);
+    crc = checksum::crc16_slice8(k_zero_checksum, crc);
+    return checksum::crc16_slice8(k_after, crc);
 }
 
 // Encodes a 16-bit integer into two little-endian bytes at the requested offset.
@@ -72,18 +68,22 @@ std::uint32_t read_u32(std::span<const std::uint8_t> source, std::size_t offset)
 
 std::array<std::uint8_t, k_header_size> PacketHeader::serialize() const {
     std::array<std::uint8_t, k_header_size> bytes{};
-    auto view = std::span<std::uint8_t>(bytes.data(), bytes.size());
+    encode(bytes);
+    return bytes;
+}
+
+void PacketHeader::encode(std::span<std::uint8_t, k_header_size> target) const noexcept {
+    auto view = std::span<std::uint8_t>(target.data(), target.size());
     write_u16(m_magic, view, k_magic_number_offset);
-    bytes[k_command_offset] = m_command;
-    bytes[k_flags_offset] = m_flags;
+    target[k_command_offset] = m_command;
+    target[k_flags_offset] = m_flags;
     write_u32(m_sequence, view, k_sequence_offset);
     write_u32(m_ack, view, k_ack_offset);
     write_u16(m_fragment_id, view, k_fragment_id_offset);
-    bytes[k_fragment_index_offset] = m_fragment_index;
-    bytes[k_fragment_count_offset] = m_fragment_count;
+    target[k_fragment_index_offset] = m_fragment_index;
+    target[k_fragment_count_offset] = m_fragment_count;
     write_u16(m_payload_size, view, k_payload_size_offset);
     write_u16(m_checksum, view, k_checksum_offset);
-    return bytes;
 }
 
 PacketHeader PacketHeader::deserialize(std::span<const std::uint8_t, k_header_size> buffer) {
@@ -114,51 +114,56 @@ std::vector<std::uint8_t> Packet::to_buffer() const {
         throw std::runtime_error("payload exceeds maximum size");
     }
 
+    std::vector<std::uint8_t> buffer(k_header_size + payload.size());
+    encode(buffer);
+    return buffer;
+}
+
+std::size_t Packet::encode(std::span<std::uint8_t> target) const {
+    if (payload.size() > k_max_payload_size) {
+        throw std::runtime_error("payload exceeds maximum size");
+    }
+    const std::size_t k_size = k_header_size + payload.size();
+    if (target.size() < k_size) {
+        throw std::runtime_error("buffer too small");
+    }
+
     PacketHeader header_copy = header;
     header_copy.m_payload_size = static_cast<std::uint16_t>(payload.size());
     header_copy.m_checksum = 0;
+    header_copy.encode(target.first<k_header_size>());
+    std::ranges::transform(payload, target.begin() + k_header_size, [](std::byte b) { return net::byte_to_u8(b); });
 
-    std::vector<std::uint8_t> buffer(k_header_size + payload.size());
-    auto view = std::span<std::uint8_t>(buffer.data(), buffer.size());
-    const auto k_header_bytes = header_copy.serialize();
-    std::ranges::copy(k_header_bytes, buffer.begin());
-    std::ranges::transform(payload, buffer.begin() + k_header_size, [](std::byte b) { return net::byte_to_u8(b); });
-    const auto k_checksum = crc16_ccitt(buffer);
-    write_u16(k_checksum, view, k_checksum_offset);
-
-    return buffer;
+    const auto k_packet = target.first(k_size);
+    write_u16(packet_checksum(k_packet), k_packet, k_checksum_offset);
+    return k_size;
 }
 
 Packet Packet::from_buffer(std::span<const std::uint8_t> buffer) {
+    Packet packet{};
+    decode(buffer, packet);
+    return packet;
+}
+
+void Packet::decode(std::span<const std::uint8_t> buffer, Packet& packet) {
     if (buffer.size() < k_header_size) {
         throw std::runtime_error("buffer too small");
     }
 
-    std::array<std::uint8_t, k_header_size> header_bytes{};
-    std::memcpy(header_bytes.data(), buffer.data(), k_header_size);
-    PacketHeader header = PacketHeader::deserialize(header_bytes);
+    const PacketHeader k_header = PacketHeader::deserialize(buffer.first<k_header_size>());
 
-    const std::size_t k_expected_size = k_header_size + header.m_payload_size;
+    const std::size_t k_expected_size = k_header_size + k_header.m_payload_size;
     if (buffer.size() != k_expected_size) {
         throw std::runtime_error("payload size mismatch");
     }
 
-    std::vector<std::uint8_t> verification(buffer.begin(), buffer.end());
-    verification[k_checksum_offset] = 0;
-    verification[k_checksum_offset + 1] = 0;
-
-    const std::uint16_t k_expected_checksum = crc16_ccitt(verification);
-    if (k_expected_checksum != header.m_checksum) {
+    if (packet_checksum(buffer) != k_header.m_checksum) {
         throw std::runtime_error("checksum mismatch");
     }
 
-    Packet packet{};
-    packet.header = header;
-    const auto k_payload_begin = buffer.begin() + k_header_size;
-    const auto k_payload_end = buffer.end();
-    packet.payload.resize(std::distance(k_payload_begin, k_payload_end));
-    std::ranges::transform(k_payload_begin, k_payload_end, packet.payload.begin(),
-                           [](std::uint8_t b) { return static_cast<std::byte>(b); });
-    return packet;
+    packet.header = k_header;
+    const auto k_payload = buffer.subspan(k_header_size);
+    packet.payload.resize(k_payload.size());
+    std::ranges::transform(k_payload, packet.payload.begin(), [](std::uint8_t b) { return static_cast<std::byte>(b); });
 }
 } // namespace net
@@ -0,0 +1,174 @@
+#include "networking.h"
+
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace net {
+namespace {
+constexpr std::uint32_t k_tag_shift = 32U;
+constexpr std::uint64_t k_slot_mask = 0xFFFFFFFFULL;
+
+// Packs an ABA tag and a free list slot (index + 1, 0 for the end of the list) into a list head.
+constexpr std::uint64_t make_head(std::uint64_t tag, std::uint32_t slot) noexcept {
+    return (tag << k_tag_shift) | slot;
+}
+
+constexpr std::uint32_t head_slot(std::uint64_t head) noexcept {
+    return static_cast<std::uint32_t>(head & k_slot_mask);
+}
+
+constexpr std::uint64_t head_tag(std::uint64_t head) noexcept {
+    return head >> k_tag_shift;
+}
+} // namespace
+
+PacketBufferPool::Buffer::Buffer(PacketBufferPool* pool, std::uint32_t index, std::uint8_t* slab) noexcept
+    : m_pool(pool), m_index(index), m_slab(slab) {}
+
+PacketBufferPool::Buffer::~Buffer() {
+    if (m_pool != nullptr) {
+        m_pool->release(m_index);
+    }
+}
+
+PacketBufferPool::Buffer::Buffer(Buffer&& other) noexcept
+    : m_pool(std::exchange(other.m_pool, nullptr)), m_index(other.m_index),
+      m_slab(std::exchange(other.m_slab, nullptr)), m_size(std::exchange(other.m_size, 0)) {}
+
+PacketBufferPool::Buffer& PacketBufferPool::Buffer::operator=(Buffer&& other) noexcept {
+    if (this != &other) {
+        if (m_pool != nullptr) {
+            m_pool->release(m_index);
+        }
+        m_pool = std::exchange(other.m_pool, nullptr);
+        m_index = other.m_index;
+        m_slab = std::exchange(other.m_slab, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+    return *this;
+}
+
+std::span<std::uint8_t, PacketBufferPool::k_slab_size> PacketBufferPool::Buffer::data() const noexcept {
+    return std::span<std::uint8_t, k_slab_size>(m_slab, k_slab_size);
+}
+
+std::span<const std::uint8_t> PacketBufferPool::Buffer::bytes() const noexcept {
+    return {m_slab, m_size};
+}
+
+std::size_t PacketBufferPool::Buffer::size() const noexcept {
+    return m_size;
+}
+
+void PacketBufferPool::Buffer::resize(std::size_t size) {
+    if (size > k_slab_size) {
+        throw std::length_error("packet buffer size exceeds slab size");
+    }
+    m_size = size;
+}
+
+PacketBufferPool::Buffer::operator bool() const noexcept {
+    return m_slab != nullptr;
+}
+
+PacketBufferPool::PacketBufferPool(std::size_t initialSlabs) {
+    std::lock_guard<std::mutex> lock(m_grow_mutex);
+    while (capacity() < initialSlabs) {
+        add_chunk();
+    }
+}
+
+PacketBufferPool::Buffer PacketBufferPool::acquire() {
+    const std::uint32_t k_index = pop_or_grow();
+    return Buffer(this, k_index, slab(k_index));
+}
+
+void* PacketBufferPool::allocate(std::size_t size, std::size_t alignment) {
+    if (size > k_slab_size - k_block_offset || alignment > k_block_offset) {
+        return ::operator new(size, std::align_val_t{alignment});
+    }
+    const std::uint32_t k_index = pop_or_grow();
+    std::uint8_t* block = slab(k_index);
+    std::memcpy(block, &k_index, sizeof(k_index));
+    return block + k_block_offset;
+}
+
+void PacketBufferPool::deallocate(void* block, std::size_t size, std::size_t alignment) noexcept {
+    if (size > k_slab_size - k_block_offset || alignment > k_block_offset) {
+        ::operator delete(block, std::align_val_t{alignment});
+        return;
+    }
+    std::uint32_t index = 0;
+    std::memcpy(&index, static_cast<std::uint8_t*>(block) - k_block_offset, sizeof(index));
+    release(index);
+}
+
+std::size_t PacketBufferPool::capacity() const noexcept {
+    return m_chunk_count.load(std::memory_order_acquire) * k_slabs_per_chunk;
+}
+
+std::uint32_t PacketBufferPool::pop_or_grow() {
+    auto index = pop();
+    while (!index.has_value()) {
+        grow();
+        index = pop();
+    }
+    return *index;
+}
+
+// Growing is rare, so it is serialized.
+void PacketBufferPool::grow() {
+    std::lock_guard<std::mutex> lock(m_grow_mutex);
+    // Another thread may have grown the pool, or released slabs, meanwhile
+    if (head_slot(m_free_head.load(std::memory_order_acquire)) == 0) {
+        add_chunk();
+    }
+}
+
+// The chunk is fully built before its slabs become reachable.
+void PacketBufferPool::add_chunk() {
+    const std::size_t k_chunk = m_chunk_count.load(std::memory_order_relaxed);
+    if (k_chunk >= k_max_chunks) {
+        throw std::runtime_error("packet buffer pool exhausted");
+    }
+    m_chunks[k_chunk] = std::make_unique<Chunk>();
+    m_chunk_count.store(k_chunk + 1, std::memory_order_release);
+
+    for (std::size_t i = k_slabs_per_chunk; i-- > 0;) {
+        release(static_cast<std::uint32_t>(k_chunk * k_slabs_per_chunk + i));
+    }
+}
+
+void PacketBufferPool::release(std::uint32_t index) noexcept {
+    std::uint64_t head = m_free_head.load(std::memory_order_relaxed);
+    std::uint64_t desired = 0;
+    do {
+        next(index).store(head_slot(head), std::memory_order_relaxed);
+        desired = make_head(head_tag(head) + 1, index + 1);
+    } while (!m_free_head.compare_exchange_weak(head, desired, std::memory_order_release, std::memory_order_relaxed));
+}
+
+// The tag changes on every push and pop: a head read before a concurrent pop/push pair fails its exchange.
+std::optional<std::uint32_t> PacketBufferPool::pop() noexcept {
+    std::uint64_t head = m_free_head.load(std::memory_order_acquire);
+    while (head_slot(head) != 0) {
+        const std::uint32_t k_index = head_slot(head) - 1;
+        const std::uint32_t k_next = next(k_index).load(std::memory_order_relaxed);
+        if (m_free_head.compare_exchange_weak(head, make_head(head_tag(head) + 1, k_next), std::memory_order_acquire,
+                                              std::memory_order_acquire)) {
+            return k_index;
+        }
+    }
+    return std::nullopt;
+}
+
+std::atomic<std::uint32_t>& PacketBufferPool::next(std::uint32_t index) const noexcept {
+    return m_chunks[index / k_slabs_per_chunk]->m_next[index % k_slabs_per_chunk];
+}
+
+std::uint8_t* PacketBufferPool::slab(std::uint32_t index) const noexcept {
+    return m_chunks[index / k_slabs_per_chunk]->m_slabs[index % k_slabs_per_chunk].data();
+}
+} // namespace net
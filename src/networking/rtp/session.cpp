@@ -7,9 +7,9 @@
 
 namespace net {
 Session::Session(asio::io_context& context, const asio::ip::udp::endpoint& remote, ReliabilityConfig config,
-                 std::uint16_t localPort)
-    : m_transport(std::make_shared<UdpTransport>(context, localPort)), m_config(config), m_send_queue(config),
-      m_retransmit_timer(context) {
+                 std::uint16_t localPort, DatagramBatchConfig batching)
+    : m_transport(std::make_shared<UdpTransport>(context, localPort, batching)), m_config(config),
+      m_send_queue(config), m_retransmit_timer(context) {
     m_transport->set_default_remote(remote);
 }
 
@@ -18,9 +18,10 @@ void Session::start(PacketCallback onReliable, PacketCallback onUnreliable) {
     m_unreliable_callback = std::move(onUnreliable);
     m_started = true;
     auto self = shared_from_this();
-    m_transport->start([self](const asio::error_code& ec, Packet packet, const asio::ip::udp::endpoint& endpoint) {
-        self->handle_packet(ec, std::move(packet), endpoint);
-    });
+    m_transport->start(
+        [self](const asio::error_code& ec, const Packet& packet, const asio::ip::udp::endpoint& endpoint) {
+            self->handle_packet(ec, packet, endpoint);
+        });
     schedule_retransmission();
 }
 
@@ -89,6 +90,13 @@ std::uint32_t Session::send_single_packet(Packet packet, const asio::ip::udp::en
     auto now = std::chrono::steady_clock::now();
     std::uint32_t sequence = 0;
 
+    // Set before tracking so retransmissions keep the negotiated checksum
+    if (checksum_for(endpoint) == checksum::Algorithm::KCrc32c) {
+        packet.header.m_flags = set_flag(packet.header.m_flags, PacketFlag::KCrc32c);
+    } else {
+        packet.header.m_flags = clear_flag(packet.header.m_flags, PacketFlag::KCrc32c);
+    }
+
     if (reliable || has_flag(packet.header.m_flags, PacketFlag::KReliable)) {
         packet.header.m_flags = set_flag(packet.header.m_flags, PacketFlag::KReliable);
         packet.header.m_sequence = m_send_queue.next_sequence();
@@ -242,7 +250,34 @@ std::size_t Session::fragment_payload_size() const noexcept {
     return m_fragment_payload_size;
 }
 
-void Session::handle_packet(const asio::error_code& ec, Packet packet, const asio::ip::udp::endpoint& endpoint) {
+void Session::set_checksum(const asio::ip::udp::endpoint& endpoint, checksum::Algorithm algorithm) {
+    std::lock_guard<std::mutex> lock(m_checksums_mutex);
+    if (algorithm == checksum::Algorithm::KCrc16Ccitt) {
+        m_checksums.erase(endpoint);
+    } else {
+        m_checksums[endpoint] = algorithm;
+    }
+}
+
+checksum::Algorithm Session::checksum_for(const asio::ip::udp::endpoint& endpoint) const {
+    std::lock_guard<std::mutex> lock(m_checksums_mutex);
+    // Most sessions never negotiate: skip hashing the endpoint
+    if (m_checksums.empty()) {
+        return checksum::Algorithm::KCrc16Ccitt;
+    }
+    const auto k_it = m_checksums.find(endpoint);
+    return k_it == m_checksums.end() ? checksum::Algorithm::KCrc16Ccitt : k_it->second;
+}
+
+void Session::cork() {
+    m_transport->cork();
+}
+
+void Session::flush() {
+    m_transport->flush();
+}
+
+void Session::handle_packet(const asio::error_code& ec, const Packet& packet, const asio::ip::udp::endpoint& endpoint) {
     if (ec) {
         return;
     }
@@ -274,7 +309,7 @@ void Session::handle_packet(const asio::error_code& ec, Packet packet, const asi
     
     // Handle Fragmentation
     if (has_flag(packet.header.m_flags, PacketFlag::KFragment)) {
-        auto assembled = ingest_fragment(std::move(packet));
+        auto assembled = ingest_fragment(packet);
         if (assembled) {
             if (m_reliable_callback) {
                  m_reliable_callback(*assembled, endpoint);
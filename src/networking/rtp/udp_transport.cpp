@@ -1,10 +1,104 @@
 #include "networking.h"
 
+#include <algorithm>
+#include <cerrno>
+#include <iterator>
 #include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#ifdef __linux__
+    #include <sys/socket.h>
+    #include <sys/uio.h>
+#endif
 
 namespace net {
-UdpTransport::UdpTransport(asio::io_context& context, std::uint16_t localPort)
-    : m_socket(context, asio::ip::udp::endpoint(asio::ip::udp::v4(), localPort)) {}
+namespace {
+// Completion handler whose operation state is allocated from a transport pool.
+// The wrapped handler must keep the transport, hence the pool, alive.
+template <typename THandler> struct PooledHandler {
+    using allocator_type = SlabAllocator<void>;
+
+    THandler m_handler;
+    PacketBufferPool* m_pool;
+
+    allocator_type get_allocator() const noexcept {
+        return allocator_type(*m_pool);
+    }
+
+    template <typename... TArgs> void operator()(TArgs&&... args) {
+        m_handler(std::forward<TArgs>(args)...);
+    }
+};
+
+template <typename THandler> PooledHandler<std::decay_t<THandler>> pooled(PacketBufferPool& pool, THandler&& handler) {
+    return {std::forward<THandler>(handler), &pool};
+}
+} // namespace
+
+#ifdef __linux__
+// Receive slabs and message headers are set up once; sends are queued from any thread
+// and handed to sendmmsg from the transport's executor.
+struct UdpTransport::BatchState {
+    struct PendingSend {
+        PacketBufferPool::Buffer m_buffer;
+        asio::ip::udp::endpoint m_endpoint;
+        SendHandler m_handler;
+        std::optional<Packet> m_packet;
+    };
+
+    BatchState(asio::io_context& context, PacketBufferPool& pool, const DatagramBatchConfig& config)
+        : m_executor(context.get_executor()), m_receive_buffers(std::max<std::size_t>(config.receive_batch, 1)),
+          m_senders(m_receive_buffers.size()),
+          m_receive_iovecs(m_receive_buffers.size()), m_receive_headers(m_receive_buffers.size()),
+          m_send_batch(std::max<std::size_t>(config.send_batch, 1)), m_send_iovecs(m_send_batch),
+          m_send_headers(m_send_batch) {
+        for (auto& buffer : m_receive_buffers) {
+            buffer = pool.acquire();
+        }
+        m_queued.reserve(m_send_batch);
+        m_sending.reserve(m_send_batch);
+    }
+
+    // The concrete executor: posting through the type-erased socket executor allocates the function
+    asio::io_context::executor_type m_executor;
+
+    // Executor only
+    std::vector<PacketBufferPool::Buffer> m_receive_buffers;
+    std::vector<asio::ip::udp::endpoint> m_senders;
+    std::vector<iovec> m_receive_iovecs;
+    std::vector<mmsghdr> m_receive_headers;
+
+    std::mutex m_mutex;
+    std::vector<PendingSend> m_queued;
+    bool m_corked = false;
+    bool m_flush_scheduled = false;
+
+    // Executor only: m_sending[m_next..] are still to be sent
+    std::size_t m_send_batch;
+    std::vector<PendingSend> m_sending;
+    std::size_t m_next = 0;
+    bool m_waiting_writable = false;
+    std::vector<iovec> m_send_iovecs;
+    std::vector<mmsghdr> m_send_headers;
+};
+#else
+struct UdpTransport::BatchState {};
+#endif
+
+UdpTransport::UdpTransport(asio::io_context& context, std::uint16_t localPort, DatagramBatchConfig batching)
+    : m_socket(context, asio::ip::udp::endpoint(asio::ip::udp::v4(), localPort)) {
+#ifdef __linux__
+    if (batching.enabled) {
+        m_batch = std::make_unique<BatchState>(context, m_pool, batching);
+    }
+#else
+    (void)batching;
+#endif
+}
+
+UdpTransport::~UdpTransport() = default;
 
 void UdpTransport::set_default_remote(const asio::ip::udp::endpoint& endpoint) {
     m_default_remote = endpoint;
@@ -24,6 +118,13 @@ const asio::ip::udp::endpoint& UdpTransport::default_remote() const {
 void UdpTransport::start(PacketHandler handler) {
     m_handler = std::move(handler);
     m_running = true;
+    if (m_batch) {
+        do_receive_batch();
+        return;
+    }
+    if (!m_receive_buffer) {
+        m_receive_buffer = m_pool.acquire();
+    }
     do_receive();
 }
 
@@ -35,14 +136,66 @@ void UdpTransport::async_send(const Packet& packet) {
 }
 
 void UdpTransport::async_send(const Packet& packet, const asio::ip::udp::endpoint& endpoint, SendHandler handler) {
-    auto self = shared_from_this();
-    auto buffer = std::make_shared<std::vector<std::uint8_t>>(packet.to_buffer());
-    m_socket.async_send_to(asio::buffer(*buffer), endpoint,
-                           [self, buffer, handler, packet](const asio::error_code& ec, std::size_t) mutable -> void {
-                               if (handler) {
-                                   handler(ec, packet);
-                               }
-                           });
+    // The buffer is declared after the transport owning its pool, so that it is released first
+    struct SendOperation {
+        std::shared_ptr<UdpTransport> m_self;
+        PacketBufferPool::Buffer m_buffer;
+        SendHandler m_handler;
+        std::optional<Packet> m_packet;
+    };
+
+#ifdef __linux__
+    if (m_batch) {
+        BatchState::PendingSend pending{m_pool.acquire(), endpoint, std::move(handler), std::nullopt};
+        pending.m_buffer.resize(packet.encode(pending.m_buffer.data()));
+        if (pending.m_handler) {
+            pending.m_packet = packet;
+        }
+        std::lock_guard<std::mutex> lock(m_batch->m_mutex);
+        m_batch->m_queued.push_back(std::move(pending));
+        if (!m_batch->m_corked || m_batch->m_queued.size() >= m_batch->m_send_batch) {
+            schedule_flush();
+        }
+        return;
+    }
+#endif
+
+    SendOperation operation{shared_from_this(), m_pool.acquire(), std::move(handler), std::nullopt};
+    operation.m_buffer.resize(packet.encode(operation.m_buffer.data()));
+    if (operation.m_handler) {
+        operation.m_packet = packet;
+    }
+    m_send_syscalls.fetch_add(1, std::memory_order_relaxed);
+    m_packets_sent.fetch_add(1, std::memory_order_relaxed);
+
+    const auto k_bytes = operation.m_buffer.bytes();
+    auto on_sent = [operation = std::move(operation)](const asio::error_code& ec, std::size_t) -> void {
+        if (operation.m_handler) {
+            operation.m_handler(ec, *operation.m_packet);
+        }
+    };
+    m_socket.async_send_to(asio::buffer(k_bytes.data(), k_bytes.size()), endpoint, pooled(m_pool, std::move(on_sent)));
+}
+
+void UdpTransport::cork() {
+#ifdef __linux__
+    if (m_batch) {
+        std::lock_guard<std::mutex> lock(m_batch->m_mutex);
+        m_batch->m_corked = true;
+    }
+#endif
+}
+
+void UdpTransport::flush() {
+#ifdef __linux__
+    if (m_batch) {
+        std::lock_guard<std::mutex> lock(m_batch->m_mutex);
+        m_batch->m_corked = false;
+        if (!m_batch->m_queued.empty()) {
+            schedule_flush();
+        }
+    }
+#endif
 }
 
 void UdpTransport::close() {
@@ -56,39 +209,212 @@ asio::ip::udp::endpoint UdpTransport::local_endpoint() const {
     return m_socket.local_endpoint();
 }
 
+bool UdpTransport::batching() const noexcept {
+    return m_batch != nullptr;
+}
+
+TransportStats UdpTransport::stats() const noexcept {
+    return {.send_syscalls = m_send_syscalls.load(std::memory_order_relaxed),
+            .receive_syscalls = m_receive_syscalls.load(std::memory_order_relaxed),
+            .packets_sent = m_packets_sent.load(std::memory_order_relaxed),
+            .packets_received = m_packets_received.load(std::memory_order_relaxed)};
+}
+
 void UdpTransport::do_receive() {
     if (!m_running) {
         return;
     }
 
     auto self = shared_from_this();
-    m_socket.async_receive_from(asio::buffer(m_buffer), m_sender,
-                                [self](const asio::error_code& error_code, std::size_t bytesTransferred) -> void {
-                                    if (!self->m_running) {
-                                        return;
-                                    }
-
-                                    if (error_code) {
-                                        if (self->m_handler) {
-                                            self->m_handler(error_code, Packet{}, self->m_sender);
-                                        }
-                                    } else {
-                                        try {
-                                            Packet packet =
-                                                Packet::from_buffer(std::span(self->m_buffer.data(), bytesTransferred));
-                                            if (self->m_handler) {
-                                                self->m_handler(error_code, std::move(packet), self->m_sender);
-                                            }
-                                        } catch (const std::exception&) {
-                                            if (self->m_handler) {
-                                                asio::error_code decode_error =
-                                                    std::make_error_code(std::errc::illegal_byte_sequence);
-                                                self->m_handler(decode_error, Packet{}, self->m_sender);
-                                            }
-                                        }
-                                    }
-
-                                    self->do_receive();
-                                });
+    const auto k_slab = m_receive_buffer.data();
+    auto on_receive = [self](const asio::error_code& error_code, std::size_t bytesTransferred) -> void {
+        if (!self->m_running) {
+            return;
+        }
+
+        self->m_receive_syscalls.fetch_add(1, std::memory_order_relaxed);
+        if (error_code) {
+            if (self->m_handler) {
+                self->m_handler(error_code, Packet{}, self->m_sender);
+            }
+        } else {
+            self->m_packets_received.fetch_add(1, std::memory_order_relaxed);
+            try {
+                // Decoded into the same packet every time, to reuse its payload storage
+                Packet::decode(self->m_receive_buffer.data().first(bytesTransferred), self->m_received);
+                if (self->m_handler) {
+                    self->m_handler(error_code, self->m_received, self->m_sender);
+                }
+            } catch (const std::exception&) {
+                if (self->m_handler) {
+                    asio::error_code decode_error = std::make_error_code(std::errc::illegal_byte_sequence);
+                    self->m_handler(decode_error, Packet{}, self->m_sender);
+                }
+            }
+        }
+
+        self->do_receive();
+    };
+    m_socket.async_receive_from(asio::buffer(k_slab.data(), k_slab.size()), m_sender,
+                                pooled(m_pool, std::move(on_receive)));
+}
+
+#ifdef __linux__
+// Waits for the socket to become readable, then drains it with recvmmsg.
+void UdpTransport::do_receive_batch() {
+    if (!m_running) {
+        return;
+    }
+
+    auto self = shared_from_this();
+    auto on_readable = [self](const asio::error_code& error_code) -> void {
+        if (!self->m_running) {
+            return;
+        }
+        if (error_code) {
+            if (self->m_handler) {
+                self->m_handler(error_code, Packet{}, self->m_sender);
+            }
+        } else {
+            self->drain_receive_batch();
+        }
+        self->do_receive_batch();
+    };
+    m_socket.async_wait(asio::socket_base::wait_read, pooled(m_pool, std::move(on_readable)));
+}
+
+void UdpTransport::drain_receive_batch() {
+    BatchState& batch = *m_batch;
+    const std::size_t k_capacity = batch.m_receive_headers.size();
+    for (std::size_t i = 0; i < k_capacity; ++i) {
+        const auto k_slab = batch.m_receive_buffers[i].data();
+        batch.m_receive_iovecs[i] = iovec{.iov_base = k_slab.data(), .iov_len = k_slab.size()};
+        batch.m_receive_headers[i] = mmsghdr{};
+        batch.m_receive_headers[i].msg_hdr.msg_name = batch.m_senders[i].data();
+        batch.m_receive_headers[i].msg_hdr.msg_namelen = static_cast<socklen_t>(batch.m_senders[i].capacity());
+        batch.m_receive_headers[i].msg_hdr.msg_iov = &batch.m_receive_iovecs[i];
+        batch.m_receive_headers[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    const int k_received = ::recvmmsg(m_socket.native_handle(), batch.m_receive_headers.data(),
+                                      static_cast<unsigned int>(k_capacity), MSG_DONTWAIT, nullptr);
+    m_receive_syscalls.fetch_add(1, std::memory_order_relaxed);
+    if (k_received < 0) {
+        // Spurious wakeup: the next wait picks the datagrams up
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+            return;
+        }
+        if (m_handler) {
+            m_handler(asio::error_code(errno, asio::error::get_system_category()), Packet{}, m_sender);
+        }
+        return;
+    }
+    m_packets_received.fetch_add(static_cast<std::uint64_t>(k_received), std::memory_order_relaxed);
+
+    // Same contract as the single datagram path, one handler call per datagram
+    for (std::size_t i = 0; i < static_cast<std::size_t>(k_received) && m_running; ++i) {
+        const msghdr& header = batch.m_receive_headers[i].msg_hdr;
+        m_sender = batch.m_senders[i];
+        m_sender.resize(header.msg_namelen);
+        try {
+            Packet::decode(batch.m_receive_buffers[i].data().first(batch.m_receive_headers[i].msg_len), m_received);
+            if (m_handler) {
+                m_handler(asio::error_code{}, m_received, m_sender);
+            }
+        } catch (const std::exception&) {
+            if (m_handler) {
+                asio::error_code decode_error = std::make_error_code(std::errc::illegal_byte_sequence);
+                m_handler(decode_error, Packet{}, m_sender);
+            }
+        }
+    }
+}
+
+void UdpTransport::schedule_flush() {
+    if (m_batch->m_flush_scheduled) {
+        return;
+    }
+    m_batch->m_flush_scheduled = true;
+    auto self = shared_from_this();
+    asio::post(m_batch->m_executor, pooled(m_pool, [self]() { self->flush_batch(); }));
+}
+
+// Sends everything queued so far, m_send_batch datagrams per sendmmsg. A full socket buffer
+// parks the rest until the socket is writable again.
+void UdpTransport::flush_batch() {
+    BatchState& batch = *m_batch;
+    {
+        std::lock_guard<std::mutex> lock(batch.m_mutex);
+        batch.m_flush_scheduled = false;
+        std::ranges::move(batch.m_queued, std::back_inserter(batch.m_sending));
+        batch.m_queued.clear();
+    }
+    if (batch.m_waiting_writable) {
+        return;
+    }
+
+    auto complete = [&batch](std::size_t index, const asio::error_code& ec) {
+        auto& pending = batch.m_sending[index];
+        if (pending.m_handler) {
+            pending.m_handler(ec, *pending.m_packet);
+        }
+    };
+
+    while (batch.m_next < batch.m_sending.size()) {
+        if (!m_socket.is_open()) {
+            complete(batch.m_next++, asio::error::operation_aborted);
+            continue;
+        }
+
+        const std::size_t k_count = std::min(batch.m_sending.size() - batch.m_next, batch.m_send_batch);
+        for (std::size_t i = 0; i < k_count; ++i) {
+            auto& pending = batch.m_sending[batch.m_next + i];
+            const auto k_bytes = pending.m_buffer.bytes();
+            batch.m_send_iovecs[i] =
+                iovec{.iov_base = const_cast<std::uint8_t*>(k_bytes.data()), .iov_len = k_bytes.size()};
+            batch.m_send_headers[i] = mmsghdr{};
+            batch.m_send_headers[i].msg_hdr.msg_name = pending.m_endpoint.data();
+            batch.m_send_headers[i].msg_hdr.msg_namelen = static_cast<socklen_t>(pending.m_endpoint.size());
+            batch.m_send_headers[i].msg_hdr.msg_iov = &batch.m_send_iovecs[i];
+            batch.m_send_headers[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int k_sent = ::sendmmsg(m_socket.native_handle(), batch.m_send_headers.data(),
+                                      static_cast<unsigned int>(k_count), MSG_DONTWAIT);
+        m_send_syscalls.fetch_add(1, std::memory_order_relaxed);
+        if (k_sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                batch.m_waiting_writable = true;
+                auto self = shared_from_this();
+                auto on_writable = [self](const asio::error_code&) -> void {
+                    self->m_batch->m_waiting_writable = false;
+                    self->flush_batch();
+                };
+                m_socket.async_wait(asio::socket_base::wait_write, pooled(m_pool, std::move(on_writable)));
+                return;
+            }
+            // The first datagram is rejected (e.g. unreachable destination): report it and carry on
+            complete(batch.m_next++, asio::error_code(errno, asio::error::get_system_category()));
+            continue;
+        }
+
+        m_packets_sent.fetch_add(static_cast<std::uint64_t>(k_sent), std::memory_order_relaxed);
+        for (int i = 0; i < k_sent; ++i) {
+            complete(batch.m_next++, asio::error_code{});
+        }
+    }
+
+    // Releases the slabs, keeps the capacity
+    batch.m_sending.clear();
+    batch.m_next = 0;
 }
+#else
+void UdpTransport::do_receive_batch() {}
+void UdpTransport::drain_receive_batch() {}
+void UdpTransport::schedule_flush() {}
+void UdpTransport::flush_batch() {}
+#endif
 } // namespace net
@@ -2,6 +2,11 @@
 #include "utils/logger.h"
 #include <nlohmann/json.hpp>
 
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
 using json = nlohmann::json;
 
 AdminHTTPServer::AdminHTTPServer(LobbyManager* lobby_manager, std::uint16_t port)
@@ -21,6 +26,77 @@ void AdminHTTPServer::setup_routes() {
         res.status = http::k_status_ok;
     });
 
+    // Registry memory of each lobby, per component pool (optional ?lobby_id= filter)
+    m_server->Get("/admin/lobby/memory", [this](const httplib::Request& req, httplib::Response& res) {
+        try {
+            std::optional<std::uint32_t> lobby_filter;
+            if (req.has_param("lobby_id")) {
+                lobby_filter = static_cast<std::uint32_t>(std::stoul(req.get_param_value("lobby_id")));
+            }
+
+            json lobbies = json::array();
+            for (const auto& lobby : m_lobby_manager->get_lobbies()) {
+                if (lobby_filter && lobby->get_id() != *lobby_filter) {
+                    continue;
+                }
+
+                json pools = json::array();
+                std::uint64_t total_bytes = 0;
+                std::uint32_t entity_bytes = 0;
+                std::uint32_t journal_bytes = 0;
+                for (const auto& [component_id, entry] : lobby->get_pool_memory()) {
+                    const double occupancy = entry.capacity == 0
+                        ? 0.0 : static_cast<double>(entry.count) / static_cast<double>(entry.capacity);
+                    pools.push_back({
+                        {"component_id", component_id},
+                        {"name", entry.name},
+                        {"element_size", entry.element_size},
+                        {"capacity", entry.capacity},
+                        {"count", entry.count},
+                        {"occupancy", occupancy},
+                        {"component_bytes", entry.component_bytes},
+                        {"sparse_bytes", entry.sparse_bytes},
+                        {"metadata_bytes", entry.metadata_bytes}
+                    });
+                    total_bytes += std::uint64_t{entry.component_bytes} + entry.sparse_bytes + entry.metadata_bytes;
+                    entity_bytes = entry.entity_bytes;
+                    journal_bytes = entry.journal_bytes;
+                }
+                total_bytes += std::uint64_t{entity_bytes} + journal_bytes;
+
+                lobbies.push_back({
+                    {"lobby_id", lobby->get_id()},
+                    {"name", lobby->get_name()},
+                    {"entity_bytes", entity_bytes},
+                    {"journal_bytes", journal_bytes},
+                    {"total_bytes", total_bytes},
+                    {"pools", pools}
+                });
+            }
+
+            if (lobby_filter && lobbies.empty()) {
+                json error = {{"success", false}, {"error", "Lobby not found"}};
+                res.set_content(error.dump(), "application/json");
+                res.status = http::k_status_not_found;
+                return;
+            }
+
+            json response = {{"success", true}, {"lobbies", lobbies}};
+            res.set_content(response.dump(), "application/json");
+            res.status = http::k_status_ok;
+
+        } catch (const std::logic_error& /*e*/) {
+            // std::stoul: not a number, or out of range
+            json error = {{"success", false}, {"error", "Invalid lobby_id"}};
+            res.set_content(error.dump(), "application/json");
+            res.status = http::k_status_bad_request;
+        } catch (const std::exception& e) {
+            json error = {{"success", false}, {"error", std::string("Server error: ") + e.what()}};
+            res.set_content(error.dump(), "application/json");
+            res.status = http::k_status_internal_error;
+        }
+    });
+
     // Stop lobby endpoint (called by Node.js admin API)
     m_server->Post("/admin/lobby/stop", [this](const httplib::Request& req, httplib::Response& res) {
         try {
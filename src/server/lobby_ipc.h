@@ -1,8 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <memory>
+#include <type_traits>
 #include "boost/interprocess/ipc/message_queue.hpp"
 
 namespace ipc {
@@ -13,6 +15,7 @@ enum class MessageType : std::uint8_t {
     PLAYERCOUNT = 2,
     SHUTDOWNREQ = 3,
     SHUTDOWNACK = 4,
+    MEMORYREPORT = 5,
 };
 
 // IPC message structure (fixed size for message queue)
@@ -25,6 +28,24 @@ struct IPCMessage {
     IPCMessage() : type(MessageType::HEARTBEAT), lobby_id(0), data(0), extra{0} {}
 };
 
+// Memory held by one component pool of a lobby registry, packed into IPCMessage::extra
+// (MEMORYREPORT, data = component id). Sizes are clamped to 32 bits.
+struct PoolMemoryEntry {
+    static constexpr std::size_t k_name_size = 24;
+
+    char name[k_name_size];           // Truncated type name
+    std::uint32_t element_size;
+    std::uint32_t capacity;
+    std::uint32_t count;
+    std::uint32_t component_bytes;
+    std::uint32_t sparse_bytes;       // Sparse index (page table, pages, dense entity ids)
+    std::uint32_t metadata_bytes;     // Change stamps
+    std::uint32_t entity_bytes;       // Registry-wide: generation table and free list
+    std::uint32_t journal_bytes;      // Registry-wide: change journal
+};
+static_assert(sizeof(PoolMemoryEntry) <= sizeof(IPCMessage::extra), "PoolMemoryEntry must fit in IPCMessage::extra");
+static_assert(std::is_trivially_copyable_v<PoolMemoryEntry>);
+
 // LobbyIPC manages bidirectional communication between main server and lobby processes
 class LobbyIPC {
   public:
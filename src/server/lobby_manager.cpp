@@ -6,7 +6,10 @@
 #include "lobby_ipc.h"
 #include "backend_api_client.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cstring>
+#include <limits>
 
 #ifdef _WIN32
     #include <windows.h>
@@ -19,7 +22,44 @@
 namespace {
     constexpr int k_shutdown_wait_ms = 100;
     constexpr int k_heartbeat_interval_ticks = 60;
+    constexpr std::size_t k_memory_entries_per_heartbeat = 4;
     constexpr std::uint16_t k_backend_port = 8081;
+
+    std::uint32_t clamp_to_u32(std::size_t value) {
+        return static_cast<std::uint32_t>(std::min<std::size_t>(value, std::numeric_limits<std::uint32_t>::max()));
+    }
+
+    // Send the memory of a few component pools per heartbeat, resuming at `cursor`, so that the
+    // reports of a large registry never fill up the IPC queue
+    void send_memory_report(ipc::LobbyIPC& ipc, std::uint32_t lobby_id, const ecs::Registry& registry,
+                            std::size_t& cursor) {
+        const ecs::MemoryReport report = registry.memory_report();
+        if (report.pools.empty()) {
+            return;
+        }
+
+        for (std::size_t sent = 0; sent < std::min(k_memory_entries_per_heartbeat, report.pools.size()); ++sent) {
+            const auto& pool = report.pools[cursor++ % report.pools.size()];
+            ipc::PoolMemoryEntry entry{};
+            std::strncpy(entry.name, pool.type.name(), ipc::PoolMemoryEntry::k_name_size - 1);
+            entry.element_size = clamp_to_u32(pool.storage.element_size);
+            entry.capacity = clamp_to_u32(pool.storage.capacity);
+            entry.count = clamp_to_u32(pool.storage.count);
+            entry.component_bytes = clamp_to_u32(pool.storage.component_bytes);
+            entry.sparse_bytes = clamp_to_u32(pool.storage.sparse_bytes);
+            entry.metadata_bytes = clamp_to_u32(pool.storage.metadata_bytes);
+            entry.entity_bytes = clamp_to_u32(report.entity_bytes);
+            entry.journal_bytes = clamp_to_u32(report.journal_bytes);
+
+            ipc::IPCMessage msg;
+            msg.type = ipc::MessageType::MEMORYREPORT;
+            msg.lobby_id = lobby_id;
+            msg.data = static_cast<std::uint32_t>(pool.id);
+            std::memcpy(msg.extra, &entry, sizeof(entry));
+            ipc.send_to_main(msg);
+        }
+        cursor %= report.pools.size();
+    }
 }
 
 // GameLobby implementation
@@ -183,6 +223,7 @@ void GameLobby::run_lobby_in_child_process(std::uint32_t lobby_id, const std::st
         constexpr int k_tick_ms = 16;
         bool running = true;
         int heartbeat_counter = 0;
+        std::size_t memory_cursor = 0;
 
         while (running) {
             server->get_engine().delta_time = k_tick_ms / 1000.0f; // NOLINT(cppcoreguidelines-avoid-magic-numbers)
@@ -203,6 +244,7 @@ void GameLobby::run_lobby_in_child_process(std::uint32_t lobby_id, const std::st
                 heartbeat.type = ipc::MessageType::HEARTBEAT;
                 heartbeat.lobby_id = lobby_id;
                 ipc.send_to_main(heartbeat);
+                send_memory_report(ipc, lobby_id, server->get_engine().registry, memory_cursor);
                 heartbeat_counter = 0;
             }
             server->poll();
@@ -259,6 +301,14 @@ void GameLobby::process_ipc_messages() {
                 m_current_players = static_cast<std::uint8_t>(msg.data);
                 LOG_DEBUG("Lobby {} player count updated: {}", msg.lobby_id, msg.data);
                 break;
+            case ipc::MessageType::MEMORYREPORT: {
+                ipc::PoolMemoryEntry entry{};
+                std::memcpy(&entry, msg.extra, sizeof(entry));
+                entry.name[ipc::PoolMemoryEntry::k_name_size - 1] = '\0';
+                std::lock_guard<std::mutex> lock(m_memory_mutex);
+                m_pool_memory[msg.data] = entry;
+                break;
+            }
             case ipc::MessageType::SHUTDOWNACK:
                 LOG_INFO("Lobby {} acknowledged shutdown", msg.lobby_id);
                 break;
@@ -269,6 +319,11 @@ void GameLobby::process_ipc_messages() {
     }
 }
 
+std::map<std::uint32_t, ipc::PoolMemoryEntry> GameLobby::get_pool_memory() const {
+    std::lock_guard<std::mutex> lock(m_memory_mutex);
+    return m_pool_memory;
+}
+
 void GameLobby::add_player(const std::string& player_ip) {
     std::lock_guard<std::mutex> lock(m_players_mutex);
     auto it = std::find(m_players.begin(), m_players.end(), player_ip);
@@ -378,6 +433,19 @@ std::vector<net::lobby::LobbyInfo> LobbyManager::get_lobby_list() const {
     return result;
 }
 
+std::vector<std::shared_ptr<GameLobby>> LobbyManager::get_lobbies() const {
+    std::lock_guard<std::mutex> lock(m_lobbies_mutex);
+    std::vector<std::shared_ptr<GameLobby>> result;
+    result.reserve(m_lobbies.size());
+
+    for (const auto& [id, lobby] : m_lobbies) {
+        result.push_back(lobby);
+    }
+    std::sort(result.begin(), result.end(),
+        [](const auto& lhs, const auto& rhs) { return lhs->get_id() < rhs->get_id(); });
+    return result;
+}
+
 void LobbyManager::cleanup_empty_lobbies() {
     std::lock_guard<std::mutex> lock(m_lobbies_mutex);
     constexpr std::size_t k_empty_threshold_ticks = 300; // ~5 seconds at 60Hz
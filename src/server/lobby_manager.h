@@ -7,6 +7,7 @@
 
 #include <asio.hpp>
 #include <atomic>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -77,6 +78,9 @@ class GameLobby {
     process_handle_t get_process_handle() const {
         return m_process_handle;
     }
+
+    // Latest memory report of each component pool of the lobby registry, by component id
+    std::map<std::uint32_t, ipc::PoolMemoryEntry> get_pool_memory() const;
     
     // Static function to run lobby in child process (public for Windows lobby mode)
     static void run_lobby_in_child_process(std::uint32_t lobby_id, const std::string& lobby_name, 
@@ -97,6 +101,9 @@ class GameLobby {
 
     mutable std::mutex m_players_mutex;
     std::vector<std::string> m_players;
+
+    mutable std::mutex m_memory_mutex;
+    std::map<std::uint32_t, ipc::PoolMemoryEntry> m_pool_memory;
 };
 
 // Manages all lobbies and handles lobby-related requests
@@ -122,6 +129,9 @@ class LobbyManager {
     // Get list of all active lobbies
     std::vector<net::lobby::LobbyInfo> get_lobby_list() const;
 
+    // Get all lobbies, ordered by ID
+    std::vector<std::shared_ptr<GameLobby>> get_lobbies() const;
+
     // Clean up empty lobbies
     void cleanup_empty_lobbies();
     
@@ -37,12 +37,19 @@ void lobby_scene_loader(EngineContext &engine_ctx)
     registry.register_component<cpnt::EntityType>();
     // Net
     registry.register_component<cpnt::Replicated>();
+    // Groups are created here: systems only look them up, which is safe from parallel systems
+    registry.group<cpnt::Transform, cpnt::Velocity, cpnt::Bullet>();
+    registry.group<cpnt::MovementPattern>(ecs::Get<cpnt::Transform, cpnt::Velocity>{});
 
     // Sim
-    engine_ctx.add_system<cpnt::Transform, cpnt::Player, cpnt::Velocity>(sys::server_player_control_system);
-    engine_ctx.add_system<cpnt::Transform, cpnt::MovementPattern, cpnt::Velocity>(sys::server_enemy_movement_system);
-    engine_ctx.add_system<cpnt::Transform, cpnt::Velocity, cpnt::Enemy, cpnt::Health>(sys::server_enemy_system);
-    engine_ctx.add_system<cpnt::Transform, cpnt::Velocity, cpnt::Bullet>(sys::server_bullet_system);
+    engine_ctx.add_system<engn::Write<cpnt::Transform>, engn::Write<cpnt::Player>, engn::Write<cpnt::Velocity>>(
+        sys::server_player_control_system, ecs::SystemPolicy::Parallel);
+    engine_ctx.add_system<cpnt::Transform, engn::Write<cpnt::MovementPattern>, engn::Write<cpnt::Velocity>>(
+        sys::server_enemy_movement_system, ecs::SystemPolicy::Parallel);
+    engine_ctx.add_system<engn::Write<cpnt::Transform>, cpnt::Velocity, cpnt::Enemy, engn::Write<cpnt::Health>>(
+        sys::server_enemy_system, ecs::SystemPolicy::MainThread);
+    engine_ctx.add_system<engn::Write<cpnt::Transform>, cpnt::Velocity, cpnt::Bullet>(sys::server_bullet_system,
+                                                                                     ecs::SystemPolicy::Parallel);
     // Net
     engine_ctx.add_system<cpnt::Player>(sys::server_update_player_entities_system);
     engine_ctx.add_system<cpnt::Replicated>(sys::create_snapshot_system);
@@ -78,7 +85,7 @@ void lobby_scene_loader(EngineContext &engine_ctx)
         float spawn_x = (float)GetRandomValue(k_width, k_width * 2);
 
         // Replicated
-        engine_ctx.registry.add_component(enemy, cpnt::Replicated{static_cast<uint32_t>(enemy)});
+        engine_ctx.registry.add_component(enemy, cpnt::Replicated{enemy.index(), enemy.generation()});
 
         // Tag for archetype
         engine_ctx.registry.add_component(enemy, cpnt::EntityType{"charger"});
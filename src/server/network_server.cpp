@@ -14,7 +14,9 @@ using namespace engn;
 
 NetworkServer::NetworkServer(engn::EngineContext& engine_ctx, std::uint16_t port, LobbyManager* lobby_manager)
     : m_engine_ctx(engine_ctx), m_port(port), m_lobby_manager(lobby_manager) {
-    m_session = std::make_shared<net::Session>(m_io, asio::ip::udp::endpoint{}, net::ReliabilityConfig{}, m_port);
+    // Every tick fans snapshots out to all clients: drain and flush the datagrams in batches where supported
+    m_session = std::make_shared<net::Session>(m_io, asio::ip::udp::endpoint{}, net::ReliabilityConfig{}, m_port,
+                                               net::DatagramBatchConfig{.enabled = true});
     m_engine_ctx.network_session = m_session;
 }
 
@@ -191,6 +193,8 @@ void NetworkServer::handle_client_disconnect(const asio::ip::udp::endpoint& endp
         m_engine_ctx.remove_client(endpoint);
         m_client_last_activity.erase(endpoint);
     }
+    // A reconnecting client negotiates its checksum again
+    m_session->set_checksum(endpoint, net::checksum::Algorithm::KCrc16Ccitt);
 }
 
 void NetworkServer::update_client_activity(const asio::ip::udp::endpoint& endpoint) {
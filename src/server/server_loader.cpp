@@ -41,14 +41,20 @@ void load_server_scene(engn::EngineContext& engine_ctx) {
     registry.register_component<cpnt::Stats>();
     registry.register_component<cpnt::Tag>();
     registry.register_component<cpnt::Transform>();
+    // Groups are created here: systems only look them up, which is safe from parallel systems
+    registry.group<cpnt::Transform, cpnt::Velocity, cpnt::Bullet>();
+    registry.group<cpnt::MovementPattern>(ecs::Get<cpnt::Transform, cpnt::Velocity>{});
 
     engine_ctx.add_system<>(sys::log_inputs);
-    engine_ctx.add_system<cpnt::Transform, cpnt::Velocity, cpnt::Bullet>(sys::bullet_system);
-    engine_ctx.add_system<cpnt::Transform, cpnt::Bullet, cpnt::Enemy, cpnt::Health, cpnt::Player, cpnt::Hitbox,
-        cpnt::BulletShooter, cpnt::Shooter, cpnt::Stats, cpnt::BossHitbox>(
-        sys::collision_system);
-    engine_ctx.add_system<cpnt::Transform, cpnt::MovementPattern, cpnt::Velocity>(sys::enemy_movement_system);
-    engine_ctx.add_system<cpnt::Transform, cpnt::Velocity, cpnt::Enemy, cpnt::Health, cpnt::Sprite>(sys::enemy_system);
+    engine_ctx.add_system<engn::Write<cpnt::Transform>, cpnt::Velocity, cpnt::Bullet>(sys::bullet_system,
+                                                                              ecs::SystemPolicy::Parallel);
+    engine_ctx.add_system<cpnt::Transform, cpnt::Bullet, cpnt::Enemy, engn::Write<cpnt::Health>, cpnt::Player,
+        cpnt::Hitbox, cpnt::BulletShooter, cpnt::Shooter, engn::Write<cpnt::Stats>, cpnt::BossHitbox>(
+        sys::collision_system, ecs::SystemPolicy::Parallel);
+    engine_ctx.add_system<cpnt::Transform, engn::Write<cpnt::MovementPattern>, engn::Write<cpnt::Velocity>>(
+        sys::enemy_movement_system, ecs::SystemPolicy::Parallel);
+    engine_ctx.add_system<engn::Write<cpnt::Transform>, cpnt::Velocity, cpnt::Enemy, engn::Write<cpnt::Health>,
+                          engn::Write<cpnt::Sprite>>(sys::enemy_system);
     // engine_ctx.add_system<cpnt::Transform, cpnt::Player, cpnt::Sprite, cpnt::Velocity, cpnt::Health>(
     //     sys::player_control_system);
 
@@ -1,37 +1,27 @@
 #include "components/components.h"
-#include "ecs/zipper.h"
 #include "engine.h"
 #include "systems/systems.h"
 
 using namespace engn;
 
-void sys::server_bullet_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
-                        ecs::SparseArray<cpnt::Velocity> const& velocities,
-                        ecs::SparseArray<cpnt::Bullet> const& bullets) {
-    std::vector<ecs::Entity> to_kill;
+void sys::server_bullet_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform>& /*positions*/,
+                        ecs::SparseArray<cpnt::Velocity> const& /*velocities*/,
+                        ecs::SparseArray<cpnt::Bullet> const& /*bullets*/) {
     auto& reg = ctx.registry;
+    auto& commands = ctx.commands();
     float dt = ctx.delta_time;
 
-    for (auto [idx, pos_opt, vel_opt, bullet_opt] : ecs::indexed_zipper(positions, velocities, bullets)) {
-        if (pos_opt && vel_opt && bullet_opt) {
-            auto entity = reg.entity_from_index(idx);
-            auto& pos = reg.get_components<cpnt::Transform>()[idx];
+    // Transform, Velocity and Bullet are owned by this group: members are packed at the front of the three pools.
+    // The scene loader creates it, so this is a lookup that other parallel systems may do concurrently.
+    // Only Transform is handed out non-const, so the group stamps it alone.
+    for (auto [entity, pos, vel, bullet] : reg.group<cpnt::Transform, cpnt::Velocity const, cpnt::Bullet const>()) {
+        pos.x += vel.vx * dt;
+        pos.y += vel.vy * dt;
 
-            if (pos && vel_opt) {
-                reg.mark_dirty<cpnt::Transform>(entity);
-                pos->x += vel_opt->vx * dt;
-                pos->y += vel_opt->vy * dt;
-
-                // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access)
-                if (pos->x > ctx.window_size.x || pos->x < 0 || pos->y > ctx.window_size.y || pos->y < 0) {
-                    to_kill.push_back(entity);
-                }
-                // NOLINTEND(cppcoreguidelines-pro-type-union-access)
-            }
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access)
+        if (pos.x > ctx.window_size.x || pos.x < 0 || pos.y > ctx.window_size.y || pos.y < 0) {
+            commands.kill(entity);
         }
-    }
-
-    for (auto e : to_kill) {
-        reg.kill_entity(e);
+        // NOLINTEND(cppcoreguidelines-pro-type-union-access)
     }
 }
@@ -1,58 +1,31 @@
 #include "components/components.h"
-#include "ecs/zipper.h"
 #include "engine.h"
+#include "kernels/movement_kernels.h"
 #include "systems/systems.h"
 
-#include <cmath>
-
 using namespace engn;
 
-namespace {
-constexpr float k_pi = 3.14159f;
-constexpr float k_two_pi = 2.0f * k_pi;
-constexpr float k_zigzag_period = 2.0f;
-constexpr float k_dive_amplitude_multiplier = 2.0f;
-} // namespace
-
-void sys::server_enemy_movement_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
-    ecs::SparseArray<cpnt::MovementPattern> const& patterns,
-    ecs::SparseArray<cpnt::Velocity> const& velocity) {
+void sys::server_enemy_movement_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& /*positions*/,
+    ecs::SparseArray<cpnt::MovementPattern>& /*patterns*/,
+    ecs::SparseArray<cpnt::Velocity>& /*velocity*/) {
     // LOG_DEBUG("Running server_enemy_movement_system");
     auto& reg = ctx.registry;
     float dt = ctx.delta_time;
-
-    for (auto [idx, pos_opt, pat_opt] : ecs::indexed_zipper(positions, patterns)) {
-        if (!pos_opt || !pat_opt)
-            continue;
-
-        auto& pat = reg.get_components<cpnt::MovementPattern>()[idx].value();
-        auto& vel = reg.get_components<cpnt::Velocity>()[idx].value();
-
+    auto const& kernels = simd::movement_kernels();
+    simd::PatternBatch batch;
+
+    // Transform and Velocity are owned by the bullet group: this one owns MovementPattern and looks the others up.
+    // Both groups are created by the scene loader; creating one here would race with the other parallel systems.
+    // MovementPattern and Velocity are handed out non-const, so the group stamps them.
+    for (auto [entity, pat, pos, vel] :
+         reg.group<cpnt::MovementPattern>(ecs::Get<cpnt::Transform const, cpnt::Velocity>{})) {
         pat.timer += dt;
-        reg.mark_dirty<cpnt::MovementPattern>(reg.entity_from_index(idx));
-
         vel.vx = -(pat.speed * dt); // consistent motion
-        reg.mark_dirty<cpnt::Velocity>(reg.entity_from_index(idx));
-
-        switch (pat.type) {
-            case cpnt::MovementPattern::PatternType::Sine: {
-                vel.vy = std::sin(pat.timer * pat.frequency * k_two_pi) * pat.amplitude;
-                break;
-            }
-
-            case cpnt::MovementPattern::PatternType::ZigZag: {
-                float phase = std::fmod(pat.timer * pat.frequency, k_zigzag_period);
-                int dir = (phase < 1.f) ? 1 : -1;
-                vel.vy = static_cast<float>(dir) * pat.amplitude;
-                break;
-            }
-
-            case cpnt::MovementPattern::PatternType::Straight:
-                break;
 
-            case cpnt::MovementPattern::PatternType::Dive:
-                vel.vy = std::sin(pat.timer * pat.frequency * k_two_pi) * (pat.amplitude * k_dive_amplitude_multiplier);
-                break;
-        }
+        // vy is evaluated by pattern type once the batch is full
+        batch.add(pat, vel);
+        if (batch.full())
+            batch.flush(kernels);
     }
+    batch.flush(kernels);
 }
@@ -1,5 +1,4 @@
 #include "components/components.h"
-#include "ecs/zipper.h"
 #include "engine.h"
 #include "raylib.h"
 #include "systems/systems.h"
@@ -13,38 +12,27 @@ constexpr float k_spawn_multiplier = 1.5f;
 } // namespace
 
 void sys::server_enemy_system(EngineContext& ctx,
-    ecs::SparseArray<cpnt::Transform> const& positions,
-    ecs::SparseArray<cpnt::Velocity> const& velocities,
-    ecs::SparseArray<cpnt::Enemy> const& enemies,
-    ecs::SparseArray<cpnt::Health> const& healths) {
+    ecs::SparseArray<cpnt::Transform>& /*positions*/,
+    ecs::SparseArray<cpnt::Velocity> const& /*velocities*/,
+    ecs::SparseArray<cpnt::Enemy> const& /*enemies*/,
+    ecs::SparseArray<cpnt::Health>& /*healths*/) {
     // LOG_DEBUG("Running server_enemy_system");
     auto& reg = ctx.registry;
 
-    for (auto [idx, pos_opt, vel_opt, enemy_opt, health_opt] :
-         ecs::indexed_zipper(positions, velocities, enemies, healths)) {
-        if (pos_opt && vel_opt && enemy_opt && health_opt) {
-            auto& pos = reg.get_components<cpnt::Transform>()[idx];
-            auto& health = reg.get_components<cpnt::Health>()[idx];
-            auto& vel = reg.get_components<cpnt::Velocity>()[idx];
-
-            if (pos && vel_opt) {
-                reg.mark_dirty<cpnt::Transform>(reg.entity_from_index(idx));
-                pos->x += vel_opt->vx;
-                pos->y += vel_opt->vy;
-                // Respawn if off screen or dead
-                if (pos->x < k_offscreen_left || (health && health->hp <= 0)) {
-                    // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access)
-                    pos->x =
-                        static_cast<float>(GetRandomValue(static_cast<int>(ctx.window_size.x),
-                                                          static_cast<int>(ctx.window_size.x * k_spawn_multiplier)));
-                    pos->y = static_cast<float>(
-                        GetRandomValue(k_spawn_margin, static_cast<int>(ctx.window_size.y) - k_spawn_margin));
-                    // NOLINTEND(cppcoreguidelines-pro-type-union-access)
-                    if (health) {
-                        health->hp = health->max_hp;
-                    }
-                }
-            }
+    // Transform is stamped by the view; Health is only stamped by `patch` when an enemy respawns
+    for (auto [entity, pos, vel, enemy, health] :
+         reg.view<cpnt::Transform, cpnt::Velocity const, cpnt::Enemy const, cpnt::Health const>()) {
+        pos.x += vel.vx;
+        pos.y += vel.vy;
+        // Respawn if off screen or dead
+        if (pos.x < k_offscreen_left || health.hp <= 0) {
+            // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access)
+            pos.x = static_cast<float>(GetRandomValue(static_cast<int>(ctx.window_size.x),
+                                                      static_cast<int>(ctx.window_size.x * k_spawn_multiplier)));
+            pos.y = static_cast<float>(
+                GetRandomValue(k_spawn_margin, static_cast<int>(ctx.window_size.y) - k_spawn_margin));
+            // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+            reg.patch<cpnt::Health>(entity, [](cpnt::Health& respawned) { respawned.hp = respawned.max_hp; });
         }
     }
 }
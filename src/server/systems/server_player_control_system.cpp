@@ -1,5 +1,4 @@
 #include "components/components.h"
-#include "ecs/zipper.h"
 #include "engine.h"
 #include "raylib.h"
 #include "systems/systems.h"
@@ -28,109 +27,101 @@ constexpr float k_bullet_scale = 2.0f;
 constexpr float k_shoot_cooldown = 0.2f; // 0.2 seconds between shots
 
 void sys::server_player_control_system(EngineContext& ctx,
-    ecs::SparseArray<cpnt::Transform> const& positions,
-    ecs::SparseArray<cpnt::Player> const& players,
-    ecs::SparseArray<cpnt::Velocity> const& velocities) {
+    ecs::SparseArray<cpnt::Transform>& /*positions*/,
+    ecs::SparseArray<cpnt::Player>& /*players*/,
+    ecs::SparseArray<cpnt::Velocity>& /*velocities*/) {
     // LOG_DEBUG("Running server_player_control_system");
-    auto& reg = ctx.registry;
     float dt = ctx.delta_time;
+    auto& reg = ctx.registry;
+
+    // The view stamps Transform and Player as it hands them out, so the moves are replicated
+    for (auto [entity, pos, player] : reg.view<cpnt::Transform, cpnt::Player>()) {
+        // Convert player ID to endpoint
+        auto endpoint_it = ctx.player_id_to_endpoint.find(player.id);
+        if (endpoint_it == ctx.player_id_to_endpoint.end())
+            continue; // Player ID not mapped to endpoint
+
+        auto& endpoint = endpoint_it->second;
+
+        std::lock_guard<std::mutex> lock(ctx.player_input_queues_mutex);
+        auto queue_it = ctx.player_input_queues.find(endpoint);
 
-    for (auto [idx, pos_opt, player_opt, vel_opt] : ecs::indexed_zipper(positions, players, velocities)) {
-
-        auto& pos = reg.get_components<cpnt::Transform>()[idx];
-
-        if (pos_opt && player_opt) {
-            auto& vel = reg.get_components<cpnt::Velocity>()[idx];
-            auto& player = reg.get_components<cpnt::Player>()[idx];
-
-            if (pos && player) {
-                // Convert player ID to endpoint
-                auto endpoint_it = ctx.player_id_to_endpoint.find(player->id);
-                if (endpoint_it == ctx.player_id_to_endpoint.end())
-                    continue; // Player ID not mapped to endpoint
-
-                auto& endpoint = endpoint_it->second;
-
-                std::lock_guard<std::mutex> lock(ctx.player_input_queues_mutex);
-                auto queue_it = ctx.player_input_queues.find(endpoint);
-
-                if (queue_it == ctx.player_input_queues.end())
-                    continue; // No input for this player
-
-                auto &input_queue = queue_it->second;
-
-                float move_x = 0.0f;
-                float move_y = 0.0f;
-                bool shoot_pressed = false;
-
-                input_queue.for_each<evts::KeyHold>([&](const evts::KeyHold& key_hold) {
-                    if (key_hold.keycode == ctx.controls.move_up.primary) {
-                        move_y = -1.0f;
-                    }
-                    if (key_hold.keycode == ctx.controls.move_down.primary) {
-                        move_y = 1.0f;
-                    }
-                    if (key_hold.keycode == ctx.controls.move_left.primary) {
-                        move_x = -1.0f;
-                    }
-                    if (key_hold.keycode == ctx.controls.move_right.primary) {
-                        move_x = 1.0f;
-                    }
-                    if (key_hold.keycode == ctx.controls.shoot.primary) {
-                        shoot_pressed = true;
-                    }
-                });
-
-                input_queue.clear();
-
-                // Update shoot cooldown
-                if (player->shoot_cooldown > 0.0f) {
-                    player->shoot_cooldown -= dt;
-                }
-
-                pos->x += k_player_speed * dt * move_x;
-                pos->y += k_player_speed * dt * move_y;
-                ctx.registry.mark_dirty<cpnt::Transform>(ctx.registry.entity_from_index(idx));
-
-                // Clamp position
-                // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access)
-                if (pos->x >= ctx.window_size.x - k_player_width)
-                    pos->x = ctx.window_size.x - k_player_width;
-                if (pos->x <= 0)
-                    pos->x = 0;
-                if (pos->y >= ctx.window_size.y - k_player_height)
-                    pos->y = ctx.window_size.y - k_player_height;
-                if (pos->y <= 0)
-                    pos->y = 0;
-                // NOLINTEND(cppcoreguidelines-pro-type-union-access)
-
-                // Rotation based on movement
-                if (vel) {
-                    ctx.registry.mark_dirty<cpnt::Velocity>(ctx.registry.entity_from_index(idx));
-                    if (move_x < 0.0f) {
-                        vel->vrz = -k_rotation_speed;
-                    } else if (move_x > 0.0f) {
-                        vel->vrz = k_rotation_speed;
-                    } else {
-                        vel->vrz = 0.0f;
-                    }
-                }
-
-                // Shoot (only if cooldown expired)
-                if (shoot_pressed && player->shoot_cooldown <= 0.0f) {
-                    auto bullet = reg.spawn_entity();
-                    reg.add_component(bullet, cpnt::Transform{pos->x + k_bullet_offset_x, pos->y + k_bullet_offset_y,
-                                                              0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f});
-                    reg.add_component(bullet, cpnt::Velocity{k_bullet_speed, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f});
-                    reg.add_component(bullet, cpnt::Bullet{});
-                    reg.add_component(bullet, cpnt::Hitbox{20.0f, 20.0f, k_bullet_width, k_bullet_height}); // NOLINT(cppcoreguidelines-avoid-magic-numbers,-warnings-as-errors)
-                    reg.add_component(bullet, cpnt::Replicated{static_cast<std::uint32_t>(bullet)});
-                    reg.add_component(bullet, cpnt::EntityType{"bullet"});
-                    
-                    // Reset cooldown
-                    player->shoot_cooldown = k_shoot_cooldown;
-                }
+        if (queue_it == ctx.player_input_queues.end())
+            continue; // No input for this player
+
+        auto &input_queue = queue_it->second;
+
+        float move_x = 0.0f;
+        float move_y = 0.0f;
+        bool shoot_pressed = false;
+
+        input_queue.for_each<evts::KeyHold>([&](const evts::KeyHold& key_hold) {
+            if (key_hold.keycode == ctx.controls.move_up.primary) {
+                move_y = -1.0f;
+            }
+            if (key_hold.keycode == ctx.controls.move_down.primary) {
+                move_y = 1.0f;
+            }
+            if (key_hold.keycode == ctx.controls.move_left.primary) {
+                move_x = -1.0f;
             }
+            if (key_hold.keycode == ctx.controls.move_right.primary) {
+                move_x = 1.0f;
+            }
+            if (key_hold.keycode == ctx.controls.shoot.primary) {
+                shoot_pressed = true;
+            }
+        });
+
+        input_queue.clear();
+
+        // Update shoot cooldown
+        if (player.shoot_cooldown > 0.0f) {
+            player.shoot_cooldown -= dt;
+        }
+
+        pos.x += k_player_speed * dt * move_x;
+        pos.y += k_player_speed * dt * move_y;
+
+        // Clamp position
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access)
+        if (pos.x >= ctx.window_size.x - k_player_width)
+            pos.x = ctx.window_size.x - k_player_width;
+        if (pos.x <= 0)
+            pos.x = 0;
+        if (pos.y >= ctx.window_size.y - k_player_height)
+            pos.y = ctx.window_size.y - k_player_height;
+        if (pos.y <= 0)
+            pos.y = 0;
+        // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+
+        // Rotation based on movement
+        if (reg.has_component<cpnt::Velocity>(entity)) {
+            float vrz = 0.0f;
+            if (move_x < 0.0f) {
+                vrz = -k_rotation_speed;
+            } else if (move_x > 0.0f) {
+                vrz = k_rotation_speed;
+            }
+            reg.patch<cpnt::Velocity>(entity, [vrz](cpnt::Velocity& vel) { vel.vrz = vrz; });
+        }
+
+        // Shoot (only if cooldown expired)
+        if (shoot_pressed && player.shoot_cooldown <= 0.0f) {
+            auto& commands = ctx.commands();
+            auto bullet = commands.spawn(cpnt::Transform{pos.x + k_bullet_offset_x, pos.y + k_bullet_offset_y,
+                                                         0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f},
+                                         cpnt::Velocity{k_bullet_speed, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+                                         cpnt::Bullet{});
+            commands.add(bullet, cpnt::Hitbox{20.0f, 20.0f, k_bullet_width, k_bullet_height}); // NOLINT(cppcoreguidelines-avoid-magic-numbers,-warnings-as-errors)
+            commands.add(bullet, cpnt::EntityType{"bullet"});
+            // The replication id is the entity handle, only known once the bullet exists
+            commands.on_spawned(bullet, [](ecs::Registry& registry, ecs::Entity e) {
+                registry.add_component(e, cpnt::Replicated{e.index(), e.generation()});
+            });
+            
+            // Reset cooldown
+            player.shoot_cooldown = k_shoot_cooldown;
         }
     }
 }
@@ -70,7 +70,7 @@ void sys::server_update_player_entities_system(EngineContext &ctx,
             ship_source_rect.height / 3,
             ship_source_rect.width / 3}
         );
-        ctx.registry.add_component(player, cpnt::Replicated{static_cast<std::uint32_t>(player)});
+        ctx.registry.add_component(player, cpnt::Replicated{player.index(), player.generation()});
         ctx.registry.add_component(player, cpnt::EntityType{"player"});
     }
 
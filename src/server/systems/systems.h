@@ -10,25 +10,25 @@ class EngineContext;
 namespace sys {
 
 void server_player_control_system(EngineContext& ctx,
-    ecs::SparseArray<cpnt::Transform> const& positions,
-    ecs::SparseArray<cpnt::Player> const& players,
-    ecs::SparseArray<cpnt::Velocity> const& velocities);
+    ecs::SparseArray<cpnt::Transform>& positions,
+    ecs::SparseArray<cpnt::Player>& players,
+    ecs::SparseArray<cpnt::Velocity>& velocities);
 
 void server_enemy_movement_system(EngineContext& ctx,
     ecs::SparseArray<cpnt::Transform> const& positions,
-    ecs::SparseArray<cpnt::MovementPattern> const& patterns,
-    ecs::SparseArray<cpnt::Velocity> const& velocity);
+    ecs::SparseArray<cpnt::MovementPattern>& patterns,
+    ecs::SparseArray<cpnt::Velocity>& velocity);
 
 void server_enemy_system(EngineContext& ctx,
-    ecs::SparseArray<cpnt::Transform> const& positions,
+    ecs::SparseArray<cpnt::Transform>& positions,
     ecs::SparseArray<cpnt::Velocity> const& velocities,
     ecs::SparseArray<cpnt::Enemy> const& enemies,
-    ecs::SparseArray<cpnt::Health> const& healths);
+    ecs::SparseArray<cpnt::Health>& healths);
 
 void server_update_player_entities_system(EngineContext &ctx,
     ecs::SparseArray<cpnt::Player> const& players);
 
-void server_bullet_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform> const& positions,
+void server_bullet_system(EngineContext& ctx, ecs::SparseArray<cpnt::Transform>& positions,
     ecs::SparseArray<cpnt::Velocity> const& velocities,
     ecs::SparseArray<cpnt::Bullet> const& bullets);
 
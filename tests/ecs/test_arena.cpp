@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "ecs/arena.h"
+#include "ecs/registry.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+struct ArenaPosition {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+    float x, y;
+};
+
+struct ArenaHealth {
+    int hp;
+};
+
+// Stand-in for a scene loader: a wave of entities added one by one
+void load_scene(ecs::Registry& registry, int count) {
+    for (int i = 0; i < count; i++) {
+        auto e = registry.spawn_entity();
+        registry.add_component(e, ArenaPosition{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0)
+            registry.add_component(e, ArenaHealth{i});
+    }
+}
+
+} // namespace
+
+TEST(Arena, BumpsAlignedAllocations) {
+    ecs::Arena arena(1024);
+
+    void* a = arena.allocate(3, 1);
+    void* b = arena.allocate(8, 8);
+    void* c = arena.allocate(64, 64);
+
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % 8, 0u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(c) % 64, 0u);
+    EXPECT_LT(a, b);
+    EXPECT_LT(b, c);
+    EXPECT_GE(arena.used(), 3u + 8u + 64u);
+    EXPECT_EQ(arena.upstream_allocations(), 1u);
+}
+
+TEST(Arena, ResetMergesBlocks) {
+    ecs::Arena arena(256);
+
+    for (int i = 0; i < 16; i++)
+        (void)arena.allocate(200, 8);
+    EXPECT_GT(arena.upstream_allocations(), 1u);
+    const std::size_t k_used = arena.used();
+
+    arena.reset(k_used);
+    EXPECT_EQ(arena.used(), 0u);
+    EXPECT_GE(arena.capacity(), k_used);
+
+    // The same allocations now fit in the merged block
+    const std::size_t k_allocations = arena.upstream_allocations();
+    for (int i = 0; i < 16; i++)
+        (void)arena.allocate(200, 8);
+    EXPECT_EQ(arena.upstream_allocations(), k_allocations);
+
+    // A single block large enough is rewound in place
+    arena.reset();
+    EXPECT_EQ(arena.upstream_allocations(), k_allocations);
+}
+
+TEST(Arena, SceneReloadStaysInTheArena) {
+    ecs::Arena arena;
+    ecs::CapacityHints hints;
+    std::size_t footprint = 0;
+
+    {
+        ecs::Registry registry(&arena);
+        load_scene(registry, 5000);
+        hints = registry.capacity_hints();
+        footprint = arena.used();
+    }
+    EXPECT_GE(hints.pools[ecs::component_id<ArenaPosition>()].count, 5000u);
+    EXPECT_GE(hints.entities, 5000u);
+
+    arena.reset(footprint);
+    const std::size_t k_allocations = arena.upstream_allocations();
+    {
+        ecs::Registry registry(&arena);
+        registry.reserve(hints);
+        load_scene(registry, 5000);
+
+        // Every array was allocated once, at its final size
+        auto reloaded = registry.capacity_hints();
+        EXPECT_EQ(reloaded.pools[ecs::component_id<ArenaPosition>()].count,
+                  hints.pools[ecs::component_id<ArenaPosition>()].count);
+        EXPECT_EQ(reloaded.entities, hints.entities);
+        EXPECT_LT(arena.used(), footprint);
+    }
+    EXPECT_EQ(arena.upstream_allocations(), k_allocations);
+}
+
+TEST(Arena, HintsMergeToTheLargest) {
+    ecs::CapacityHints a{10, 5, {{4, 8}}};
+    ecs::CapacityHints b{3, 20, {{6, 2}, {1, 1}}};
+
+    a.merge(b);
+    EXPECT_EQ(a.entities, 10u);
+    EXPECT_EQ(a.journal, 20u);
+    ASSERT_EQ(a.pools.size(), 2u);
+    EXPECT_EQ(a.pools[0].count, 6u);
+    EXPECT_EQ(a.pools[0].size, 8u);
+    EXPECT_EQ(a.pools[1].count, 1u);
+}
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include "ecs/atom.h"
+
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+TEST(Atom, EqualStringsShareAnAtom) {
+    ecs::Atom a{"atom_test_texture"};
+    ecs::Atom b{std::string{"atom_test_texture"}};
+    ecs::Atom c{std::string_view{"atom_test_other"}};
+
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_EQ(a.value(), b.value());
+    EXPECT_EQ(a.str(), "atom_test_texture");
+    EXPECT_EQ(c.str(), "atom_test_other");
+}
+
+TEST(Atom, DefaultIsTheEmptyString) {
+    ecs::Atom empty;
+
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.value(), 0u);
+    EXPECT_EQ(empty.str(), "");
+    EXPECT_EQ(ecs::Atom{""}, empty);
+}
+
+TEST(Atom, StringsStayInPlace) {
+    ecs::Atom first{"atom_test_stable"};
+    const char* data = first.str().data();
+
+    // Enough new strings to grow the interner tables several times
+    for (int i = 0; i < 10'000; i++)
+        (void)ecs::Atom{"atom_test_filler_" + std::to_string(i)};
+
+    EXPECT_EQ(first.str().data(), data);
+    EXPECT_EQ(data[first.str().size()], '\0');
+    EXPECT_EQ(ecs::Atom{"atom_test_stable"}, first);
+}
+
+TEST(Atom, ConcurrentInterningAgrees) {
+    constexpr int k_threads = 4;
+    constexpr int k_names = 1'000;
+    std::vector<std::vector<ecs::Atom>> atoms(k_threads);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < k_threads; t++) {
+        threads.emplace_back([&atoms, t] {
+            for (int i = 0; i < k_names; i++)
+                atoms[t].emplace_back("atom_test_concurrent_" + std::to_string(i));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    std::unordered_set<ecs::Atom> distinct(atoms[0].begin(), atoms[0].end());
+    EXPECT_EQ(distinct.size(), static_cast<std::size_t>(k_names));
+    for (int t = 1; t < k_threads; t++)
+        EXPECT_EQ(atoms[t], atoms[0]);
+}
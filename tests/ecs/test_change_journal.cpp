@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include "ecs/change_journal.h"
+#include "ecs/registry.h"
+
+#include <vector>
+
+namespace {
+
+using Op = ecs::ChangeJournal::Op;
+
+struct JournalPosition {
+    int x;
+};
+
+std::vector<Op> ops(std::span<ecs::ChangeJournal::Entry const> entries) {
+    std::vector<Op> result;
+    for (auto const& entry : entries)
+        result.push_back(entry.op);
+    return result;
+}
+
+} // namespace
+
+TEST(ChangeJournal, SinceIsARangeOfLaterVersions) {
+    ecs::ChangeJournal journal;
+    ecs::Registry registry;
+    auto e = registry.spawn_entity();
+
+    journal.record(1, e, Op::entity_created);
+    journal.record(2, e, Op::component_removed, 0);
+    journal.record(2, e, Op::component_removed, 1);
+    journal.record(4, e, Op::entity_destroyed);
+
+    EXPECT_EQ(journal.since(0).size(), 4);
+    EXPECT_EQ(journal.since(1).size(), 3);
+    EXPECT_EQ(journal.since(2).size(), 1);
+    EXPECT_EQ(journal.since(3).size(), 1);
+    EXPECT_TRUE(journal.since(4).empty());
+    EXPECT_EQ(ops(journal.since(1)), (std::vector<Op>{Op::component_removed, Op::component_removed, Op::entity_destroyed}));
+}
+
+TEST(ChangeJournal, RemovalsAreCoalescedPerVersion) {
+    ecs::ChangeJournal journal;
+    ecs::Registry registry;
+    auto e = registry.spawn_entity();
+
+    for (int i = 0; i < 10; i++)
+        journal.record(1, e, Op::component_removed, 0);
+    journal.record(1, e, Op::component_removed, 1);
+    EXPECT_EQ(journal.size(), 2);
+
+    // A new version records the removal again
+    journal.record(2, e, Op::component_removed, 0);
+    journal.record(2, e, Op::component_removed, 0);
+    EXPECT_EQ(journal.since(1).size(), 1);
+}
+
+TEST(ChangeJournal, RegistryJournalsOnlyActualRemovals) {
+    ecs::Registry registry;
+    registry.register_component<JournalPosition>();
+    auto e = registry.spawn_entity();
+    registry.set_current_version(2);
+
+    registry.remove_component<JournalPosition>(e);
+    EXPECT_TRUE(registry.get_change_journal().since(1).empty());
+
+    registry.add_component(e, JournalPosition{1});
+    registry.remove_component<JournalPosition>(e);
+    registry.add_component(e, JournalPosition{2});
+    registry.remove_component<JournalPosition>(e);
+    EXPECT_EQ(ops(registry.get_change_journal().since(1)), (std::vector<Op>{Op::component_removed}));
+}
+
+TEST(ChangeJournal, TrimDropsAcknowledgedEntries) {
+    ecs::ChangeJournal journal;
+    ecs::Registry registry;
+    auto e = registry.spawn_entity();
+
+    for (ecs::ChangeJournal::Version v = 1; v <= 100; v++)
+        journal.record(v, e, Op::component_removed, 0);
+
+    journal.trim(10);
+    EXPECT_EQ(journal.size(), 90);
+    EXPECT_EQ(journal.since(0).front().version, 11);
+    journal.trim(80);
+    EXPECT_EQ(journal.size(), 20);
+    EXPECT_EQ(journal.since(90).size(), 10);
+    journal.trim(100);
+    EXPECT_TRUE(journal.empty());
+
+    journal.record(101, e, Op::entity_destroyed);
+    EXPECT_EQ(journal.since(100).size(), 1);
+}
+
+TEST(ChangeJournal, RegistryJournalsBatchesInOrder) {
+    ecs::Registry registry;
+    registry.set_current_version(3);
+
+    auto entities = registry.spawn_entities(4);
+    registry.emplace_components<JournalPosition>(entities, 0);
+    registry.set_current_version(4);
+    registry.remove_component<JournalPosition>(entities[0]);
+    registry.kill_entities(entities);
+
+    auto changes = registry.get_change_journal().since(0);
+    ASSERT_EQ(changes.size(), 9);
+    EXPECT_EQ(changes[4].op, Op::component_removed);
+    EXPECT_EQ(changes[4].component, ecs::component_id<JournalPosition>());
+    for (std::size_t i = 0; i < 4; i++) {
+        EXPECT_EQ(changes[i].op, Op::entity_created);
+        EXPECT_EQ(changes[5 + i].op, Op::entity_destroyed);
+        EXPECT_EQ(changes[5 + i].entity, entities[i]);
+    }
+    EXPECT_EQ(registry.get_change_journal().since(3).size(), 5);
+}
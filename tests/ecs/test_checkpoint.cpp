@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include "ecs/registry.h"
+
+#include <vector>
+
+namespace {
+
+struct CkPosition {
+    int x;
+};
+
+struct CkVelocity {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+    int dx;
+};
+
+struct CkHealth {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+    int hp;
+};
+
+struct CkScore {
+    int points;
+};
+
+} // namespace
+
+TEST(RegistryCheckpoint, RestoresComponentValues) {
+    ecs::Registry registry;
+    auto e = registry.spawn_entity();
+    registry.add_component(e, CkPosition{1});
+    registry.add_component(e, CkVelocity{2});
+
+    auto checkpoint = registry.checkpoint();
+    EXPECT_TRUE(checkpoint.valid());
+    registry.get_component<CkPosition>(e).x = 10;
+    registry.patch<CkVelocity>(e, [](CkVelocity& v) { v.dx = 20; });
+
+    registry.restore(checkpoint);
+    EXPECT_EQ(registry.get_component<CkPosition>(e).x, 1);
+    EXPECT_EQ(registry.get_component<CkVelocity>(e).dx, 2);
+
+    // The checkpoint survives a restore
+    registry.get_component<CkPosition>(e).x = 30;
+    registry.restore(checkpoint);
+    EXPECT_EQ(registry.get_component<CkPosition>(e).x, 1);
+}
+
+TEST(RegistryCheckpoint, RollsBackSpawnsAndKills) {
+    ecs::Registry registry;
+    auto kept = registry.spawn_entity();
+    auto killed = registry.spawn_entity();
+    registry.add_component(kept, CkPosition{1});
+    registry.add_component(killed, CkPosition{2});
+    registry.add_component(killed, CkVelocity{3});
+
+    auto checkpoint = registry.checkpoint();
+    registry.kill_entity(killed);
+    auto spawned = registry.spawn_entities(3);
+    for (auto e : spawned)
+        registry.add_component(e, CkVelocity{4});
+    EXPECT_FALSE(registry.alive(killed));
+
+    registry.restore(checkpoint);
+    EXPECT_TRUE(registry.alive(kept));
+    EXPECT_TRUE(registry.alive(killed));
+    for (auto e : spawned)
+        EXPECT_FALSE(registry.alive(e));
+    EXPECT_EQ(registry.get_component<CkPosition>(killed).x, 2);
+    EXPECT_EQ(registry.get_component<CkVelocity>(killed).dx, 3);
+    EXPECT_EQ(registry.get_components<CkVelocity>().count(), 1);
+
+    // The recycled index is in use again: new ids are handed out as they were at the checkpoint
+    auto next = registry.spawn_entity();
+    EXPECT_EQ(next.index(), spawned[1].index());
+}
+
+TEST(RegistryCheckpoint, RollsBackPackedErase) {
+    ecs::Registry registry;
+    std::vector<ecs::Entity> entities;
+    for (int i = 0; i < 200; i++) {
+        entities.push_back(registry.spawn_entity());
+        registry.add_component(entities.back(), CkHealth{i});
+    }
+
+    auto checkpoint = registry.checkpoint();
+    for (int i = 0; i < 200; i += 3)
+        registry.remove_component<CkHealth>(entities[static_cast<std::size_t>(i)]);
+
+    registry.restore(checkpoint);
+    auto const& health = registry.get_components<CkHealth>();
+    ASSERT_EQ(health.count(), 200);
+    for (int i = 0; i < 200; i++) {
+        auto const& e = entities[static_cast<std::size_t>(i)];
+        ASSERT_TRUE(registry.has_component<CkHealth>(e));
+        EXPECT_EQ(registry.get_component<CkHealth>(e).hp, i);
+    }
+}
+
+TEST(RegistryCheckpoint, DroppingACheckpointKeepsTheOthers) {
+    ecs::Registry registry;
+    auto e = registry.spawn_entity();
+    registry.add_component(e, CkPosition{1});
+
+    auto first = registry.checkpoint();
+    registry.get_component<CkPosition>(e).x = 2;
+    {
+        auto second = registry.checkpoint();
+        registry.get_component<CkPosition>(e).x = 3;
+        auto third = registry.checkpoint();
+        registry.get_component<CkPosition>(e).x = 4;
+
+        registry.restore(third);
+        EXPECT_EQ(registry.get_component<CkPosition>(e).x, 3);
+        second = ecs::Checkpoint{};
+        registry.get_component<CkPosition>(e).x = 5;
+    }
+
+    registry.restore(first);
+    EXPECT_EQ(registry.get_component<CkPosition>(e).x, 1);
+}
+
+TEST(RegistryCheckpoint, RestoringAnOlderCheckpointDropsNewerOnes) {
+    ecs::Registry registry;
+    ecs::Registry other;
+    auto e = registry.spawn_entity();
+    registry.add_component(e, CkPosition{1});
+
+    auto first = registry.checkpoint();
+    registry.get_component<CkPosition>(e).x = 2;
+    auto second = registry.checkpoint();
+
+    registry.restore(first);
+    EXPECT_THROW(registry.restore(second), std::invalid_argument);
+    EXPECT_THROW(other.restore(first), std::invalid_argument);
+    EXPECT_EQ(registry.get_component<CkPosition>(e).x, 1);
+}
+
+TEST(RegistryCheckpoint, EmptiesPoolsRegisteredAfterwards) {
+    ecs::Registry registry;
+    auto e = registry.spawn_entity();
+
+    auto checkpoint = registry.checkpoint();
+    registry.add_component(e, CkScore{7});
+
+    registry.restore(checkpoint);
+    EXPECT_FALSE(registry.has_component<CkScore>(e));
+    registry.add_component(e, CkScore{8});
+    registry.restore(checkpoint);
+    EXPECT_FALSE(registry.has_component<CkScore>(e));
+}
+
+TEST(RegistryCheckpoint, KeepsGroupsConsistent) {
+    ecs::Registry registry;
+    auto group = registry.group<CkVelocity, CkHealth>();
+    std::vector<ecs::Entity> entities;
+    for (int i = 0; i < 100; i++) {
+        entities.push_back(registry.spawn_entity());
+        registry.add_component(entities.back(), CkVelocity{i});
+        if (i % 2 == 0)
+            registry.add_component(entities.back(), CkHealth{i});
+    }
+    ASSERT_EQ(group.size(), 50);
+
+    auto checkpoint = registry.checkpoint();
+    for (int i = 1; i < 100; i += 2)
+        registry.add_component(entities[static_cast<std::size_t>(i)], CkHealth{i});
+    registry.kill_entity(entities[0]);
+    EXPECT_EQ(group.size(), 99);
+
+    registry.restore(checkpoint);
+    EXPECT_EQ(group.size(), 50);
+    std::size_t visited = 0;
+    for (auto [e, velocity, health] : group) {
+        EXPECT_EQ(velocity.dx, health.hp);
+        EXPECT_EQ(velocity.dx % 2, 0);
+        visited++;
+    }
+    EXPECT_EQ(visited, 50);
+}
+
+TEST(SparseArrayCheckpoint, SavesOnlyWrittenPages) {
+    ecs::SparseArray<CkPosition> array;
+    for (int i = 0; i < 1000; i++)
+        array.insert_at(static_cast<std::size_t>(i), CkPosition{i});
+
+    auto undo = array.checkpoint();
+    EXPECT_EQ(undo->data.page_count(), 0);
+    array[3]->x = -1;
+    array[5]->x = -1;
+    array[700]->x = -1;
+    array.insert_at(1200, CkPosition{0});
+    EXPECT_EQ(undo->data.page_count(), 2);
+
+    array.restore(*undo);
+    EXPECT_EQ(array.size(), 1000);
+    EXPECT_EQ(array[3]->x, 3);
+    EXPECT_EQ(array[700]->x, 700);
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include "ecs/command_buffer.h"
+#include "ecs/registry.h"
+#include "ecs/thread_pool.h"
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+namespace {
+
+struct CmdPosition {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+    int x;
+};
+
+struct CmdHealth {
+    int hp;
+};
+
+struct CmdId {
+    std::size_t id;
+};
+
+} // namespace
+
+TEST(CommandBuffer, NothingHappensBeforeApply) {
+    ecs::Registry registry;
+    ecs::CommandBuffer commands;
+    registry.register_component<CmdHealth>();
+    auto e = registry.spawn_entity();
+    registry.add_component(e, CmdPosition{1});
+
+    commands.spawn(CmdPosition{2});
+    commands.add(e, CmdHealth{3});
+    commands.kill(e);
+    EXPECT_FALSE(commands.empty());
+    EXPECT_EQ(registry.get_components<CmdPosition>().count(), 1);
+    EXPECT_FALSE(registry.get_components<CmdHealth>().contains(e.value()));
+
+    commands.apply(registry);
+    EXPECT_TRUE(commands.empty());
+    EXPECT_FALSE(registry.get_components<CmdPosition>().contains(e.value()));
+    EXPECT_FALSE(registry.get_components<CmdHealth>().contains(e.value()));
+    EXPECT_EQ(registry.get_components<CmdPosition>().count(), 1);
+}
+
+TEST(CommandBuffer, SpawnedEntitiesGetTheirComponents) {
+    ecs::Registry registry;
+    ecs::CommandBuffer commands;
+
+    auto a = commands.spawn(CmdPosition{10}, CmdHealth{1});
+    auto b = commands.spawn();
+    commands.add(b, CmdPosition{20});
+    commands.on_spawned(b, [](ecs::Registry& reg, ecs::Entity e) { reg.add_component(e, CmdId{e.value()}); });
+    (void)a;
+    commands.apply(registry);
+
+    std::vector<int> xs;
+    for (auto [e, pos] : registry.view<CmdPosition>())
+        xs.push_back(pos.x);
+    EXPECT_EQ(xs, (std::vector<int>{10, 20}));
+    EXPECT_EQ(registry.get_components<CmdHealth>().count(), 1);
+    for (auto [e, id] : registry.view<CmdId>())
+        EXPECT_EQ(id.id, e.value());
+}
+
+TEST(CommandBuffer, RecordWhileIterating) {
+    ecs::Registry registry;
+    ecs::CommandBuffer commands;
+
+    for (int i = 0; i < 100; i++)
+        registry.add_component(registry.spawn_entity(), CmdPosition{i});
+
+    for (auto [e, pos] : registry.view<CmdPosition>()) {
+        if (pos.x % 2 == 0) {
+            commands.kill(e);
+            commands.kill(e);
+        } else {
+            commands.spawn(CmdPosition{-pos.x});
+        }
+    }
+    commands.apply(registry);
+
+    int negative = 0;
+    for (auto [e, pos] : registry.view<CmdPosition>()) {
+        EXPECT_NE(pos.x % 2, 0);
+        negative += pos.x < 0;
+    }
+    EXPECT_EQ(negative, 50);
+    EXPECT_EQ(registry.get_components<CmdPosition>().count(), 100);
+}
+
+TEST(CommandBuffer, RemoveMissingComponentIsIgnored) {
+    ecs::Registry registry;
+    ecs::CommandBuffer commands;
+    auto e = registry.spawn_entity();
+    registry.add_component(e, CmdHealth{1});
+    registry.register_component<CmdPosition>();
+
+    commands.remove<CmdPosition>(e);
+    commands.remove<CmdHealth>(e);
+    commands.apply(registry);
+    EXPECT_FALSE(registry.has_component<CmdHealth>(e));
+}
+
+TEST(CommandBuffer, CommandsOnDeadEntitiesAreDropped) {
+    ecs::Registry registry;
+    ecs::CommandBuffer commands;
+    auto stale = registry.spawn_entity();
+    commands.add(stale, CmdHealth{1});
+    commands.remove<CmdHealth>(stale);
+    registry.kill_entity(stale);
+    auto e = registry.spawn_entity();
+    ASSERT_EQ(e.index(), stale.index());
+    registry.add_component(e, CmdHealth{2});
+
+    commands.apply(registry);
+    ASSERT_TRUE(registry.has_component<CmdHealth>(e));
+    EXPECT_EQ(registry.get_component<CmdHealth>(e).hp, 2);
+}
+
+TEST(ThreadCommandBuffers, OneBufferPerThread) {
+    ecs::Registry registry;
+    ecs::ThreadCommandBuffers buffers;
+    ecs::ThreadPool pool(3);
+
+    EXPECT_EQ(&buffers.local(), &buffers.local());
+    pool.parallel_for(1000, 10, [&buffers](std::size_t begin, std::size_t end) {
+        auto& commands = buffers.local();
+        for (std::size_t i = begin; i < end; i++)
+            commands.spawn(CmdId{i});
+    });
+    buffers.apply(registry);
+
+    std::vector<bool> seen(1000, false);
+    for (auto [e, id] : registry.view<CmdId>())
+        seen[id.id] = true;
+    EXPECT_EQ(std::count(seen.begin(), seen.end(), true), 1000);
+}
+
+TEST(ThreadCommandBuffers, CachedBufferBelongsToItsOwner) {
+    std::optional<ecs::ThreadCommandBuffers> first(std::in_place);
+    ecs::ThreadCommandBuffers second;
+
+    auto* first_buffer = &first->local();
+    EXPECT_NE(&second.local(), first_buffer);
+    EXPECT_EQ(&first->local(), first_buffer);
+
+    // A new instance in the same storage must not reuse the cached buffer of the old one
+    first_buffer->spawn(CmdId{0});
+    first.emplace();
+    EXPECT_TRUE(first->local().empty());
+}
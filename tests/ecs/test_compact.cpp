@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include "ecs/registry.h"
+
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+struct CmpPosition {
+    int x;
+};
+
+struct CmpHealth {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+    int hp;
+};
+
+struct CmpShield {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+    int hp;
+};
+
+// Spawn a burst of `count` entities and keep one in `keep`.
+std::vector<ecs::Entity> burst(ecs::Registry& registry, int count, int keep) {
+    std::vector<ecs::Entity> kept;
+    for (int i = 0; i < count; i++) {
+        auto e = registry.spawn_entity();
+        registry.add_component(e, CmpPosition{i});
+        registry.add_component(e, CmpHealth{i});
+        if (i % keep == 0)
+            kept.push_back(e);
+        else
+            registry.kill_entity(e);
+    }
+    return kept;
+}
+
+} // namespace
+
+TEST(RegistryCompact, RenumbersLivingEntitiesIntoADensePrefix) {
+    ecs::Registry registry;
+    auto kept = burst(registry, 1000, 10);
+
+    auto report = registry.compact();
+    EXPECT_EQ(report.entities, 100);
+    EXPECT_LT(report.bytes_after, report.bytes_before);
+    EXPECT_EQ(report.bytes_after, registry.memory_usage());
+    EXPECT_LE(registry.get_components<CmpPosition>().size(), 100);
+    EXPECT_LE(registry.get_components<CmpHealth>().size(), 100);
+
+    for (std::size_t i = 0; i < kept.size(); i++) {
+        auto e = report.remap.apply(kept[i]);
+        EXPECT_EQ(e.index(), i);
+        ASSERT_TRUE(registry.alive(e));
+        EXPECT_EQ(registry.get_component<CmpPosition>(e).x, static_cast<int>(i * 10));
+        EXPECT_EQ(registry.get_component<CmpHealth>(e).hp, static_cast<int>(i * 10));
+        // The old handle of a renumbered entity is stale, even if its index is in use again
+        if (e != kept[i]) {
+            EXPECT_FALSE(registry.alive(kept[i]));
+        }
+    }
+
+    // New entities come right after the prefix
+    EXPECT_EQ(registry.spawn_entity().index(), 100);
+}
+
+TEST(RegistryCompact, KilledHandlesStayStale) {
+    ecs::Registry registry;
+    std::vector<ecs::Entity> killed;
+    for (int i = 0; i < 10; i++)
+        killed.push_back(registry.spawn_entity());
+    auto survivor = registry.spawn_entity();
+    registry.kill_entities(killed);
+
+    auto report = registry.compact();
+    ASSERT_EQ(report.remap.moves().size(), 1);
+    EXPECT_EQ(report.remap.moves()[0].from, survivor);
+
+    for (int i = 0; i < 20; i++)
+        registry.spawn_entity();
+    for (auto e : killed)
+        EXPECT_FALSE(registry.alive(e));
+    EXPECT_FALSE(registry.alive(survivor));
+    EXPECT_TRUE(registry.alive(report.remap.apply(survivor)));
+}
+
+TEST(RegistryCompact, RemapsTagsAndNotifiesSubscribers) {
+    ecs::Registry registry;
+    auto dead = registry.spawn_entity();
+    auto player = registry.spawn_entity();
+    registry.get_tag_registry().create_and_bind_tag("player", player);
+    registry.kill_entity(dead);
+
+    ecs::Entity cached = player;
+    registry.on_compact([&cached](ecs::Registry&, ecs::EntityRemap const& remap) { cached = remap.apply(cached); });
+    registry.compact();
+
+    EXPECT_EQ(cached.index(), 0);
+    EXPECT_TRUE(registry.alive(cached));
+    EXPECT_EQ(registry.get_tag_registry().get_entity("player"), cached);
+    EXPECT_EQ(registry.get_tag_registry().get_tag_name(cached), "player");
+}
+
+TEST(RegistryCompact, JournalsMovesAndStampsComponents) {
+    ecs::Registry registry;
+    auto dead = registry.spawn_entity();
+    auto moved = registry.spawn_entity();
+    registry.add_component(moved, CmpPosition{7});
+    registry.kill_entity(dead);
+    registry.set_current_version(5);
+
+    auto report = registry.compact();
+    auto now = report.remap.apply(moved);
+    auto changes = registry.get_change_journal().since(4);
+    ASSERT_EQ(changes.size(), 2);
+    EXPECT_EQ(changes[0].op, ecs::ChangeJournal::Op::entity_destroyed);
+    EXPECT_EQ(changes[0].entity, moved);
+    EXPECT_EQ(changes[1].op, ecs::ChangeJournal::Op::entity_created);
+    EXPECT_EQ(changes[1].entity, now);
+    EXPECT_EQ(registry.get_components<CmpPosition>().version(now.index()), 5);
+}
+
+TEST(RegistryCompact, KeepsGroupsValid) {
+    ecs::Registry registry;
+    auto group = registry.group<CmpHealth, CmpShield>();
+    std::vector<ecs::Entity> entities;
+    for (int i = 0; i < 300; i++) {
+        entities.push_back(registry.spawn_entity());
+        registry.add_component(entities.back(), CmpHealth{i});
+        if (i % 3 == 0)
+            registry.add_component(entities.back(), CmpShield{i});
+    }
+    for (int i = 0; i < 300; i += 2)
+        registry.kill_entity(entities[static_cast<std::size_t>(i)]);
+    const auto k_members = group.size();
+
+    registry.compact();
+    EXPECT_EQ(group.size(), k_members);
+    for (auto [e, health, shield] : group) {
+        EXPECT_TRUE(registry.alive(e));
+        EXPECT_EQ(health.hp, shield.hp);
+        EXPECT_EQ(registry.get_component<CmpHealth>(e).hp, health.hp);
+    }
+}
+
+TEST(RegistryCompact, RefusesWhileACheckpointIsHeld) {
+    ecs::Registry registry;
+    registry.spawn_entity();
+    auto checkpoint = registry.checkpoint();
+
+    EXPECT_THROW(registry.compact(), std::logic_error);
+    checkpoint = ecs::Checkpoint{};
+    EXPECT_NO_THROW(registry.compact());
+}
@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+#include "ecs/registry.h"
+
+#include <atomic>
+#include <set>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+struct GroupPosition {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+    int x;
+};
+
+struct GroupVelocity {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+    int dx;
+};
+
+struct GroupTag {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+};
+
+struct GroupHealth {
+    int hp;
+};
+
+// Every member sits at the same position at the front of each owned pool.
+template <typename TGroup> void expect_packed_prefix(ecs::Registry& registry, TGroup const& group) {
+    auto const& positions = registry.get_components<GroupPosition>();
+    auto const& velocities = registry.get_components<GroupVelocity>();
+
+    for (std::size_t pos = 0; pos < group.size(); pos++) {
+        EXPECT_EQ(positions.indices()[pos], velocities.indices()[pos]);
+        EXPECT_TRUE(group.contains(positions.indices()[pos]));
+    }
+    for (std::size_t pos = group.size(); pos < positions.count(); pos++)
+        EXPECT_FALSE(group.contains(positions.indices()[pos]));
+}
+
+} // namespace
+
+TEST(RegistryGroup, MembershipFollowsComponents) {
+    ecs::Registry registry;
+    auto group = registry.group<GroupPosition, GroupVelocity>();
+    std::vector<ecs::Entity> entities;
+
+    for (int i = 0; i < 10; i++) {
+        auto e = registry.spawn_entity();
+        registry.add_component(e, GroupPosition{i});
+        if (i % 2 == 0)
+            registry.add_component(e, GroupVelocity{1});
+        entities.push_back(e);
+    }
+    EXPECT_EQ(group.size(), 5);
+    expect_packed_prefix(registry, group);
+
+    registry.remove_component<GroupVelocity>(entities[4]);
+    registry.kill_entity(entities[0]);
+    registry.add_component(entities[3], GroupVelocity{1});
+    EXPECT_EQ(group.size(), 4);
+    expect_packed_prefix(registry, group);
+
+    std::set<int> seen;
+    for (auto [e, pos, vel] : group) {
+        pos.x += vel.dx * 100;
+        seen.insert(pos.x);
+    }
+    EXPECT_EQ(seen, (std::set<int>{102, 103, 106, 108}));
+    EXPECT_EQ(registry.get_components<GroupPosition>()[entities[3].value()]->x, 103);
+    EXPECT_EQ(registry.get_components<GroupPosition>()[entities[5].value()]->x, 5);
+}
+
+TEST(RegistryGroup, CreatedOverExistingEntities) {
+    ecs::Registry registry;
+
+    for (int i = 0; i < 6; i++) {
+        auto e = registry.spawn_entity();
+        registry.add_component(e, GroupPosition{i});
+        registry.add_component(e, GroupVelocity{i});
+        if (i >= 3)
+            registry.add_component(e, GroupTag{});
+    }
+
+    auto group = registry.group<GroupPosition, GroupVelocity, GroupTag>();
+    EXPECT_EQ(group.size(), 3);
+    expect_packed_prefix(registry, group);
+    for (auto [e, pos, vel, tag] : group)
+        EXPECT_EQ(pos.x, vel.dx);
+
+    // Asking again hands out the same group
+    EXPECT_EQ((registry.group<GroupPosition, GroupVelocity, GroupTag>().size()), 3);
+}
+
+TEST(RegistryGroup, AddComponentReturnsMovedSlot) {
+    ecs::Registry registry;
+    auto group = registry.group<GroupPosition, GroupVelocity>();
+
+    auto a = registry.spawn_entity();
+    auto b = registry.spawn_entity();
+    registry.add_component(a, GroupPosition{1});
+    registry.add_component(b, GroupPosition{2});
+    registry.add_component(b, GroupVelocity{0});
+
+    // b was swapped in front of a: the returned slot must still be b's
+    auto& slot = registry.add_component(b, GroupPosition{20});
+    EXPECT_EQ(slot->x, 20);
+    EXPECT_EQ(registry.get_components<GroupPosition>()[a.value()]->x, 1);
+    EXPECT_EQ(group.size(), 1);
+}
+
+TEST(RegistryGroup, PartialOwnership) {
+    ecs::Registry registry;
+    auto owning = registry.group<GroupPosition, GroupVelocity>();
+    auto partial = registry.group<GroupTag>(ecs::Get<GroupPosition, GroupHealth>{});
+
+    auto a = registry.spawn_entity();
+    auto b = registry.spawn_entity();
+    registry.add_component(a, GroupTag{});
+    registry.add_component(a, GroupPosition{7});
+    registry.add_component(a, GroupHealth{3});
+    registry.add_component(b, GroupTag{});
+    registry.add_component(b, GroupPosition{8});
+    registry.add_component(b, GroupVelocity{1});
+
+    EXPECT_EQ(owning.size(), 1);
+    EXPECT_EQ(partial.size(), 1);
+    for (auto [e, tag, pos, health] : partial) {
+        EXPECT_EQ(e, a);
+        EXPECT_EQ(pos.x, 7);
+        health.hp--;
+    }
+    EXPECT_EQ(registry.get_components<GroupHealth>()[a.value()]->hp, 2);
+
+    registry.remove_component<GroupHealth>(a);
+    EXPECT_EQ(partial.size(), 0);
+}
+
+TEST(RegistryGroup, ConflictingOwnershipThrows) {
+    ecs::Registry registry;
+    (void)registry.group<GroupPosition, GroupVelocity>();
+
+    EXPECT_THROW((void)(registry.group<GroupPosition, GroupTag>()), std::logic_error);
+}
+
+TEST(RegistryGroup, ParEachMatchesSerialWalk) {
+    ecs::Registry registry;
+    ecs::ThreadPool pool(3);
+    auto group = registry.group<GroupPosition, GroupVelocity>();
+
+    for (int i = 0; i < 10000; i++) {
+        auto e = registry.spawn_entity();
+        registry.add_component(e, GroupPosition{i});
+        if (i % 4 != 0)
+            registry.add_component(e, GroupVelocity{i % 7});
+    }
+
+    group.par_each(pool, [](ecs::Entity, GroupPosition& pos, GroupVelocity& vel) { pos.x += vel.dx; }, 0);
+
+    int checked = 0;
+    for (auto [e, pos, vel] : group) {
+        EXPECT_EQ(pos.x, static_cast<int>(e.value()) + vel.dx);
+        checked++;
+    }
+    EXPECT_EQ(checked, 7500);
+}
+
+TEST(RegistryGroup, ParChunksCoverEveryMemberOnce) {
+    ecs::Registry registry;
+    ecs::ThreadPool pool(3);
+    auto group = registry.group<GroupPosition, GroupVelocity>();
+
+    for (int i = 0; i < 10000; i++) {
+        auto e = registry.spawn_entity();
+        registry.add_component(e, GroupPosition{0});
+        registry.add_component(e, GroupVelocity{1});
+    }
+
+    std::atomic<std::size_t> visited{0};
+    group.par_chunks(pool, [&group, &visited](std::size_t begin, std::size_t end) {
+        for (std::size_t pos = begin; pos < end; pos++)
+            std::get<1>(group.at(pos)).x++;
+        visited += end - begin;
+    }, 0);
+
+    EXPECT_EQ(visited.load(), group.size());
+    for (auto [e, pos, vel] : group)
+        EXPECT_EQ(pos.x, 1);
+}
+
+TEST(Group, StampsNonConstComponents) {
+    ecs::Registry registry;
+    registry.set_current_version(1);
+    auto e = registry.spawn_entity();
+    registry.add_component(e, GroupPosition{1});
+    registry.add_component(e, GroupVelocity{2});
+    registry.add_component(e, GroupHealth{3});
+
+    // The group is created with every type mutable, then fetched with read-only ones
+    registry.group<GroupPosition, GroupVelocity>(ecs::Get<GroupHealth>{});
+    registry.set_current_version(2);
+    auto group = registry.group<GroupPosition, GroupVelocity const>(ecs::Get<GroupHealth const>{});
+    static_assert(std::is_same_v<decltype(group)::ValueType,
+                                 std::tuple<ecs::Entity, GroupPosition&, GroupVelocity const&, GroupHealth const&>>);
+    for (auto [entity, pos, vel, health] : group)
+        pos.x += vel.dx + health.hp;
+
+    EXPECT_EQ(registry.get_components<GroupPosition>().version(e.value()), 2);
+    EXPECT_EQ(registry.get_components<GroupVelocity>().version(e.value()), 1);
+    EXPECT_EQ(registry.get_components<GroupHealth>().version(e.value()), 1);
+    EXPECT_EQ(registry.get_component<GroupPosition>(e).x, 6);
+}
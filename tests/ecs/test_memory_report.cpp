@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include "ecs/registry.h"
+
+#include <algorithm>
+#include <deque>
+#include <typeindex>
+#include <vector>
+
+namespace {
+
+struct MemPosition {
+    int x;
+};
+
+struct MemHealth {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+    int hp;
+};
+
+ecs::StorageFootprint const& storage_of(ecs::MemoryReport const& report, std::type_index type) {
+    auto it = std::find_if(report.pools.begin(), report.pools.end(),
+                           [type](ecs::MemoryReport::Pool const& pool) { return pool.type == type; });
+    EXPECT_NE(it, report.pools.end());
+    return it->storage;
+}
+
+// Spawn a wave of `count` entities holding both components.
+std::vector<ecs::Entity> wave(ecs::Registry& registry, std::size_t count) {
+    auto entities = registry.spawn_entities(count);
+    registry.emplace_components<MemPosition>(entities, 1);
+    registry.emplace_components<MemHealth>(entities, 10);
+    return entities;
+}
+
+} // namespace
+
+TEST(RegistryMemoryReport, DescribesEachPool) {
+    ecs::Registry registry;
+    auto entities = wave(registry, 300);
+    registry.kill_entities(std::span<ecs::Entity const>(entities).first(100));
+
+    auto report = registry.memory_report();
+    ASSERT_EQ(report.pools.size(), 2);
+    EXPECT_EQ(report.total(), registry.memory_usage());
+    EXPECT_GT(report.entity_bytes, 0);
+    EXPECT_GT(report.journal_bytes, 0);
+
+    auto const& position = storage_of(report, typeid(MemPosition));
+    auto const& health = storage_of(report, typeid(MemHealth));
+    for (auto const* storage : {&position, &health}) {
+        EXPECT_EQ(storage->count, 200);
+        EXPECT_GE(storage->capacity, 300);
+        EXPECT_EQ(storage->component_bytes, storage->element_size * storage->capacity);
+        EXPECT_GT(storage->metadata_bytes, 0);
+        EXPECT_GT(storage->occupancy(), 0.0);
+        EXPECT_LE(storage->occupancy(), 1.0);
+    }
+    // Sparse pools index by id directly, packed pools keep a paged index
+    EXPECT_EQ(position.sparse_bytes, 0);
+    EXPECT_GT(health.sparse_bytes, 0);
+}
+
+TEST(RegistryMemoryReport, StaysBoundedDuringChurn) {
+    constexpr std::size_t k_wave_size = 256;
+    constexpr std::size_t k_live_waves = 3;
+    ecs::Registry registry;
+    std::deque<std::vector<ecs::Entity>> waves;
+    ecs::MemoryReport steady;
+
+    for (ecs::Version version = 1; version <= 200; version++) {
+        registry.set_current_version(version);
+        waves.push_back(wave(registry, k_wave_size));
+        if (waves.size() > k_live_waves) {
+            registry.kill_entities(waves.front());
+            waves.pop_front();
+        }
+        // Clients acknowledged the previous tick
+        registry.trim_change_journal(version - 1);
+
+        auto report = registry.memory_report();
+        ASSERT_EQ(report.pools.size(), 2);
+        for (auto const& pool : report.pools) {
+            EXPECT_EQ(pool.storage.count, k_wave_size * waves.size());
+            EXPECT_LE(pool.storage.capacity, 2 * k_wave_size * (k_live_waves + 1));
+        }
+        if (version == 10) {
+            steady = report;
+        } else if (version > 10) {
+            // Killed ids are recycled: nothing grows once the population is steady
+            EXPECT_LE(report.entity_bytes, steady.entity_bytes);
+            EXPECT_LE(report.journal_bytes, steady.journal_bytes);
+            for (std::size_t i = 0; i < report.pools.size(); i++) {
+                EXPECT_LE(report.pools[i].storage.capacity, steady.pools[i].storage.capacity);
+                EXPECT_LE(report.pools[i].storage.total(), steady.pools[i].storage.total());
+            }
+            EXPECT_LE(report.total(), steady.total());
+        }
+    }
+}
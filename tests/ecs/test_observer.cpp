@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include "ecs/command_buffer.h"
+#include "ecs/registry.h"
+
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct ObsPosition {
+    int x;
+};
+
+struct ObsHealth {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+    int hp;
+};
+
+struct ObsUnobserved {
+    int value;
+};
+
+// Collects every batch delivered to a callback.
+struct Recorder {
+    std::vector<std::vector<ecs::Entity>> batches;
+
+    ecs::ComponentObservers::Callback callback() {
+        return [this](ecs::Registry&, std::span<ecs::Entity const> entities) {
+            batches.emplace_back(entities.begin(), entities.end());
+        };
+    }
+};
+
+} // namespace
+
+TEST(RegistryObserver, EventsAreDeliveredAtDispatch) {
+    ecs::Registry registry;
+    Recorder constructed;
+    registry.on_construct<ObsPosition>(constructed.callback());
+
+    auto a = registry.spawn_entity();
+    auto b = registry.spawn_entity();
+    registry.add_component(a, ObsPosition{1});
+    registry.emplace_component<ObsPosition>(b, 2);
+    EXPECT_TRUE(constructed.batches.empty());
+
+    registry.dispatch_observers();
+    ASSERT_EQ(constructed.batches.size(), 1);
+    EXPECT_EQ(constructed.batches[0], (std::vector<ecs::Entity>{a, b}));
+
+    // Nothing new, nothing delivered
+    registry.dispatch_observers();
+    EXPECT_EQ(constructed.batches.size(), 1);
+}
+
+TEST(RegistryObserver, ReplacingAndWritingRaiseUpdatesOnce) {
+    ecs::Registry registry;
+    Recorder constructed;
+    Recorder updated;
+    registry.on_construct<ObsPosition>(constructed.callback());
+    registry.on_update<ObsPosition>(updated.callback());
+
+    auto e = registry.spawn_entity();
+    registry.add_component(e, ObsPosition{1});
+    registry.dispatch_observers();
+
+    registry.add_component(e, ObsPosition{2});
+    registry.get_component<ObsPosition>(e).x = 3;
+    registry.patch<ObsPosition>(e, [](ObsPosition& p) { p.x = 4; });
+    registry.mark_dirty<ObsPosition>(e);
+    std::as_const(registry).get_component<ObsPosition>(e);
+    registry.dispatch_observers();
+
+    EXPECT_EQ(constructed.batches.size(), 1);
+    ASSERT_EQ(updated.batches.size(), 1);
+    EXPECT_EQ(updated.batches[0], (std::vector<ecs::Entity>{e}));
+}
+
+TEST(RegistryObserver, RemovalsAndKillsRaiseDestroy) {
+    ecs::Registry registry;
+    Recorder destroyed;
+    registry.on_destroy<ObsHealth>(destroyed.callback());
+
+    auto entities = registry.spawn_entities(4);
+    registry.emplace_components<ObsHealth>(entities, 10);
+    auto bare = registry.spawn_entity();
+
+    registry.remove_component<ObsHealth>(entities[0]);
+    registry.kill_entity(entities[1]);
+    registry.kill_entities(std::vector<ecs::Entity>{entities[2], entities[2], bare});
+    registry.dispatch_observers();
+
+    ASSERT_EQ(destroyed.batches.size(), 1);
+    EXPECT_EQ(destroyed.batches[0], (std::vector<ecs::Entity>{entities[0], entities[1], entities[2]}));
+}
+
+TEST(RegistryObserver, CommandBuffersRaiseEventsWhenApplied) {
+    ecs::Registry registry;
+    ecs::CommandBuffer commands;
+    Recorder constructed;
+    Recorder destroyed;
+    registry.on_construct<ObsPosition>(constructed.callback());
+    registry.on_destroy<ObsPosition>(destroyed.callback());
+
+    auto e = registry.spawn_entity();
+    registry.add_component(e, ObsPosition{1});
+    commands.spawn(ObsPosition{2});
+    commands.kill(e);
+    commands.apply(registry);
+    registry.dispatch_observers();
+
+    ASSERT_EQ(constructed.batches.size(), 1);
+    EXPECT_EQ(constructed.batches[0].size(), 2);
+    ASSERT_EQ(destroyed.batches.size(), 1);
+    EXPECT_EQ(destroyed.batches[0], (std::vector<ecs::Entity>{e}));
+}
+
+TEST(RegistryObserver, EventsRaisedByCallbacksWaitForTheNextDispatch) {
+    ecs::Registry registry;
+    std::size_t constructed = 0;
+    registry.on_construct<ObsPosition>([&constructed](ecs::Registry& reg, std::span<ecs::Entity const> entities) {
+        constructed += entities.size();
+        for (auto e : entities) {
+            if (reg.get_component<ObsPosition>(e).x > 0)
+                reg.add_component(reg.spawn_entity(), ObsPosition{0});
+        }
+    });
+
+    registry.add_component(registry.spawn_entity(), ObsPosition{1});
+    registry.dispatch_observers();
+    EXPECT_EQ(constructed, 1);
+    registry.dispatch_observers();
+    EXPECT_EQ(constructed, 2);
+}
+
+TEST(RegistryObserver, UnobservedTypesQueueNothing) {
+    ecs::Registry registry;
+    auto e = registry.spawn_entity();
+
+    registry.add_component(e, ObsUnobserved{1});
+    EXPECT_EQ(registry.get_components<ObsUnobserved>().size(), 1);
+    registry.on_update<ObsUnobserved>([](ecs::Registry&, std::span<ecs::Entity const>) { FAIL(); });
+    registry.remove_component<ObsUnobserved>(e);
+    registry.add_component(e, ObsUnobserved{2});
+    registry.dispatch_observers();
+}
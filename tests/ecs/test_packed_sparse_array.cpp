@@ -0,0 +1,227 @@
+#include <gtest/gtest.h>
+#include "ecs/sparse_array.h"
+#include "ecs/zipper.h"
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+struct PackedComponent {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+    int value;
+};
+
+struct DefaultComponent {
+    int value;
+};
+
+static_assert(ecs::StorageTraits<PackedComponent>::k_mode == ecs::StorageMode::Packed);
+static_assert(ecs::StorageTraits<DefaultComponent>::k_mode == ecs::StorageMode::Sparse);
+
+TEST(PackedSparseArray, InsertAt) {
+    ecs::SparseArray<PackedComponent> array;
+
+    array.insert_at(0, PackedComponent{10});
+    array.insert_at(2, PackedComponent{20});
+
+    EXPECT_EQ(array.size(), 3);
+    EXPECT_EQ(array.count(), 2);
+    EXPECT_TRUE(array[0].has_value());
+    EXPECT_EQ(array[0]->value, 10);
+    EXPECT_FALSE(array.contains(1));
+    EXPECT_TRUE(array[2].has_value());
+    EXPECT_EQ(array[2]->value, 20);
+}
+
+TEST(PackedSparseArray, InsertReplacesExisting) {
+    ecs::SparseArray<PackedComponent> array;
+
+    array.insert_at(3, PackedComponent{1});
+    array.insert_at(3, PackedComponent{2});
+
+    EXPECT_EQ(array.count(), 1);
+    EXPECT_EQ(array[3]->value, 2);
+}
+
+TEST(PackedSparseArray, EmplaceAt) {
+    ecs::SparseArray<PackedComponent> array;
+
+    array.emplace_at(1, 30);
+
+    EXPECT_EQ(array.size(), 2);
+    EXPECT_FALSE(array.contains(0));
+    EXPECT_TRUE(array[1].has_value());
+    EXPECT_EQ(array[1]->value, 30);
+}
+
+TEST(PackedSparseArray, EraseKeepsOtherComponents) {
+    ecs::SparseArray<PackedComponent> array;
+
+    array.insert_at(0, PackedComponent{10});
+    array.insert_at(1, PackedComponent{11});
+    array.insert_at(2, PackedComponent{12});
+
+    array.erase(0);
+    array.erase(42); // Erasing a missing component is a no-op
+
+    EXPECT_EQ(array.size(), 3); // Size doesn't shrink on erase
+    EXPECT_EQ(array.count(), 2);
+    EXPECT_FALSE(array.contains(0));
+    EXPECT_EQ(array[1]->value, 11);
+    EXPECT_EQ(array[2]->value, 12);
+}
+
+TEST(PackedSparseArray, StampsFollowTheirComponents) {
+    ecs::SparseArray<PackedComponent> packed;
+    ecs::SparseArray<DefaultComponent> sparse;
+
+    for (std::size_t i = 0; i < 4; i++) {
+        packed.insert_at(i, PackedComponent{static_cast<int>(i)});
+        sparse.insert_at(i, DefaultComponent{static_cast<int>(i)});
+        packed.stamp(i, static_cast<ecs::Version>(i + 1));
+        sparse.stamp(i, static_cast<ecs::Version>(i + 1));
+    }
+    packed.stamp(9, 7); // Missing components are not stamped
+    sparse.stamp(9, 7);
+    EXPECT_EQ(packed.version(9), 0);
+    EXPECT_EQ(sparse.version(9), 0);
+
+    // The last dense component moves into the hole with its stamp
+    packed.erase(0);
+    sparse.erase(0);
+    EXPECT_EQ(packed.version(3), 4);
+    EXPECT_EQ(packed.version(0), 0);
+    EXPECT_EQ(sparse.version(0), 0);
+
+    std::vector<std::size_t> changed;
+    packed.changed_since(2, changed);
+    EXPECT_EQ(changed, (std::vector<std::size_t>{3, 2}));
+    changed.clear();
+    sparse.changed_since(2, changed);
+    EXPECT_EQ(changed, (std::vector<std::size_t>{2, 3}));
+}
+
+TEST(PackedSparseArray, SparseIndexSpansPages) {
+    using ArrayType = ecs::SparseArray<PackedComponent>;
+    ArrayType array;
+    const auto k_far = ArrayType::k_page_size * 3 + 7;
+
+    array.insert_at(k_far, PackedComponent{7});
+
+    EXPECT_EQ(array.size(), k_far + 1);
+    EXPECT_EQ(array.count(), 1);
+    EXPECT_TRUE(array.contains(k_far));
+    EXPECT_FALSE(array.contains(ArrayType::k_page_size));
+    EXPECT_EQ(array[k_far]->value, 7);
+}
+
+TEST(PackedSparseArray, EachVisitsOnlyStoredComponents) {
+    ecs::SparseArray<PackedComponent> array;
+
+    array.insert_at(5, PackedComponent{50});
+    array.insert_at(100, PackedComponent{1000});
+
+    for (auto [idx, component] : array.each())
+        component.value += static_cast<int>(idx);
+
+    std::size_t visited = 0;
+    for (auto [idx, component] : std::as_const(array).each()) {
+        EXPECT_EQ(component.value, (idx == 5) ? 55 : 1100);
+        visited++;
+    }
+    EXPECT_EQ(visited, 2);
+}
+
+TEST(PackedSparseArray, EachOnSparseLayout) {
+    ecs::SparseArray<DefaultComponent> array;
+
+    array.insert_at(1, DefaultComponent{1});
+    array.insert_at(4, DefaultComponent{4});
+    array.erase(1);
+
+    std::vector<std::size_t> indices;
+    for (auto [idx, component] : array.each()) {
+        EXPECT_EQ(static_cast<std::size_t>(component.value), idx);
+        indices.push_back(idx);
+    }
+    EXPECT_EQ(indices, std::vector<std::size_t>{4});
+    EXPECT_EQ(array.count(), 1);
+}
+
+TEST(PackedSparseArray, GetIndex) {
+    ecs::SparseArray<PackedComponent> array;
+
+    array.insert_at(0, PackedComponent{10});
+    array.insert_at(5, PackedComponent{50});
+
+    EXPECT_EQ(array.get_index(array[0]), 0);
+    EXPECT_EQ(array.get_index(array[5]), 5);
+    EXPECT_EQ(array.get_index(std::as_const(array)[3]), static_cast<std::size_t>(-1));
+}
+
+TEST(PackedSparseArray, MissingIdHasNoWritableSlot) {
+    ecs::SparseArray<PackedComponent> array;
+    array.insert_at(2, PackedComponent{20});
+
+    ASSERT_NE(array.find(2), nullptr);
+    array.find(2)->value = 21;
+    EXPECT_EQ(std::as_const(array).find(2)->value, 21);
+    EXPECT_EQ(array.find(1), nullptr);
+    EXPECT_EQ(std::as_const(array).find(1000000), nullptr);
+    EXPECT_FALSE(std::as_const(array)[1].has_value());
+    EXPECT_THROW(array[1], std::runtime_error);
+
+    // Each mutable iterator owns the empty slot it hands out for a missing id
+    auto first = array.begin();
+    auto second = array.begin();
+    *first = PackedComponent{7};
+    EXPECT_FALSE(second->has_value());
+    EXPECT_FALSE(array.contains(0));
+
+    ecs::SparseArray<DefaultComponent> sparse;
+    sparse.insert_at(2, DefaultComponent{20});
+    EXPECT_EQ(sparse.find(2)->value, 20);
+    EXPECT_EQ(sparse.find(1), nullptr);
+    EXPECT_EQ(std::as_const(sparse).find(3), nullptr);
+}
+
+TEST(PackedSparseArray, IteratorsWalkEveryIdSlot) {
+    ecs::SparseArray<PackedComponent> array;
+    array.insert_at(0, PackedComponent{1});
+    array.insert_at(2, PackedComponent{3});
+
+    auto it = array.begin();
+    EXPECT_NE(it, array.end());
+    EXPECT_TRUE(it->has_value());
+    EXPECT_EQ(it->value().value, 1);
+
+    it++;
+    EXPECT_FALSE(it->has_value());
+
+    it++;
+    EXPECT_TRUE(it->has_value());
+    EXPECT_EQ(it->value().value, 3);
+
+    it++;
+    EXPECT_EQ(it, array.end());
+}
+
+TEST(PackedSparseArray, ZipperAlignsWithSparseLayout) {
+    ecs::SparseArray<PackedComponent> packed;
+    ecs::SparseArray<DefaultComponent> sparse;
+
+    packed.insert_at(2, PackedComponent{20});
+    packed.insert_at(0, PackedComponent{0});
+    sparse.insert_at(0, DefaultComponent{1});
+    sparse.insert_at(2, DefaultComponent{3});
+
+    std::size_t matches = 0;
+    for (auto [idx, packed_opt, sparse_opt] : ecs::indexed_zipper(std::as_const(packed), std::as_const(sparse))) {
+        if (packed_opt && sparse_opt) {
+            EXPECT_EQ(packed_opt->value, static_cast<int>(idx) * 10);
+            EXPECT_EQ(sparse_opt->value, static_cast<int>(idx) + 1);
+            matches++;
+        }
+    }
+    EXPECT_EQ(matches, 2);
+}
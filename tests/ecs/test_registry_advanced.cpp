@@ -1,92 +1,187 @@
 #include <gtest/gtest.h>
 #include "ecs/registry.h"
+#include "ecs/scheduler.h"
+
+#include <map>
+#include <span>
+#include <type_traits>
+#include <typeindex>
+#include <vector>
 
 struct TestComp {
     int val;
     bool operator==(const TestComp& other) const { return val == other.val; }
 };
 
-TEST(RegistryAdvanced, VersioningAndTombstones) {
+TEST(RegistryAdvanced, VersioningAndEntityJournal) {
+    using Op = ecs::ChangeJournal::Op;
     ecs::Registry registry;
     registry.set_current_version(10);
     EXPECT_EQ(registry.get_current_version(), 10);
 
     ecs::Entity e = registry.spawn_entity();
-    
-    // Check creation tombstone
-    const auto& creation_tombstones = registry.get_entity_creation_tombstones();
-    auto it = creation_tombstones.find(e);
-    ASSERT_NE(it, creation_tombstones.end());
-    EXPECT_EQ(it->second, 10);
-    
-    registry.remove_entity_creation_tombstone(e);
-    EXPECT_EQ(registry.get_entity_creation_tombstones().size(), 0);
-
-    // Check destruction tombstone
+
+    // Check creation entry
+    auto changes = registry.get_change_journal().since(0);
+    ASSERT_EQ(changes.size(), 1);
+    EXPECT_EQ(changes[0].op, Op::entity_created);
+    EXPECT_EQ(changes[0].entity, e);
+    EXPECT_EQ(changes[0].version, 10);
+
+    // Check destruction entry
+    registry.set_current_version(11);
     registry.kill_entity(e);
-    const auto& destruction_tombstones = registry.get_entity_destruction_tombstones();
-    auto it_dest = destruction_tombstones.find(e);
-    ASSERT_NE(it_dest, destruction_tombstones.end());
-    EXPECT_EQ(it_dest->second, 10);
-    
-    registry.remove_entity_destruction_tombstone(e);
-    EXPECT_EQ(registry.get_entity_destruction_tombstones().size(), 0);
+    changes = registry.get_change_journal().since(10);
+    ASSERT_EQ(changes.size(), 1);
+    EXPECT_EQ(changes[0].op, Op::entity_destroyed);
+    EXPECT_EQ(changes[0].entity, e);
+
+    registry.trim_change_journal(10);
+    EXPECT_EQ(registry.get_change_journal().size(), 1);
+    registry.trim_change_journal(11);
+    EXPECT_TRUE(registry.get_change_journal().empty());
 }
 
-TEST(RegistryAdvanced, ComponentTombstonesAndMetadata) {
+TEST(RegistryAdvanced, ComponentStampsAndJournal) {
+    using Op = ecs::ChangeJournal::Op;
     ecs::Registry registry;
     registry.set_current_version(5);
-    
+
     ecs::Entity e = registry.spawn_entity();
     registry.register_component<TestComp>();
     registry.add_component(e, TestComp{42});
-    
-    // Check component metadata (dirty/update tracking)
-    const auto& metadata = registry.get_component_metadata();
-    auto type_idx = std::type_index(typeid(TestComp));
-    auto it_meta = metadata.find({e, type_idx});
-    ASSERT_NE(it_meta, metadata.end());
-    EXPECT_EQ(it_meta->second, 5);
+
+    // Adding a component stamps it (dirty/update tracking)
+    auto& comps = registry.get_components<TestComp>();
+    EXPECT_EQ(comps.version(e.value()), 5);
 
     // Manually mark dirty
     registry.set_current_version(6);
     registry.mark_dirty<TestComp>(e);
-    it_meta = metadata.find({e, type_idx});
-    EXPECT_EQ(it_meta->second, 6);
+    EXPECT_EQ(comps.version(e.value()), 6);
 
-    // Remove component and check destruction tombstone
+    // Remove component and check removal entry
     registry.remove_component<TestComp>(e);
-    
-    const auto& comp_dest_tombstones = registry.get_component_destruction_tombstones();
-    ASSERT_NE(comp_dest_tombstones.find(e), comp_dest_tombstones.end());
-    auto& inner_map = comp_dest_tombstones.at(e);
-    ASSERT_NE(inner_map.find(type_idx), inner_map.end());
-    EXPECT_EQ(inner_map.at(type_idx), 6);
-    
+    EXPECT_EQ(comps.version(e.value()), 0);
+    auto changes = registry.get_change_journal().since(5);
+    ASSERT_EQ(changes.size(), 1);
+    EXPECT_EQ(changes[0].op, Op::component_removed);
+    EXPECT_EQ(changes[0].entity, e);
+    EXPECT_EQ(changes[0].version, 6);
+    EXPECT_EQ(registry.component_type(changes[0].component), std::type_index(typeid(TestComp)));
+
     // Clean up
-    registry.remove_component_destruction_tombstone(e, type_idx);
-    if (comp_dest_tombstones.find(e) != comp_dest_tombstones.end()) {
-         // It might still exist but be empty, or not fully erased depending on implementation logic
-         // The test just checks that specific entry is gone or map is updated
-         auto& inner = comp_dest_tombstones.at(e);
-         EXPECT_EQ(inner.find(type_idx), inner.end());
+    registry.trim_change_journal(6);
+    EXPECT_TRUE(registry.get_change_journal().since(0).empty());
+    EXPECT_THROW((void)registry.component_type(ecs::ChangeJournal::k_no_component), std::out_of_range);
+}
+
+TEST(RegistryAdvanced, MutableAccessStampsComponents) {
+    ecs::Registry registry;
+    registry.set_current_version(1);
+    ecs::Entity a = registry.spawn_entity();
+    ecs::Entity b = registry.spawn_entity();
+    ecs::Entity c = registry.spawn_entity();
+    for (auto e : {a, b, c})
+        registry.add_component(e, TestComp{0});
+
+    registry.set_current_version(2);
+    registry.get_component<TestComp>(a).val = 1;
+    EXPECT_EQ(registry.patch<TestComp>(b, [](TestComp& comp) { return ++comp.val; }), 1);
+    const auto& const_registry = registry;
+    EXPECT_EQ(const_registry.get_component<TestComp>(c).val, 0);
+
+    std::vector<std::size_t> changed;
+    registry.each_changed(1, [&changed](std::type_index type, std::span<std::size_t const> indices) {
+        EXPECT_EQ(type, std::type_index(typeid(TestComp)));
+        changed.assign(indices.begin(), indices.end());
+    });
+    EXPECT_EQ(changed, (std::vector<std::size_t>{a.value(), b.value()}));
+
+    registry.remove_component<TestComp>(c);
+    EXPECT_THROW((void)registry.get_component<TestComp>(c), std::runtime_error);
+}
+
+TEST(RegistryAdvanced, ViewWritesAreReplicated) {
+    struct ReadOnlyComp {
+        int val;
+    };
+
+    ecs::Registry registry;
+    registry.set_current_version(1);
+    std::vector<ecs::Entity> entities;
+    for (int i = 0; i < 4; i++) {
+        entities.push_back(registry.spawn_entity());
+        registry.add_component(entities.back(), TestComp{i});
+        if (i % 2 == 0)
+            registry.add_component(entities.back(), ReadOnlyComp{i});
     }
-    
-    registry.remove_component_metadata(e, type_idx);
-    EXPECT_EQ(registry.get_component_metadata().find({e, type_idx}), registry.get_component_metadata().end());
+
+    // A system writing through a view, with no call to mark_dirty
+    ecs::Scheduler scheduler(2);
+    scheduler.add(
+        [&registry] {
+            for (auto [e, comp, read_only] : registry.view<TestComp, ReadOnlyComp const>())
+                comp.val += read_only.val;
+        },
+        ecs::SystemAccess{{ecs::component_id<ReadOnlyComp>()}, {ecs::component_id<TestComp>()},
+                          ecs::SystemPolicy::Parallel});
+    registry.set_current_version(2);
+    scheduler.run();
+
+    std::map<std::type_index, std::vector<std::size_t>> changed;
+    registry.each_changed(1, [&changed](std::type_index type, std::span<std::size_t const> indices) {
+        changed[type].assign(indices.begin(), indices.end());
+    });
+    EXPECT_EQ(changed[std::type_index(typeid(TestComp))],
+              (std::vector<std::size_t>{entities[0].value(), entities[2].value()}));
+    EXPECT_TRUE(changed[std::type_index(typeid(ReadOnlyComp))].empty());
+
+    // Read-only views leave the stamps alone
+    registry.set_current_version(3);
+    for (auto [e, comp] : registry.view<TestComp const>())
+        (void)comp;
+    registry.each_changed(2, [](std::type_index /*type*/, std::span<std::size_t const> indices) {
+        EXPECT_TRUE(indices.empty());
+    });
 }
 
-TEST(RegistryAdvanced, GetEntityComponents) {
+TEST(RegistryAdvanced, VisitComponents) {
+    struct OtherComp {
+        float f;
+    };
+    struct UnlistedComp {
+        int i;
+    };
+
     ecs::Registry registry;
     ecs::Entity e = registry.spawn_entity();
-    
-    registry.register_component<TestComp>();
+    ecs::Entity bare = registry.spawn_entity();
+
     registry.add_component(e, TestComp{123});
-    
-    const auto& components = registry.get_entity_components(e);
-    auto type_idx = std::type_index(typeid(TestComp));
-    
-    ASSERT_NE(components.find(type_idx), components.end());
-    const std::any& any_val = components.at(type_idx);
-    EXPECT_EQ(std::any_cast<TestComp>(any_val).val, 123);
+    registry.add_component(e, OtherComp{1.5f});
+    registry.add_component(e, UnlistedComp{7});
+    registry.add_component(bare, UnlistedComp{8});
+
+    int visited = 0;
+    const TestComp* seen = nullptr;
+    registry.visit_components<TestComp, OtherComp, UnlistedComp const>(e, [&](const auto& comp) {
+        using T = std::remove_cvref_t<decltype(comp)>;
+        if constexpr (std::is_same_v<T, TestComp>)
+            seen = &comp;
+        visited++;
+    });
+    EXPECT_EQ(visited, 3);
+    ASSERT_NE(seen, nullptr);
+    EXPECT_EQ(seen, &registry.get_components<TestComp>()[e.value()].value()); // No copy
+    EXPECT_EQ(seen->val, 123);
+
+    // Only the listed types are dispatched
+    visited = 0;
+    registry.visit_components(e, ecs::ComponentList<OtherComp>{}, [&](const OtherComp& comp) {
+        EXPECT_FLOAT_EQ(comp.f, 1.5f);
+        visited++;
+    });
+    registry.visit_components(bare, ecs::ComponentList<TestComp, OtherComp>{}, [&](const auto&) { visited++; });
+    EXPECT_EQ(visited, 1);
 }
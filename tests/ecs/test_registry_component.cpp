@@ -75,3 +75,67 @@ TEST(RegistryComponent, KillEntityRemovesComponents) {
     // We need to check if the component at that index is empty
     EXPECT_FALSE(positions[e.value()].has_value());
 }
+
+TEST(RegistryComponent, ComponentIdsAreStablePerType) {
+    const auto k_position_id = ecs::component_id<Position>();
+    const auto k_velocity_id = ecs::component_id<Velocity>();
+
+    EXPECT_NE(k_position_id, k_velocity_id);
+    EXPECT_EQ(ecs::component_id<Position>(), k_position_id);
+    EXPECT_EQ(ecs::component_id<Position const&>(), k_position_id);
+}
+
+TEST(RegistryComponent, RegistrationOrderDoesNotMatter) {
+    ecs::Registry first;
+    ecs::Registry second;
+
+    first.register_component<Position>();
+    first.register_component<Velocity>();
+    second.register_component<Velocity>();
+    EXPECT_THROW(second.get_components<Position>(), std::runtime_error);
+    second.register_component<Position>();
+
+    ecs::Entity e = second.spawn_entity();
+    second.add_component(e, Position{1.0f, 2.0f});
+    second.add_component(e, Velocity{3.0f, 4.0f});
+
+    EXPECT_EQ(second.get_components<Position>()[e.value()]->y, 2.0f);
+    EXPECT_EQ(second.get_components<Velocity>()[e.value()]->dx, 3.0f);
+    int visited = 0;
+    second.visit_components<Position, Velocity>(e, [&visited](auto const&) { visited++; });
+    EXPECT_EQ(visited, 2);
+    EXPECT_EQ(first.get_components<Position>().size(), 0);
+}
+
+TEST(RegistryComponent, AddAndEmplaceComponentsInBatch) {
+    ecs::Registry registry;
+    auto entities = registry.spawn_entities(3);
+    std::vector<Position> positions{{1.0f, 2.0f}, {3.0f, 4.0f}, {5.0f, 6.0f}};
+
+    registry.add_components<Position>(entities, positions);
+    registry.emplace_components<Velocity>(entities, 7.0f, 8.0f);
+
+    auto const& stored = registry.get_components<Position>();
+    auto const& velocities = registry.get_components<Velocity>();
+    for (std::size_t i = 0; i < entities.size(); i++) {
+        EXPECT_EQ(stored[entities[i].value()], positions[i]);
+        EXPECT_EQ(velocities[entities[i].value()]->dx, 7.0f);
+        EXPECT_EQ(velocities[entities[i].value()]->dy, 8.0f);
+    }
+    EXPECT_EQ(velocities.count(), 3);
+}
+
+TEST(RegistryComponent, KillEntitiesRemovesComponents) {
+    ecs::Registry registry;
+    auto entities = registry.spawn_entities(5);
+    registry.emplace_components<Position>(entities, 1.0f, 1.0f);
+    registry.add_component(entities[4], Velocity{1.0f, 1.0f});
+
+    std::vector<ecs::Entity> killed{entities[0], entities[4]};
+    registry.kill_entities(killed);
+
+    EXPECT_EQ(registry.get_components<Position>().count(), 3);
+    EXPECT_EQ(registry.get_components<Velocity>().count(), 0);
+    EXPECT_FALSE(registry.has_component<Position>(entities[0]));
+    EXPECT_TRUE(registry.has_component<Position>(entities[1]));
+}
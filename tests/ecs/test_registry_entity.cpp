@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 #include "ecs/registry.h"
 
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
 TEST(RegistryEntity, SpawnEntity) {
     ecs::Registry registry;
     ecs::Entity e1 = registry.spawn_entity();
@@ -32,3 +36,90 @@ TEST(RegistryEntity, EntityFromIndex) {
     ecs::Entity e = registry.entity_from_index(42);
     EXPECT_EQ(e.value(), 42);
 }
+
+TEST(RegistryEntity, SpawnAndKillEntitiesInBatch) {
+    ecs::Registry registry;
+    auto first = registry.spawn_entities(4);
+    ASSERT_EQ(first.size(), 4);
+    for (std::size_t i = 0; i < first.size(); i++)
+        EXPECT_EQ(first[i].value(), i);
+
+    registry.kill_entities(std::span<ecs::Entity const>(first).subspan(1, 2));
+
+    // Freed ids first, then a contiguous block of new ones
+    auto second = registry.spawn_entities(4);
+    ASSERT_EQ(second.size(), 4);
+    EXPECT_EQ(second[0].value(), 2);
+    EXPECT_EQ(second[1].value(), 1);
+    EXPECT_EQ(second[2].value(), 4);
+    EXPECT_EQ(second[3].value(), 5);
+    EXPECT_EQ(registry.spawn_entity().value(), 6);
+}
+
+TEST(RegistryEntity, RecycledIndexGetsNewGeneration) {
+    ecs::Registry registry;
+    ecs::Entity e1 = registry.spawn_entity();
+    EXPECT_TRUE(registry.alive(e1));
+
+    registry.kill_entity(e1);
+    EXPECT_FALSE(registry.alive(e1));
+    EXPECT_FALSE(registry.alive(registry.entity_from_index(e1.index())));
+
+    ecs::Entity e2 = registry.spawn_entity();
+    EXPECT_EQ(e2.index(), e1.index());
+    EXPECT_EQ(e2.generation(), e1.generation() + 1);
+    EXPECT_NE(e2, e1);
+    EXPECT_FALSE(registry.alive(e1));
+    EXPECT_TRUE(registry.alive(e2));
+    EXPECT_EQ(registry.entity_from_index(e2.index()), e2);
+}
+
+TEST(RegistryEntity, KillingStaleHandleIsIgnored) {
+    ecs::Registry registry;
+    ecs::Entity stale = registry.spawn_entity();
+    registry.kill_entity(stale);
+    ecs::Entity e = registry.spawn_entity();
+    registry.add_component(e, 42);
+
+    registry.kill_entity(stale);
+    registry.kill_entities(std::vector<ecs::Entity>{stale, stale});
+    EXPECT_TRUE(registry.alive(e));
+    EXPECT_TRUE(registry.has_component<int>(e));
+    EXPECT_NE(registry.spawn_entity().index(), e.index());
+}
+
+TEST(RegistryEntity, StaleHandleDoesNotReachReusedIndex) {
+    ecs::Registry registry;
+    ecs::Entity stale = registry.spawn_entity();
+    registry.kill_entity(stale);
+    ecs::Entity e = registry.spawn_entity();
+    ASSERT_EQ(e.index(), stale.index());
+    registry.add_component(e, 42);
+
+    EXPECT_THROW(registry.add_component(stale, 7), std::runtime_error);
+    EXPECT_THROW(registry.emplace_component<int>(stale, 7), std::runtime_error);
+    EXPECT_THROW(registry.get_component<int>(stale), std::runtime_error);
+    EXPECT_THROW(std::as_const(registry).get_component<int>(stale), std::runtime_error);
+    EXPECT_THROW(registry.add_components<int>(std::vector<ecs::Entity>{e, stale}, std::vector<int>{1, 2}),
+                 std::runtime_error);
+    EXPECT_FALSE(registry.has_component<int>(stale));
+
+    registry.remove_component<int>(stale);
+    registry.mark_dirty<int>(stale);
+    int visited = 0;
+    registry.visit_components<int>(stale, [&visited](auto const&) { visited++; });
+    EXPECT_EQ(visited, 0);
+    ASSERT_TRUE(registry.has_component<int>(e));
+    EXPECT_EQ(registry.get_component<int>(e), 42);
+}
+
+TEST(RegistryEntity, ViewsHandOutCurrentGenerations) {
+    ecs::Registry registry;
+    ecs::Entity e = registry.spawn_entity();
+    registry.kill_entity(e);
+    e = registry.spawn_entity();
+    registry.add_component(e, 1.0f);
+
+    for (auto [entity, value] : registry.view<float>())
+        EXPECT_EQ(entity, e);
+}
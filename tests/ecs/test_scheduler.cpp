@@ -0,0 +1,263 @@
+#include <gtest/gtest.h>
+#include "ecs/command_buffer.h"
+#include "ecs/registry.h"
+#include "ecs/scheduler.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t k_pools = 6;
+constexpr std::size_t k_systems = 40;
+
+using Pools = std::array<std::vector<std::uint64_t>, k_pools>;
+
+struct Declared {
+    std::vector<ecs::ComponentId> reads;
+    std::vector<ecs::ComponentId> writes;
+    ecs::SystemPolicy policy;
+};
+
+// Random access sets: every system folds what it reads into what it writes, so any reordering
+// of two conflicting systems changes the final pools.
+std::vector<Declared> random_systems(unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::vector<Declared> systems;
+
+    for (std::size_t i = 0; i < k_systems; i++) {
+        Declared sys{{}, {}, ecs::SystemPolicy::Parallel};
+        for (ecs::ComponentId id = 0; id < k_pools; id++) {
+            auto roll = rng() % 6;
+            if (roll == 0)
+                sys.writes.push_back(id);
+            else if (roll == 1)
+                sys.reads.push_back(id);
+        }
+        auto roll = rng() % 10;
+        if (roll == 0)
+            sys.policy = ecs::SystemPolicy::Exclusive;
+        else if (roll < 3)
+            sys.policy = ecs::SystemPolicy::MainThread;
+        systems.push_back(sys);
+    }
+    return systems;
+}
+
+void run_system(Pools& pools, Declared const& sys, std::size_t salt) {
+    std::uint64_t acc = salt;
+    for (auto id : sys.reads)
+        for (auto value : pools[id])
+            acc = acc * 31 + value;
+    for (auto id : sys.writes)
+        for (auto& value : pools[id]) {
+            value = value * 17 + acc;
+            acc ^= value;
+        }
+}
+
+Pools make_pools() {
+    Pools pools;
+    for (std::size_t id = 0; id < k_pools; id++)
+        pools[id].assign(256, id + 1);
+    return pools;
+}
+
+} // namespace
+
+TEST(Scheduler, MatchesSequentialExecution) {
+    for (unsigned int seed = 0; seed < 8; seed++) {
+        auto systems = random_systems(seed);
+
+        Pools expected = make_pools();
+        Pools actual = make_pools();
+        ecs::Scheduler scheduler(4);
+        for (std::size_t i = 0; i < systems.size(); i++)
+            scheduler.add([&actual, &sys = systems[i], i] { run_system(actual, sys, i); },
+                          ecs::SystemAccess{systems[i].reads, systems[i].writes, systems[i].policy});
+
+        for (int tick = 0; tick < 3; tick++) {
+            for (std::size_t i = 0; i < systems.size(); i++)
+                run_system(expected, systems[i], i);
+            scheduler.run();
+        }
+        EXPECT_EQ(actual, expected) << "seed " << seed;
+    }
+}
+
+namespace {
+
+struct SpawnedBy {
+    std::size_t system;
+    std::size_t index;
+
+    bool operator==(SpawnedBy const&) const = default;
+};
+
+// Two parallel spawners, the first one late, and a parallel loop killing every other entity.
+std::vector<std::pair<std::uint64_t, SpawnedBy>> run_spawners(std::size_t workers) {
+    ecs::Registry registry;
+    registry.register_component<SpawnedBy>();
+    ecs::ThreadCommandBuffers commands;
+    ecs::Scheduler scheduler(workers);
+    std::vector<ecs::Entity> alive;
+
+    for (std::size_t system = 0; system < 2; system++) {
+        scheduler.add(
+            [&commands, system] {
+                if (system == 0)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                for (std::size_t i = 0; i < 50; i++)
+                    commands.local().spawn(SpawnedBy{system, i});
+            },
+            ecs::SystemAccess{{}, {}, ecs::SystemPolicy::Parallel});
+    }
+    scheduler.add(
+        [&commands, &alive, &scheduler] {
+            scheduler.pool().parallel_for(alive.size(), 4, [&commands, &alive](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++)
+                    if (i % 2 == 1)
+                        commands.local().kill(alive[i]);
+            });
+        },
+        ecs::SystemAccess{{}, {}, ecs::SystemPolicy::Parallel});
+
+    for (int tick = 0; tick < 3; tick++) {
+        alive.clear();
+        for (auto [e, spawned] : registry.view<SpawnedBy const>())
+            alive.push_back(e);
+        scheduler.run();
+        commands.apply(registry);
+    }
+
+    std::vector<std::pair<std::uint64_t, SpawnedBy>> entities;
+    for (auto [e, spawned] : registry.view<SpawnedBy const>())
+        entities.emplace_back(e.handle(), spawned);
+    return entities;
+}
+
+} // namespace
+
+TEST(Scheduler, CommandsMatchSequentialExecution) {
+    const auto k_expected = run_spawners(0);
+    ASSERT_FALSE(k_expected.empty());
+    for (int run = 0; run < 4; run++)
+        EXPECT_EQ(run_spawners(3), k_expected) << "run " << run;
+}
+
+TEST(Scheduler, IndependentSystemsRunConcurrently) {
+    ecs::Scheduler scheduler(2);
+    if (scheduler.workers() < 2)
+        GTEST_SKIP();
+
+    std::atomic<int> arrived{0};
+    auto rendezvous = [&arrived] {
+        arrived++;
+        while (arrived.load() < 2)
+            std::this_thread::yield();
+    };
+    scheduler.add(rendezvous, ecs::SystemAccess{{}, {0}, ecs::SystemPolicy::Parallel});
+    scheduler.add(rendezvous, ecs::SystemAccess{{}, {1}, ecs::SystemPolicy::Parallel});
+
+    scheduler.run();
+    EXPECT_EQ(arrived.load(), 2);
+}
+
+TEST(Scheduler, PinnedSystemsStayOnCallingThread) {
+    ecs::Scheduler scheduler(3);
+    auto const k_main = std::this_thread::get_id();
+    std::vector<std::thread::id> seen(4);
+
+    scheduler.add([&seen] { seen[0] = std::this_thread::get_id(); }, ecs::SystemAccess{{}, {0}, ecs::SystemPolicy::MainThread});
+    scheduler.add([&seen] { seen[1] = std::this_thread::get_id(); }, ecs::SystemAccess{{}, {}, ecs::SystemPolicy::Exclusive});
+    scheduler.add([&seen] { seen[2] = std::this_thread::get_id(); }, ecs::SystemAccess{{1}, {}, ecs::SystemPolicy::MainThread});
+    scheduler.add([&seen] { seen[3] = std::this_thread::get_id(); }, ecs::SystemAccess{{}, {2}, ecs::SystemPolicy::Parallel});
+
+    scheduler.run();
+    EXPECT_EQ(seen[0], k_main);
+    EXPECT_EQ(seen[1], k_main);
+    EXPECT_EQ(seen[2], k_main);
+    EXPECT_NE(seen[3], std::thread::id{});
+}
+
+TEST(Scheduler, StopPreventsLaterSystems) {
+    ecs::Scheduler scheduler(2);
+    std::vector<int> order;
+    bool stop = false;
+
+    scheduler.add([&order] { order.push_back(0); }, ecs::SystemAccess{});
+    scheduler.add(
+        [&] {
+            order.push_back(1);
+            stop = true;
+        },
+        ecs::SystemAccess{});
+    scheduler.add([&order] { order.push_back(2); }, ecs::SystemAccess{});
+
+    scheduler.run([&stop] { return stop; });
+    EXPECT_EQ(order, (std::vector<int>{0, 1}));
+}
+
+TEST(Scheduler, StopWaitsForRunningSystems) {
+    ecs::Scheduler scheduler(2);
+    std::atomic<bool> stopping = false;
+    std::atomic<bool> finished = false;
+    bool stop = false;
+
+    scheduler.add(
+        [&] {
+            while (!stopping)
+                std::this_thread::yield();
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            finished = true;
+        },
+        ecs::SystemAccess{{}, {}, ecs::SystemPolicy::Parallel});
+    scheduler.add(
+        [&] {
+            stop = true;
+            stopping = true;
+        },
+        ecs::SystemAccess{{}, {}, ecs::SystemPolicy::MainThread});
+
+    // The caller may tear down what the systems use as soon as `run` returns
+    scheduler.run([&stop] { return stop; });
+    EXPECT_TRUE(finished);
+}
+
+TEST(Scheduler, ClearFromRunningSystem) {
+    ecs::Scheduler scheduler(2);
+    int runs = 0;
+
+    scheduler.add(
+        [&] {
+            scheduler.clear();
+            scheduler.add([&runs] { runs += 10; }, ecs::SystemAccess{});
+        },
+        ecs::SystemAccess{});
+    scheduler.add([&runs] { runs++; }, ecs::SystemAccess{});
+
+    // The current run keeps its graph, the next one sees the replacement
+    scheduler.run();
+    EXPECT_EQ(runs, 1);
+    scheduler.run();
+    EXPECT_EQ(runs, 11);
+    EXPECT_EQ(scheduler.size(), 1);
+}
+
+TEST(Scheduler, RethrowsSystemException) {
+    ecs::Scheduler scheduler(2);
+    bool later = false;
+
+    scheduler.add([] { throw std::runtime_error("boom"); }, ecs::SystemAccess{{}, {0}, ecs::SystemPolicy::Parallel});
+    scheduler.add([&later] { later = true; }, ecs::SystemAccess{{0}, {}, ecs::SystemPolicy::Parallel});
+
+    EXPECT_THROW(scheduler.run(), std::runtime_error);
+    EXPECT_FALSE(later);
+}
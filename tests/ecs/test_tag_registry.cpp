@@ -47,3 +47,31 @@ TEST(TagRegistry, NonExistentTag) {
     EXPECT_EQ(tags.get_tag_id("NonExistent"), ecs::TagRegistry::k_invalid_tag_id);
     EXPECT_FALSE(tags.get_entity("NonExistent").has_value());
 }
+
+TEST(TagRegistry, RebindMovesTheTag) {
+    ecs::Registry registry;
+    ecs::TagRegistry& tags = registry.get_tag_registry();
+    ecs::Entity first = registry.spawn_entity();
+    ecs::Entity second = registry.spawn_entity();
+
+    auto tag_id = tags.create_and_bind_tag("Cursor", first);
+    tags.bind_tag(tag_id, second);
+
+    EXPECT_EQ(tags.get_entity("Cursor").value(), second);
+    EXPECT_EQ(tags.get_tag_id(second), tag_id);
+    EXPECT_EQ(tags.get_tag_id(first), ecs::TagRegistry::k_invalid_tag_id);
+}
+
+TEST(TagRegistry, LookupsByAtom) {
+    ecs::Registry registry;
+    ecs::TagRegistry& tags = registry.get_tag_registry();
+    ecs::Entity e = registry.spawn_entity();
+    const ecs::Atom k_name{"Boss"};
+
+    auto tag_id = tags.create_and_bind_tag(k_name, e);
+
+    EXPECT_EQ(tags.get_tag_atom(tag_id), k_name);
+    EXPECT_EQ(tags.get_tag_id(k_name), tag_id);
+    EXPECT_EQ(tags.get_tag_name(tag_id).data(), k_name.str().data());
+    EXPECT_TRUE(tags.get_tag_atom(tag_id + 1).empty());
+}
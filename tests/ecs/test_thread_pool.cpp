@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+#include "ecs/thread_pool.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+
+void wait_for(std::atomic<int> const& counter, int expected) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (counter.load() < expected && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::yield();
+}
+
+} // namespace
+
+TEST(ThreadPool, RunsEverySubmittedTask) {
+    ecs::ThreadPool pool(4);
+    std::atomic<int> counter{0};
+
+    for (int i = 0; i < 1000; i++)
+        pool.submit([&counter] { counter++; });
+
+    wait_for(counter, 1000);
+    EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST(ThreadPool, NestedTasksAreStolen) {
+    ecs::ThreadPool pool(4);
+    std::atomic<int> counter{0};
+
+    // All children land in the submitting worker's deque; the others have to steal them
+    pool.submit([&pool, &counter] {
+        for (int i = 0; i < 200; i++)
+            pool.submit([&counter] {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+                counter++;
+            });
+    });
+
+    wait_for(counter, 200);
+    EXPECT_EQ(counter.load(), 200);
+}
+
+TEST(ThreadPool, DestructorDrainsQueuedTasks) {
+    std::atomic<int> counter{0};
+    {
+        ecs::ThreadPool pool(2);
+        for (int i = 0; i < 100; i++)
+            pool.submit([&counter] { counter++; });
+    }
+    EXPECT_EQ(counter.load(), 100);
+}
+
+TEST(ThreadPool, ParallelForCoversRangeOnce) {
+    ecs::ThreadPool pool(3);
+    std::vector<std::atomic<int>> hits(10007);
+
+    pool.parallel_for(hits.size(), 64, [&hits](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++)
+            hits[i]++;
+    });
+
+    for (auto const& hit : hits)
+        EXPECT_EQ(hit.load(), 1);
+}
+
+TEST(ThreadPool, ParallelForFromWorkerTask) {
+    ecs::ThreadPool pool(2);
+    std::atomic<int> outer{0};
+    std::atomic<int> total{0};
+
+    for (int i = 0; i < 4; i++)
+        pool.submit([&] {
+            pool.parallel_for(1000, 16, [&total](std::size_t begin, std::size_t end) {
+                total += static_cast<int>(end - begin);
+            });
+            outer++;
+        });
+
+    wait_for(outer, 4);
+    EXPECT_EQ(total.load(), 4000);
+}
+
+TEST(ThreadPool, ChunkSizeIsWholeCacheLines) {
+    ecs::ThreadPool pool(3);
+
+    EXPECT_EQ(pool.chunk_size(100000, 16) % (ecs::k_cache_line_size / 16), 0);
+    EXPECT_EQ(pool.chunk_size(1, 16), ecs::k_cache_line_size / 16);
+    EXPECT_EQ(pool.chunk_size(1000, 200), 1000 / 16);
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include "ecs/registry.h"
+
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct ViewPosition {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+    float x, y;
+};
+
+struct ViewVelocity {
+    static constexpr ecs::StorageMode k_storage_mode = ecs::StorageMode::Packed;
+    float dx, dy;
+};
+
+struct ViewHealth {
+    int hp;
+};
+
+} // namespace
+
+TEST(RegistryView, YieldsOnlyEntitiesWithAllComponents) {
+    ecs::Registry registry;
+    auto a = registry.spawn_entity();
+    auto b = registry.spawn_entity();
+    auto c = registry.spawn_entity();
+
+    registry.add_component(a, ViewPosition{1.0f, 1.0f});
+    registry.add_component(b, ViewPosition{2.0f, 2.0f});
+    registry.add_component(c, ViewPosition{3.0f, 3.0f});
+    registry.add_component(b, ViewVelocity{10.0f, 0.0f});
+    registry.add_component(c, ViewVelocity{20.0f, 0.0f});
+    registry.add_component(c, ViewHealth{5});
+
+    std::vector<ecs::Entity> seen;
+    for (auto [e, pos, vel] : registry.view<ViewPosition, ViewVelocity>()) {
+        pos.x += vel.dx;
+        seen.push_back(e);
+    }
+
+    ASSERT_EQ(seen.size(), 2);
+    EXPECT_EQ(registry.get_components<ViewPosition>()[a.value()]->x, 1.0f);
+    EXPECT_EQ(registry.get_components<ViewPosition>()[b.value()]->x, 12.0f);
+    EXPECT_EQ(registry.get_components<ViewPosition>()[c.value()]->x, 23.0f);
+
+    std::size_t count = 0;
+    for (auto [e, pos, vel, health] : registry.view<ViewPosition const, ViewVelocity const, ViewHealth>()) {
+        EXPECT_EQ(e, c);
+        EXPECT_EQ(health.hp, 5);
+        count++;
+    }
+    EXPECT_EQ(count, 1);
+}
+
+TEST(RegistryView, DrivenBySmallestPool) {
+    ecs::Registry registry;
+    registry.register_component<ViewVelocity>();
+
+    for (int i = 0; i < 100; i++) {
+        auto e = registry.spawn_entity();
+        registry.add_component(e, ViewPosition{static_cast<float>(i), 0.0f});
+        if (i % 25 == 0)
+            registry.add_component(e, ViewVelocity{1.0f, 1.0f});
+    }
+
+    auto view = registry.view<ViewPosition, ViewVelocity>();
+    EXPECT_EQ(view.size_hint(), 4);
+
+    std::size_t count = 0;
+    for (auto [e, pos, vel] : view) {
+        EXPECT_EQ(static_cast<int>(pos.x) % 25, 0);
+        count++;
+    }
+    EXPECT_EQ(count, 4);
+}
+
+TEST(RegistryView, SparseLeadAndKilledEntities) {
+    ecs::Registry registry;
+    auto a = registry.spawn_entity();
+    auto b = registry.spawn_entity();
+
+    registry.add_component(a, ViewHealth{1});
+    registry.add_component(b, ViewHealth{2});
+    registry.add_component(a, ViewPosition{0.0f, 0.0f});
+    registry.add_component(b, ViewPosition{0.0f, 0.0f});
+    registry.kill_entity(a);
+
+    std::vector<int> hps;
+    for (auto [e, health, pos] : std::as_const(registry).view<ViewHealth, ViewPosition>())
+        hps.push_back(health.hp);
+
+    EXPECT_EQ(hps, std::vector<int>{2});
+    EXPECT_FALSE(registry.view<ViewHealth>().contains(a.value()));
+    EXPECT_TRUE(registry.view<ViewHealth>().contains(b.value()));
+}
+
+TEST(RegistryView, UnregisteredComponentThrows) {
+    ecs::Registry registry;
+    registry.register_component<ViewPosition>();
+
+    EXPECT_THROW((void)(registry.view<ViewPosition, ViewHealth>()), std::runtime_error);
+}
+
+TEST(RegistryView, ParEachVisitsEveryMatchOnce) {
+    ecs::Registry registry;
+    ecs::ThreadPool pool(3);
+
+    for (int i = 0; i < 20000; i++) {
+        auto e = registry.spawn_entity();
+        registry.add_component(e, ViewPosition{0.0f, 0.0f});
+        if (i % 3 != 0)
+            registry.add_component(e, ViewVelocity{static_cast<float>(i), 1.0f});
+    }
+
+    auto view = registry.view<ViewPosition, ViewVelocity const>();
+    for (int pass = 0; pass < 2; pass++)
+        view.par_each(pool, [](ecs::Entity, ViewPosition& pos, ViewVelocity const& vel) {
+            pos.x += vel.dx;
+            pos.y += vel.dy;
+        });
+
+    auto const& positions = registry.get_components<ViewPosition>();
+    for (auto [idx, pos] : positions.each()) {
+        const bool k_moving = idx % 3 != 0;
+        EXPECT_EQ(pos.y, k_moving ? 2.0f : 0.0f);
+        EXPECT_EQ(pos.x, k_moving ? 2.0f * static_cast<float>(idx) : 0.0f);
+    }
+}
+
+TEST(RegistryView, ParEachBelowThresholdStaysOnCallingThread) {
+    ecs::Registry registry;
+    ecs::ThreadPool pool(2);
+
+    for (int i = 0; i < 100; i++)
+        registry.add_component(registry.spawn_entity(), ViewHealth{i});
+
+    auto const k_caller = std::this_thread::get_id();
+    std::size_t count = 0;
+    registry.view<ViewHealth>().par_each(pool, [&](ecs::Entity, ViewHealth&) {
+        EXPECT_EQ(std::this_thread::get_id(), k_caller);
+        count++;
+    });
+    EXPECT_EQ(count, 100);
+}
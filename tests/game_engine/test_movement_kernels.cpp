@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "kernels/movement_kernels.h"
+
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <vector>
+
+using namespace engn;
+
+namespace {
+
+std::vector<simd::Isa> supported_isas() {
+    std::vector<simd::Isa> isas;
+    for (auto isa : {simd::Isa::scalar, simd::Isa::sse2, simd::Isa::avx2}) {
+        if (simd::movement_kernels(isa).isa == isa)
+            isas.push_back(isa);
+    }
+    return isas;
+}
+
+// Phases in turns: small, negative, around the folds and large timers. The odd count leaves a scalar tail.
+std::vector<float> test_phases() {
+    std::vector<float> phases;
+    for (int i = -2000; i <= 2001; i++)
+        phases.push_back(static_cast<float>(i) * 0.00125f);
+    for (float phase : {0.25f, -0.25f, 0.5f, -0.5f, 0.75f, 1.0f, 1.5f, 123.456f, -987.654f, 1e5f + 0.3f, 3e7f, 5e9f})
+        phases.push_back(phase);
+    return phases;
+}
+
+} // namespace
+
+TEST(MovementKernels, SineWaveStaysWithinTolerance) {
+    auto phases = test_phases();
+    std::vector<float> amplitude(phases.size(), 1.0f);
+    std::vector<float> out(phases.size());
+
+    for (auto isa : supported_isas()) {
+        simd::movement_kernels(isa).sine_wave(out.data(), phases.data(), amplitude.data(), phases.size());
+
+        for (std::size_t i = 0; i < phases.size(); i++) {
+            const double k_exact = std::sin(2.0 * std::numbers::pi * std::remainder(static_cast<double>(phases[i]), 1.0));
+            EXPECT_NEAR(out[i], k_exact, simd::k_sine_tolerance) << simd::isa_name(isa) << " at " << phases[i];
+        }
+    }
+}
+
+TEST(MovementKernels, SineWaveScalesByAmplitude) {
+    std::vector<float> phases{0.25f, 0.25f, 0.75f, 0.0f, 0.25f};
+    std::vector<float> amplitude{3.0f, -2.0f, 10.0f, 50.0f, 0.0f};
+    std::vector<float> out(phases.size());
+
+    for (auto isa : supported_isas()) {
+        simd::movement_kernels(isa).sine_wave(out.data(), phases.data(), amplitude.data(), phases.size());
+        EXPECT_NEAR(out[0], 3.0f, 3.0f * simd::k_sine_tolerance);
+        EXPECT_NEAR(out[1], -2.0f, 2.0f * simd::k_sine_tolerance);
+        EXPECT_NEAR(out[2], -10.0f, 10.0f * simd::k_sine_tolerance);
+        EXPECT_FLOAT_EQ(out[3], 0.0f);
+        EXPECT_FLOAT_EQ(out[4], 0.0f);
+    }
+}
+
+TEST(MovementKernels, SquareWaveMatchesFmod) {
+    auto phases = test_phases();
+    std::vector<float> amplitude(phases.size(), 4.0f);
+    std::vector<float> out(phases.size());
+
+    for (auto isa : supported_isas()) {
+        simd::movement_kernels(isa).square_wave(out.data(), phases.data(), amplitude.data(), phases.size());
+
+        for (std::size_t i = 0; i < phases.size(); i++) {
+            const float k_expected = (std::fmod(phases[i], 2.0f) < 1.0f) ? 4.0f : -4.0f;
+            EXPECT_EQ(out[i], k_expected) << simd::isa_name(isa) << " at " << phases[i];
+        }
+    }
+}
+
+TEST(MovementKernels, IntegrateMatchesScalarPath) {
+    for (auto isa : supported_isas()) {
+        std::vector<float> pos(37);
+        std::vector<float> vel(37);
+        for (std::size_t i = 0; i < pos.size(); i++) {
+            pos[i] = static_cast<float>(i) * 1.5f;
+            vel[i] = 100.0f - static_cast<float>(i) * 7.25f;
+        }
+
+        simd::movement_kernels(isa).integrate(pos.data(), vel.data(), 0.016f, pos.size());
+        for (std::size_t i = 0; i < pos.size(); i++) {
+            float expected = static_cast<float>(i) * 1.5f;
+            expected += (100.0f - static_cast<float>(i) * 7.25f) * 0.016f;
+            EXPECT_EQ(pos[i], expected) << simd::isa_name(isa);
+        }
+    }
+}
+
+TEST(MovementKernels, PatternBatchBinsByType) {
+    using Type = cpnt::MovementPattern::PatternType;
+    std::vector<cpnt::MovementPattern> patterns{
+        {Type::Sine, 100.0f, 8.0f, 0.5f, 0.5f},
+        {Type::Dive, 100.0f, 8.0f, 0.5f, 0.5f},
+        {Type::ZigZag, 100.0f, 5.0f, 1.0f, 1.5f},
+        {Type::Straight, 100.0f, 5.0f, 1.0f, 1.5f},
+    };
+    std::vector<cpnt::Velocity> velocities(patterns.size(), cpnt::Velocity{0.0f, 42.0f});
+
+    simd::PatternBatch batch;
+    for (std::size_t i = 0; i < patterns.size(); i++)
+        batch.add(patterns[i], velocities[i]);
+    batch.flush(simd::movement_kernels());
+
+    EXPECT_NEAR(velocities[0].vy, 8.0f, 8.0f * simd::k_sine_tolerance);
+    EXPECT_NEAR(velocities[1].vy, 16.0f, 16.0f * simd::k_sine_tolerance);
+    EXPECT_EQ(velocities[2].vy, -5.0f);
+    EXPECT_EQ(velocities[3].vy, 42.0f);
+    EXPECT_FALSE(batch.full());
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include "components/components.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+#include <vector>
+
+using namespace engn::cpnt;
+
+static_assert(std::is_trivially_copyable_v<Transform> && std::is_standard_layout_v<Transform>);
+static_assert(std::is_trivially_copyable_v<Velocity> && std::is_standard_layout_v<Velocity>);
+static_assert(std::is_trivially_copyable_v<Health> && std::is_standard_layout_v<Health>);
+static_assert(std::is_trivially_copyable_v<Replicated> && std::is_standard_layout_v<Replicated>);
+static_assert(std::is_trivially_copyable_v<Bullet> && std::is_standard_layout_v<Bullet>);
+
+namespace {
+
+std::vector<std::byte> bytes(std::initializer_list<int> values) {
+    std::vector<std::byte> result;
+    for (int value : values)
+        result.push_back(static_cast<std::byte>(value));
+    return result;
+}
+
+// Golden outputs of the wire format, which the clients and the server must agree on
+template <typename TComponent>
+void expect_golden(TComponent const& component, engn::ComponentType type, std::vector<std::byte> const& golden) {
+    auto serialized = serialize(component);
+
+    EXPECT_EQ(serialized.type, type);
+    EXPECT_EQ(serialized.data, golden);
+    EXPECT_EQ(sync_size(component), golden.size());
+}
+
+} // namespace
+
+TEST(SyncComponents, GoldenTransform) {
+    expect_golden(Transform{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f},
+        engn::ComponentType::transform,
+        bytes({0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40,
+               0x00, 0x00, 0xa0, 0x40, 0x00, 0x00, 0xc0, 0x40, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0x00, 0x41,
+               0x00, 0x00, 0x10, 0x41, 0x00, 0x00, 0x20, 0x41, 0x00, 0x00, 0x30, 0x41}));
+}
+
+TEST(SyncComponents, GoldenVelocity) {
+    expect_golden(Velocity{1.0f, -2.0f, 0.5f, 0.0f, 0.25f, 4.0f}, engn::ComponentType::velocity,
+        bytes({0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x3f,
+               0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3e, 0x00, 0x00, 0x80, 0x40}));
+}
+
+TEST(SyncComponents, GoldenIntegers) {
+    expect_golden(Health{100, 150, 3}, engn::ComponentType::health,
+        bytes({0x64, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00}));
+    expect_golden(Replicated{7, 3, 42}, engn::ComponentType::replicated,
+        bytes({0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}));
+    expect_golden(Tag{5}, engn::ComponentType::tag, bytes({0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}));
+}
+
+TEST(SyncComponents, GoldenPackedFields) {
+    Player player{2};
+    player.shoot_cooldown = 0.5f;
+
+    // Fields are sent back to back, without the struct padding
+    expect_golden(player, engn::ComponentType::player, bytes({0x02, 0x00, 0x00, 0x00, 0x3f}));
+    expect_golden(Stats{1200, 10, 4, 2, 2500, true}, engn::ComponentType::stats,
+        bytes({0xb0, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+               0x02, 0x00, 0x00, 0x00, 0xc4, 0x09, 0x00, 0x00, 0x01}));
+    expect_golden(Boss{1.0f, 2.0f, 3.0f, true, false, Vector2{1350.0f, 400.0f}, 0.5f, 2000.0f},
+        engn::ComponentType::boss,
+        bytes({0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40, 0x01, 0x00,
+               0x00, 0xc0, 0xa8, 0x44, 0x00, 0x00, 0xc8, 0x43, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0xfa, 0x44}));
+}
+
+TEST(SyncComponents, GoldenMisc) {
+    expect_golden(Hitbox{32.0f, 16.0f, 2.0f, -2.0f}, engn::ComponentType::hitbox,
+        bytes({0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x80, 0x41, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xc0}));
+    expect_golden(MovementPattern{MovementPattern::PatternType::ZigZag, 120.0f, 8.0f, 0.5f, 1.0f, 300.0f},
+        engn::ComponentType::movement_pattern,
+        bytes({0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x42, 0x00, 0x00, 0x00, 0x41,
+               0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x96, 0x43}));
+    expect_golden(Shooter{1.5f}, engn::ComponentType::shooter, bytes({0x00, 0x00, 0xc0, 0x3f}));
+    expect_golden(Controllable{300.0f}, engn::ComponentType::controllable, bytes({0x00, 0x00, 0x96, 0x43}));
+    expect_golden(EntityType{"enemy"}, engn::ComponentType::entity_type,
+        bytes({0x05, 0x00, 0x00, 0x00, 0x65, 0x6e, 0x65, 0x6d, 0x79}));
+}
+
+TEST(SyncComponents, GoldenTagComponents) {
+    expect_golden(Bullet{}, engn::ComponentType::bullet, {});
+    expect_golden(Enemy{}, engn::ComponentType::enemy, {});
+    expect_golden(BulletShooter{}, engn::ComponentType::bullet_shooter, {});
+}
+
+TEST(SyncComponents, RoundTrip) {
+    Transform transform{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f};
+    Transform transform_copy;
+    ASSERT_TRUE(deserialize(transform_copy, serialize(transform).data));
+    EXPECT_FLOAT_EQ(transform_copy.x, 1.0f);
+    EXPECT_FLOAT_EQ(transform_copy.origin_y, 5.0f);
+    EXPECT_FLOAT_EQ(transform_copy.sz, 11.0f);
+
+    Stats stats{1200, 10, 4, 2, 2500, true};
+    Stats stats_copy;
+    ASSERT_TRUE(deserialize(stats_copy, serialize(stats).data));
+    EXPECT_EQ(stats_copy.score, 1200);
+    EXPECT_EQ(stats_copy.point_to_next_level, 2500);
+    EXPECT_TRUE(stats_copy.boss_active);
+
+    EntityType entity_type;
+    ASSERT_TRUE(deserialize(entity_type, serialize(EntityType{"boss"}).data));
+    EXPECT_EQ(entity_type.type_name, "boss");
+}
+
+TEST(SyncComponents, ShortDataLeavesComponentUntouched) {
+    auto data = serialize(Health{100, 150, 3}).data;
+    data.pop_back();
+
+    Health health{1, 2, 0};
+    EXPECT_FALSE(deserialize(health, data));
+    EXPECT_EQ(health.hp, 1);
+    EXPECT_EQ(health.max_hp, 2);
+
+    auto name = serialize(EntityType{"enemy"}).data;
+    name.pop_back();
+    EntityType entity_type{"player"};
+    EXPECT_FALSE(deserialize(entity_type, name));
+    EXPECT_EQ(entity_type.type_name, "player");
+}
+
+TEST(SyncComponents, SerializeIntoCallerBuffer) {
+    Velocity velocity{1.0f, -2.0f, 0.5f, 0.0f, 0.25f, 4.0f};
+    std::array<std::byte, 64> buffer{};
+
+    ASSERT_EQ(serialize_into(velocity, buffer), sync_size(velocity));
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.begin() + 24, serialize(velocity).data.begin()));
+
+    std::array<std::byte, 8> small{};
+    EXPECT_EQ(serialize_into(velocity, small), 0u);
+    EXPECT_EQ(serialize_into(EntityType{"enemy"}, small), 0u);
+}
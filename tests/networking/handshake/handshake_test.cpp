@@ -60,6 +60,7 @@ TEST(HandshakeTest, ResLoginFailRoundTrip) {
     EXPECT_FALSE(parsed->m_success);
     EXPECT_EQ(parsed->m_player_id, 0);
     EXPECT_EQ(parsed->m_effective_fragment_size, 512);
+    EXPECT_EQ(parsed->m_version, k_protocol_version);
 }
 
 TEST(HandshakeTest, ReqLogoutRoundTrip) {
@@ -80,3 +81,92 @@ TEST(HandshakeTest, InvalidPacketCommand) {
     auto parsed = parse_req_login(packet);
     EXPECT_FALSE(parsed.has_value());
 }
+
+TEST(HandshakeTest, DefaultsOmitChecksumBytes) {
+    ReqLogin req{};
+    req.m_username = "Player1";
+    ResLogin res{};
+    res.m_success = true;
+
+    // name length + name + version + fragment size, and success + player id + fragment size + version
+    EXPECT_EQ(make_req_login(req).payload.size(), 1 + 7 + 4 + 2);
+    EXPECT_EQ(make_res_login(res).payload.size(), 1 + 4 + 2 + 4);
+    EXPECT_EQ(parse_req_login(make_req_login(req))->m_checksums,
+              net::checksum::algorithm_bit(net::checksum::Algorithm::KCrc16Ccitt));
+    EXPECT_EQ(parse_res_login(make_res_login(res))->m_checksum, net::checksum::Algorithm::KCrc16Ccitt);
+}
+
+TEST(HandshakeTest, ChecksumNegotiationRoundTrip) {
+    using net::checksum::Algorithm;
+    ReqLogin req{};
+    req.m_username = "Player1";
+    req.m_checksums = net::checksum::algorithm_bit(Algorithm::KCrc16Ccitt) |
+                      net::checksum::algorithm_bit(Algorithm::KCrc32c);
+    auto parsed_req = parse_req_login(make_req_login(req));
+    ASSERT_TRUE(parsed_req.has_value());
+    EXPECT_EQ(parsed_req->m_checksums, req.m_checksums);
+    EXPECT_EQ(parsed_req->m_preferred_fragment_size, net::k_max_payload_size);
+
+    // CRC-32C is only picked when this host computes it in hardware
+    const Algorithm k_expected =
+        net::checksum::has_hardware_crc32c() ? Algorithm::KCrc32c : Algorithm::KCrc16Ccitt;
+    EXPECT_EQ(net::checksum::negotiate(parsed_req->m_checksums), k_expected);
+    EXPECT_EQ(net::checksum::negotiate(net::checksum::algorithm_bit(Algorithm::KCrc16Ccitt)), Algorithm::KCrc16Ccitt);
+
+    ResLogin res{};
+    res.m_success = true;
+    res.m_checksum = Algorithm::KCrc32c;
+    auto parsed_res = parse_res_login(make_res_login(res));
+    ASSERT_TRUE(parsed_res.has_value());
+    EXPECT_EQ(parsed_res->m_checksum, Algorithm::KCrc32c);
+}
+
+TEST(HandshakeTest, ServerRefusesOtherProtocolVersion) {
+    asio::io_context context;
+    const asio::ip::udp::endpoint k_client(asio::ip::address_v4::loopback(), 4242);
+    auto session = std::make_shared<net::Session>(context, k_client);
+    session->start([](const net::Packet&, const asio::ip::udp::endpoint&) {},
+                   [](const net::Packet&, const asio::ip::udp::endpoint&) {});
+
+    ReqLogin req{};
+    req.m_username = "Player1";
+    req.m_version = k_protocol_version - 1;
+    req.m_preferred_fragment_size = 100;
+    req.m_checksums = net::checksum::supported_algorithms();
+
+    // Handled with a refusal: neither the fragment size nor the checksum is negotiated
+    EXPECT_TRUE(handle_server_handshake(make_req_login(req), session, k_client));
+    EXPECT_EQ(session->fragment_payload_size(), net::k_max_payload_size);
+    EXPECT_EQ(session->checksum_for(k_client), net::checksum::Algorithm::KCrc16Ccitt);
+}
+
+TEST(HandshakeTest, ClientRefusesOtherProtocolVersion) {
+    asio::io_context context;
+    const asio::ip::udp::endpoint k_server(asio::ip::address_v4::loopback(), 4242);
+    auto session = std::make_shared<net::Session>(context, k_server);
+
+    ResLogin res{};
+    res.m_success = true;
+    res.m_player_id = 7;
+    res.m_effective_fragment_size = 100;
+
+    // A v1 server's reply ends at the fragment size
+    auto v1_reply = make_res_login(res);
+    v1_reply.payload.resize(1 + 4 + 2);
+    auto refused = handle_client_handshake(v1_reply, session, k_server);
+    ASSERT_TRUE(refused.has_value());
+    EXPECT_FALSE(refused->m_success);
+    EXPECT_EQ(refused->m_version, 1);
+
+    res.m_version = k_protocol_version + 1;
+    refused = handle_client_handshake(make_res_login(res), session, k_server);
+    ASSERT_TRUE(refused.has_value());
+    EXPECT_FALSE(refused->m_success);
+    EXPECT_EQ(session->fragment_payload_size(), net::k_max_payload_size);
+
+    res.m_version = k_protocol_version;
+    auto accepted = handle_client_handshake(make_res_login(res), session, k_server);
+    ASSERT_TRUE(accepted.has_value());
+    EXPECT_TRUE(accepted->m_success);
+    EXPECT_EQ(session->fragment_payload_size(), 100);
+}
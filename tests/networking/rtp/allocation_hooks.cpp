@@ -0,0 +1,27 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Replacement operator new counting the heap allocations made while enabled, across the whole test binary.
+// Kept in a TU of its own: inlined next to the tests, the free() below gets paired with a new-expression.
+// The array forms forward to these and the aligned forms keep their default, self-consistent implementation.
+std::atomic<bool> g_count_allocations{false};
+std::atomic<std::size_t> g_allocations{0};
+
+void* operator new(std::size_t size) {
+    if (g_count_allocations.load(std::memory_order_relaxed)) {
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include "rtp/networking.h"
+
+#include <vector>
+
+using namespace net;
+
+namespace {
+constexpr DatagramBatchConfig k_batched{.enabled = true};
+
+Packet make_numbered_packet(std::uint8_t number) {
+    Packet packet{};
+    packet.header.m_command = static_cast<std::uint8_t>(CommandId::KServerEntityState);
+    packet.payload.assign(64, std::byte{number});
+    return packet;
+}
+
+class BatchIoTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        if (!k_batched_io_supported) {
+            GTEST_SKIP() << "batched datagram I/O is not supported on this platform";
+        }
+    }
+};
+} // namespace
+
+TEST_F(BatchIoTest, CorkedTickGoesOutInOneSendmmsg) {
+    constexpr std::size_t k_packets = 40;
+    asio::io_context context;
+    auto sender = std::make_shared<UdpTransport>(context, 0, k_batched);
+    auto receiver = std::make_shared<UdpTransport>(context, 0, k_batched);
+    ASSERT_TRUE(sender->batching());
+    const asio::ip::udp::endpoint k_receiver_endpoint(asio::ip::address_v4::loopback(),
+                                                      receiver->local_endpoint().port());
+
+    std::vector<std::uint8_t> received;
+    receiver->start([&](const asio::error_code& ec, const Packet& packet, const asio::ip::udp::endpoint& from) {
+        ASSERT_FALSE(ec);
+        EXPECT_EQ(from.port(), sender->local_endpoint().port());
+        received.push_back(static_cast<std::uint8_t>(packet.payload.front()));
+        if (received.size() == k_packets) {
+            receiver->close();
+        }
+    });
+
+    std::size_t completed = 0;
+    sender->cork();
+    for (std::size_t i = 0; i < k_packets; ++i) {
+        sender->async_send(make_numbered_packet(static_cast<std::uint8_t>(i)), k_receiver_endpoint,
+                           [&completed, i](const asio::error_code& ec, const Packet& packet) {
+                               EXPECT_FALSE(ec);
+                               EXPECT_EQ(packet.payload.front(), std::byte{static_cast<std::uint8_t>(i)});
+                               ++completed;
+                           });
+    }
+    // Nothing leaves a corked transport
+    context.poll();
+    EXPECT_EQ(sender->stats().send_syscalls, 0);
+    sender->flush();
+    context.run_for(std::chrono::seconds(5));
+
+    ASSERT_EQ(received.size(), k_packets);
+    for (std::size_t i = 0; i < k_packets; ++i) {
+        EXPECT_EQ(received[i], i);
+    }
+    EXPECT_EQ(completed, k_packets);
+    EXPECT_EQ(sender->stats().send_syscalls, 1);
+    EXPECT_EQ(sender->stats().packets_sent, k_packets);
+    EXPECT_EQ(receiver->stats().packets_received, k_packets);
+    EXPECT_LT(receiver->stats().receive_syscalls, k_packets);
+}
+
+TEST_F(BatchIoTest, FullBatchFlushesWhileCorked) {
+    asio::io_context context;
+    auto sender = std::make_shared<UdpTransport>(context, 0, DatagramBatchConfig{.enabled = true, .send_batch = 4});
+    auto receiver = std::make_shared<UdpTransport>(context, 0);
+    const asio::ip::udp::endpoint k_receiver_endpoint(asio::ip::address_v4::loopback(),
+                                                      receiver->local_endpoint().port());
+
+    sender->cork();
+    for (std::uint8_t i = 0; i < 6; ++i) {
+        sender->async_send(make_numbered_packet(i), k_receiver_endpoint);
+    }
+    context.poll();
+    EXPECT_EQ(sender->stats().packets_sent, 6);
+    EXPECT_EQ(sender->stats().send_syscalls, 2);
+}
+
+TEST_F(BatchIoTest, BatchedSessionsDeliverReliablePackets) {
+    asio::io_context context;
+    auto server = std::make_shared<Session>(context, asio::ip::udp::endpoint{}, ReliabilityConfig{}, 0, k_batched);
+    auto client = std::make_shared<Session>(context, asio::ip::udp::endpoint{}, ReliabilityConfig{}, 0, k_batched);
+
+    std::vector<std::uint8_t> received;
+    server->start(
+        [&](const Packet& packet, const asio::ip::udp::endpoint&) {
+            received.push_back(std::to_integer<std::uint8_t>(packet.payload[0]));
+        },
+        [](const Packet&, const asio::ip::udp::endpoint&) {});
+    client->start([](const Packet&, const asio::ip::udp::endpoint&) {},
+                  [](const Packet&, const asio::ip::udp::endpoint&) {});
+
+    const asio::ip::udp::endpoint k_server_endpoint(asio::ip::address_v4::loopback(), server->local_endpoint().port());
+    client->cork();
+    for (std::uint8_t i = 0; i < 8; ++i) {
+        client->send(make_numbered_packet(i), k_server_endpoint, true);
+    }
+    client->flush();
+
+    const auto k_deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (received.size() < 8 && std::chrono::steady_clock::now() < k_deadline) {
+        context.run_one_for(std::chrono::milliseconds(50));
+    }
+    ASSERT_EQ(received.size(), 8);
+    for (std::uint8_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(received[i], i);
+    }
+}
+
+TEST_F(BatchIoTest, CorkGuardFlushesWhenTheTickThrows) {
+    asio::io_context context;
+    auto server = std::make_shared<Session>(context, asio::ip::udp::endpoint{}, ReliabilityConfig{}, 0, k_batched);
+    auto client = std::make_shared<Session>(context, asio::ip::udp::endpoint{}, ReliabilityConfig{}, 0, k_batched);
+
+    std::size_t received = 0;
+    server->start([](const Packet&, const asio::ip::udp::endpoint&) {},
+                  [&received](const Packet&, const asio::ip::udp::endpoint&) { ++received; });
+    client->start([](const Packet&, const asio::ip::udp::endpoint&) {},
+                  [](const Packet&, const asio::ip::udp::endpoint&) {});
+
+    const asio::ip::udp::endpoint k_server_endpoint(asio::ip::address_v4::loopback(), server->local_endpoint().port());
+    EXPECT_THROW(
+        {
+            const CorkGuard k_cork(*client);
+            client->send(make_numbered_packet(0), k_server_endpoint);
+            throw std::runtime_error("tick failed");
+        },
+        std::runtime_error);
+
+    // Later sends are not held back by a cork left behind
+    client->send(make_numbered_packet(1), k_server_endpoint);
+    const auto k_deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (received < 2 && std::chrono::steady_clock::now() < k_deadline) {
+        context.run_one_for(std::chrono::milliseconds(50));
+    }
+    EXPECT_EQ(received, 2);
+}
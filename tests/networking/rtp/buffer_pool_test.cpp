@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include "rtp/networking.h"
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace net;
+
+// Defined with the replacement operator new in allocation_hooks.cpp
+extern std::atomic<bool> g_count_allocations;
+extern std::atomic<std::size_t> g_allocations;
+
+namespace {
+struct AllocationCounter {
+    AllocationCounter() {
+        g_allocations = 0;
+        g_count_allocations = true;
+    }
+    ~AllocationCounter() {
+        g_count_allocations = false;
+    }
+    [[nodiscard]] std::size_t count() const {
+        return g_allocations.load();
+    }
+};
+} // namespace
+
+TEST(PacketBufferPoolTest, RecyclesSlabs) {
+    PacketBufferPool pool(1);
+    EXPECT_EQ(pool.capacity(), PacketBufferPool::k_slabs_per_chunk);
+
+    std::set<std::uint8_t*> slabs;
+    {
+        std::vector<PacketBufferPool::Buffer> buffers;
+        for (std::size_t i = 0; i < PacketBufferPool::k_slabs_per_chunk; ++i) {
+            buffers.push_back(pool.acquire());
+            slabs.insert(buffers.back().data().data());
+        }
+        EXPECT_EQ(slabs.size(), PacketBufferPool::k_slabs_per_chunk);
+        EXPECT_EQ(pool.capacity(), PacketBufferPool::k_slabs_per_chunk);
+
+        // Every slab is in use: the pool grows by one chunk
+        auto extra = pool.acquire();
+        EXPECT_EQ(pool.capacity(), 2 * PacketBufferPool::k_slabs_per_chunk);
+        EXPECT_EQ(slabs.count(extra.data().data()), 0);
+    }
+
+    auto buffer = pool.acquire();
+    EXPECT_EQ(buffer.size(), 0);
+    EXPECT_THROW(buffer.resize(PacketBufferPool::k_slab_size + 1), std::length_error);
+    EXPECT_EQ(pool.capacity(), 2 * PacketBufferPool::k_slabs_per_chunk);
+}
+
+TEST(PacketBufferPoolTest, ConcurrentAcquireRelease) {
+    constexpr int k_threads = 4;
+    constexpr int k_rounds = 10000;
+    PacketBufferPool pool;
+    std::atomic<bool> corrupted = false;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < k_threads; ++t) {
+        threads.emplace_back([&pool, &corrupted, t]() {
+            for (int i = 0; i < k_rounds; ++i) {
+                auto first = pool.acquire();
+                auto second = pool.acquire();
+                first.data()[0] = static_cast<std::uint8_t>(t);
+                second.data()[0] = static_cast<std::uint8_t>(t);
+                if (first.data()[0] != t || second.data()[0] != t || first.data().data() == second.data().data()) {
+                    corrupted = true;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_FALSE(corrupted);
+    EXPECT_LE(pool.capacity(), 2 * PacketBufferPool::k_slabs_per_chunk);
+}
+
+TEST(PacketBufferPoolTest, EncodeDecodeInPlace) {
+    PacketBufferPool pool;
+    Packet original{};
+    original.header.m_command = 10;
+    original.header.m_sequence = 42;
+    original.payload = {std::byte{0x01}, std::byte{0x02}, std::byte{0x03}};
+
+    auto buffer = pool.acquire();
+    buffer.resize(original.encode(buffer.data()));
+    EXPECT_EQ(buffer.size(), k_header_size + original.payload.size());
+    EXPECT_TRUE(std::ranges::equal(buffer.bytes(), original.to_buffer()));
+
+    Packet decoded{};
+    decoded.payload.reserve(k_max_payload_size);
+    {
+        AllocationCounter counter;
+        Packet::decode(buffer.bytes(), decoded);
+        buffer.resize(original.encode(buffer.data()));
+        EXPECT_EQ(counter.count(), 0);
+    }
+    EXPECT_EQ(decoded.header.m_sequence, 42);
+    EXPECT_EQ(decoded.payload, original.payload);
+
+    // The checksum field is skipped, not zeroed: flipping it still fails the check
+    auto corrupted = original.to_buffer();
+    corrupted[k_header_size - 1] ^= 0x01U;
+    EXPECT_THROW(Packet::from_buffer(corrupted), std::runtime_error);
+}
+
+// Ping-pong between two transports: once warm, a round trip allocates nothing.
+namespace {
+std::size_t steady_state_allocations(DatagramBatchConfig batching) {
+    constexpr int k_warmup_rounds = 32;
+    constexpr int k_measured_rounds = 256;
+    asio::io_context context;
+    auto left = std::make_shared<UdpTransport>(context, 0, batching);
+    auto right = std::make_shared<UdpTransport>(context, 0, batching);
+    const asio::ip::udp::endpoint k_left_endpoint(asio::ip::address_v4::loopback(), left->local_endpoint().port());
+    const asio::ip::udp::endpoint k_right_endpoint(asio::ip::address_v4::loopback(), right->local_endpoint().port());
+
+    Packet ping{};
+    ping.header.m_command = static_cast<std::uint8_t>(CommandId::KServerEntityState);
+    ping.payload.resize(k_max_payload_size / 2);
+    int rounds = 0;
+    std::size_t allocations = 0;
+    std::optional<AllocationCounter> counter;
+
+    right->start([&](const asio::error_code& ec, const Packet& packet, const asio::ip::udp::endpoint&) {
+        ASSERT_FALSE(ec);
+        right->async_send(packet, k_left_endpoint);
+    });
+    left->start([&](const asio::error_code& ec, const Packet& packet, const asio::ip::udp::endpoint&) {
+        ASSERT_FALSE(ec);
+        ++rounds;
+        if (rounds == k_warmup_rounds) {
+            counter.emplace();
+        }
+        if (rounds == k_warmup_rounds + k_measured_rounds) {
+            allocations = counter->count();
+            counter.reset();
+            left->close();
+            right->close();
+            return;
+        }
+        left->async_send(packet, k_right_endpoint);
+    });
+
+    asio::post(context, [&]() { left->async_send(ping, k_right_endpoint); });
+    context.run_for(std::chrono::seconds(10));
+
+    EXPECT_EQ(rounds, k_warmup_rounds + k_measured_rounds);
+    return allocations;
+}
+} // namespace
+
+TEST(PacketBufferPoolTest, SteadyStateSendReceiveDoesNotAllocate) {
+    EXPECT_EQ(steady_state_allocations({}), 0);
+}
+
+TEST(PacketBufferPoolTest, SteadyStateBatchedSendReceiveDoesNotAllocate) {
+    if (!k_batched_io_supported) {
+        GTEST_SKIP() << "batched datagram I/O is not supported on this platform";
+    }
+    EXPECT_EQ(steady_state_allocations({.enabled = true}), 0);
+}
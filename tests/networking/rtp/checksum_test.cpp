@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include "rtp/checksum.h"
+#include "rtp/networking.h"
+
+#include <random>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace net;
+
+namespace {
+std::span<const std::uint8_t> as_bytes(std::string_view text) {
+    return {reinterpret_cast<const std::uint8_t*>(text.data()), text.size()};
+}
+
+std::uint32_t crc32c(std::span<const std::uint8_t> data, bool hardware) {
+    const std::uint32_t k_crc = hardware ? checksum::crc32c_update_hardware(data, checksum::k_crc32c_init)
+                                         : checksum::crc32c_update_software(data, checksum::k_crc32c_init);
+    return ~k_crc;
+}
+} // namespace
+
+TEST(ChecksumTest, CheckValues) {
+    const auto k_check = as_bytes("123456789");
+    // CRC-16/CCITT-FALSE and CRC-32C check values
+    EXPECT_EQ(checksum::crc16_bitwise(k_check), 0x29B1);
+    EXPECT_EQ(checksum::crc16_table(k_check), 0x29B1);
+    EXPECT_EQ(checksum::crc16_slice8(k_check), 0x29B1);
+    EXPECT_EQ(crc32c(k_check, false), 0xE3069283U);
+    if (checksum::has_hardware_crc32c()) {
+        EXPECT_EQ(crc32c(k_check, true), 0xE3069283U);
+    }
+}
+
+TEST(ChecksumTest, VariantsMatchReference) {
+    std::mt19937 rng(1234);
+    std::vector<std::uint8_t> data(k_max_packet_size);
+    for (auto& byte : data) {
+        byte = static_cast<std::uint8_t>(rng());
+    }
+
+    // Every length up to a few blocks, then the packet sizes, from unaligned offsets
+    for (std::size_t size = 0; size <= data.size() - 3; size += (size < 64 ? 1 : 61)) {
+        for (std::size_t offset = 0; offset < 3; ++offset) {
+            const auto k_data = std::span<const std::uint8_t>(data).subspan(offset, size);
+            const std::uint16_t k_reference = checksum::crc16_bitwise(k_data);
+            EXPECT_EQ(checksum::crc16_table(k_data), k_reference) << size;
+            EXPECT_EQ(checksum::crc16_slice8(k_data), k_reference) << size;
+            if (checksum::has_hardware_crc32c()) {
+                EXPECT_EQ(crc32c(k_data, true), crc32c(k_data, false)) << size;
+            }
+        }
+    }
+
+    // Streaming in pieces gives the same result as one pass
+    const auto k_all = std::span<const std::uint8_t>(data);
+    EXPECT_EQ(checksum::crc16_slice8(k_all.subspan(13), checksum::crc16_slice8(k_all.first(13))),
+              checksum::crc16_bitwise(k_all));
+    const std::uint32_t k_head = checksum::crc32c_update(k_all.first(13), checksum::k_crc32c_init);
+    EXPECT_EQ(~checksum::crc32c_update(k_all.subspan(13), k_head), crc32c(k_all, false));
+}
+
+TEST(ChecksumTest, PacketFlagSelectsAlgorithm) {
+    Packet original{};
+    original.header.m_command = static_cast<std::uint8_t>(CommandId::KServerEntityState);
+    original.payload.resize(100, std::byte{0x5A});
+
+    const auto k_crc16 = original.to_buffer();
+    original.header.m_flags = set_flag(original.header.m_flags, PacketFlag::KCrc32c);
+    const auto k_crc32c = original.to_buffer();
+    EXPECT_NE(k_crc16, k_crc32c);
+
+    const Packet k_decoded = Packet::from_buffer(k_crc32c);
+    EXPECT_TRUE(has_flag(k_decoded.header.m_flags, PacketFlag::KCrc32c));
+    EXPECT_EQ(k_decoded.payload, original.payload);
+
+    // Clearing the flag makes the receiver check the wrong algorithm
+    auto stripped = k_crc32c;
+    stripped[3] = clear_flag(stripped[3], PacketFlag::KCrc32c);
+    EXPECT_THROW(Packet::from_buffer(stripped), std::runtime_error);
+
+    auto corrupted = k_crc32c;
+    corrupted[k_header_size + 10] ^= 0x01U;
+    EXPECT_THROW(Packet::from_buffer(corrupted), std::runtime_error);
+}
+
+TEST(ChecksumTest, SessionAppliesNegotiatedChecksum) {
+    asio::io_context context;
+    const asio::ip::udp::endpoint k_peer(asio::ip::address_v4::loopback(), 4242);
+    auto session = std::make_shared<Session>(context, k_peer);
+
+    EXPECT_EQ(session->checksum_for(k_peer), checksum::Algorithm::KCrc16Ccitt);
+    session->set_checksum(k_peer, checksum::Algorithm::KCrc32c);
+    EXPECT_EQ(session->checksum_for(k_peer), checksum::Algorithm::KCrc32c);
+    EXPECT_EQ(session->checksum_for(asio::ip::udp::endpoint(asio::ip::address_v4::loopback(), 4243)),
+              checksum::Algorithm::KCrc16Ccitt);
+    session->set_checksum(k_peer, checksum::Algorithm::KCrc16Ccitt);
+    EXPECT_EQ(session->checksum_for(k_peer), checksum::Algorithm::KCrc16Ccitt);
+}
+
+TEST(ChecksumTest, ChecksumIsSetWhileAnotherThreadSends) {
+    asio::io_context context;
+    const asio::ip::udp::endpoint k_peer(asio::ip::address_v4::loopback(), 4242);
+    auto session = std::make_shared<Session>(context, k_peer);
+
+    // The handshake runs on the io thread while the game thread keeps reading the algorithm
+    std::thread writer([&session, &k_peer] {
+        for (std::uint16_t port = 5000; port < 6000; ++port) {
+            session->set_checksum(asio::ip::udp::endpoint(asio::ip::address_v4::loopback(), port),
+                                  checksum::Algorithm::KCrc32c);
+        }
+        session->set_checksum(k_peer, checksum::Algorithm::KCrc32c);
+    });
+    for (int i = 0; i < 1000; ++i) {
+        (void)session->checksum_for(k_peer);
+    }
+    writer.join();
+    EXPECT_EQ(session->checksum_for(k_peer), checksum::Algorithm::KCrc32c);
+}
@@ -113,6 +113,51 @@ TEST_F(IntegrationTest, HandshakeFlow) {
     ASSERT_TRUE(login_success);
 }
 
+TEST_F(IntegrationTest, HandshakeRejectsOtherProtocolVersion) {
+    auto server = std::make_shared<Session>(m_ctx, asio::ip::udp::endpoint{}, ReliabilityConfig{}, 0);
+    auto client = std::make_shared<Session>(m_ctx, asio::ip::udp::endpoint{}, ReliabilityConfig{}, 0);
+
+    std::atomic<bool> handled = false;
+    server->start(
+        [&](const Packet& p, const asio::ip::udp::endpoint& ep) {
+            handled = net::handshake::handle_server_handshake(p, server, ep);
+        },
+        [](const Packet&, const asio::ip::udp::endpoint&) {}
+    );
+
+    std::atomic<bool> replied = false;
+    std::atomic<bool> login_success = false;
+    client->start(
+        [&](const Packet& p, const asio::ip::udp::endpoint&) {
+            if (auto res = net::handshake::parse_res_login(p)) {
+                login_success = res->m_success;
+                replied = true;
+            }
+        },
+        [](const Packet&, const asio::ip::udp::endpoint&) {}
+    );
+
+    net::handshake::ReqLogin req{};
+    req.m_username = "Tester";
+    req.m_version = net::handshake::k_protocol_version - 1;
+    req.m_preferred_fragment_size = 100;
+    asio::ip::udp::endpoint server_ep(asio::ip::address_v4::loopback(), server->local_endpoint().port());
+    client->send(net::handshake::make_req_login(req), server_ep, true);
+
+    int retries = 0;
+    while (!replied && retries < 100) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        server->poll();
+        client->poll();
+        retries++;
+    }
+
+    ASSERT_TRUE(replied);
+    EXPECT_TRUE(handled);
+    EXPECT_FALSE(login_success);
+    EXPECT_EQ(server->fragment_payload_size(), k_max_payload_size);
+}
+
 TEST_F(IntegrationTest, Fragmentation) {
     auto server = std::make_shared<Session>(m_ctx, asio::ip::udp::endpoint{}, ReliabilityConfig{}, 0);
     auto client = std::make_shared<Session>(m_ctx, asio::ip::udp::endpoint{}, ReliabilityConfig{}, 0);